@@ -29,6 +29,35 @@
 #include "Configuration.h"
 #include <util/delay.h>
 #include "ADC.h"
+#include "Scheduler.h"
+#include "Profile.h"
+#include "Trace.h"
+
+#define AdcChannels			8
+
+/* ADC clock prescaler(ADPS2:0): the smallest division giving at most 200 kHz, the full 10-bit resolution */
+#if F_CPU <= 400000UL
+	#define AdcPrescaler		( 1 << ADPS0 )									// F_CPU/2
+#elif F_CPU <= 800000UL
+	#define AdcPrescaler		( 1 << ADPS1 )									// F_CPU/4
+#elif F_CPU <= 1600000UL
+	#define AdcPrescaler		( ( 1 << ADPS1 ) | ( 1 << ADPS0 ) )				// F_CPU/8
+#elif F_CPU <= 3200000UL
+	#define AdcPrescaler		( 1 << ADPS2 )									// F_CPU/16
+#elif F_CPU <= 6400000UL
+	#define AdcPrescaler		( ( 1 << ADPS2 ) | ( 1 << ADPS0 ) )				// F_CPU/32
+#elif F_CPU <= 12800000UL
+	#define AdcPrescaler		( ( 1 << ADPS2 ) | ( 1 << ADPS1 ) )				// F_CPU/64, 125 kHz at 8 MHz
+#else
+	#define AdcPrescaler		( ( 1 << ADPS2 ) | ( 1 << ADPS1 ) | ( 1 << ADPS0 ) )	// F_CPU/128
+#endif
+#define AdcEnable				( ( 1 << ADEN ) | AdcPrescaler )
+
+static unsigned int Samples [ AdcChannels ] ;
+static unsigned char SampleMask ;
+static unsigned char SampleChannel ;
+static unsigned char SampleConverting ;
+static unsigned char SampleTask = SCHED_NoTask ;
 
 /*
  *
@@ -39,7 +68,7 @@
  */
 void ADC_Init ( )
 	{
-		ADCSRA =0x81 ; //Enable ADC , sampling freq=osc_freq/2
+		ADCSRA = AdcEnable ; //Enable ADC , ADC clock=F_CPU/AdcPrescaler(at most 200 kHz)
 		ADMUX = 0x00 ; //Result right justified, select channel zero
 	}
 
@@ -52,11 +81,115 @@ void ADC_Init ( )
  */
 unsigned int ADC_StartConversion ( unsigned char channel )
 	{
+		unsigned int result ;
+		PROFILE_Begin ( ) ;
+
 		ADMUX = channel ;
 		_delay_ms ( 5 ) ;
-		ADCSRA = 0xc1 ;
+		TRACE_On ( TRACE_PinAdc ) ;
+		ADCSRA = AdcEnable | ( 1 << ADSC ) | ( 1 << ADIF ) ;		// Start the conversion, writing one to ADIF clears the flag of the previous one
 		while ( ( ADCSRA & ( 1 << ADIF ) ) == 0 ) ;
-		return ( ADCW ) ;
+		result = ADCW ;
+		TRACE_Off ( TRACE_PinAdc ) ;
+		PROFILE_End ( PROFILE_Adc ) ;
+		return ( result ) ;
+	}
+
+/*
+ *
+ * Description  :This function selects the next channel of SampleMask on the ADC input.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+static void ADC_SampleNext ( )
+	{
+		do
+			SampleChannel = ( SampleChannel + 1 ) & ( AdcChannels - 1 ) ;
+		while ( ! ( SampleMask & ( 1 << SampleChannel ) ) ) ;
+		ADMUX = SampleChannel ;
+	}
+
+/*
+ *
+ * Description  :Scheduler task of the background sampling.
+ *		It starts a conversion, and on a later call stores the result and selects the next channel.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+static void ADC_SampleTask ( )
+	{
+		if ( SampleConverting )
+			{
+				if ( ADCSRA & ( 1 << ADSC ) )	// Conversion is not finished yet, try on the next call
+					return ;
+				Samples [ SampleChannel ] = ADCW ;
+				TRACE_Off ( TRACE_PinAdc ) ;
+				SampleConverting = 0 ;
+				ADC_SampleNext ( ) ;			// The input settles till the next call
+			}
+		else
+			{
+				TRACE_On ( TRACE_PinAdc ) ;
+				ADCSRA |= ( 1 << ADSC ) ;
+				SampleConverting = 1 ;
+			}
+	}
+
+/*
+ *
+ * Description  :This function starts sampling the selected channels in the background with a scheduler task.
+ *		Each call of the task either starts a conversion or reads the result and selects the next channel,
+ *		so the channel input has one period to settle instead of the 5ms busy wait of ADC_StartConversion().
+ *		Every channel is updated every 2*period_ms*(number of channels).
+ *		SCHED_Init() must be called first.
+ *	ex:
+ *		ADC_SampleStart ( 0x03 , 5 ) ;		// Channel 0 and 1, each one updated every 20ms
+ * I/P Arguments: unsigned char-->channel mask(bit0=channel 0 ... bit7=channel 7), unsigned int-->period in ms.
+ * Return value : unsigned char-->scheduler task id, SCHED_NoTask if the mask is zero or the task table is full.
+ *
+ */
+unsigned char ADC_SampleStart ( unsigned char channel_mask , unsigned int period_ms )
+	{
+		ADC_SampleStop ( ) ;
+		if ( channel_mask == 0 )
+			return SCHED_NoTask ;
+
+		SampleMask = channel_mask ;
+		SampleChannel = AdcChannels - 1 ;
+		SampleConverting = 0 ;
+		ADCSRA = AdcEnable ;				// Enable ADC , ADC clock=F_CPU/AdcPrescaler(at most 200 kHz)
+		ADC_SampleNext ( ) ;				// Select the first channel of the mask
+
+		SampleTask = SCHED_AddPeriodic ( ADC_SampleTask , period_ms , 0 ) ;
+		return SampleTask ;
+	}
+
+/*
+ *
+ * Description  :This function stops the background sampling started by ADC_SampleStart().
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void ADC_SampleStop ( )
+	{
+		SCHED_Remove ( SampleTask ) ;
+		SampleTask = SCHED_NoTask ;
+		TRACE_Off ( TRACE_PinAdc ) ;		// The result of a conversion in progress is not read
+	}
+
+/*
+ *
+ * Description  :This function returns the last background sample of a channel.
+ * I/P Arguments: unsigned char-->channel number(0-7).
+ * Return value : unsigned int-->10 bit ADC result, 0 till the first conversion of the channel is done.
+ *
+ */
+unsigned int ADC_GetSample ( unsigned char channel )
+	{
+		return Samples [ channel & ( AdcChannels - 1 ) ] ;
 	}
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
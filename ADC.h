@@ -46,6 +46,39 @@ void ADC_Init ( ) ;
  */
 unsigned int ADC_StartConversion ( unsigned char channel ) ;
 
+/*
+ *
+ * Description  :This function starts sampling the selected channels in the background with a scheduler task.
+ *		Each call of the task either starts a conversion or reads the result and selects the next channel,
+ *		so the channel input has one period to settle instead of the 5ms busy wait of ADC_StartConversion().
+ *		Every channel is updated every 2*period_ms*(number of channels).
+ *		SCHED_Init() must be called first.
+ *	ex:
+ *		ADC_SampleStart ( 0x03 , 5 ) ;		// Channel 0 and 1, each one updated every 20ms
+ * I/P Arguments: unsigned char-->channel mask(bit0=channel 0 ... bit7=channel 7), unsigned int-->period in ms.
+ * Return value : unsigned char-->scheduler task id, SCHED_NoTask if the mask is zero or the task table is full.
+ *
+ */
+unsigned char ADC_SampleStart ( unsigned char channel_mask , unsigned int period_ms ) ;
+
+/*
+ *
+ * Description  :This function stops the background sampling started by ADC_SampleStart().
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void ADC_SampleStop ( ) ;
+
+/*
+ *
+ * Description  :This function returns the last background sample of a channel.
+ * I/P Arguments: unsigned char-->channel number(0-7).
+ * Return value : unsigned int-->10 bit ADC result, 0 till the first conversion of the channel is done.
+ *
+ */
+unsigned int ADC_GetSample ( unsigned char channel ) ;
+
 #endif /* ADC_H_ */
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
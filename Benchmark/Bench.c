@@ -0,0 +1,240 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Benchmark\Bench.c
+//
+// summary:	Benchmark class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * Bench.c
+ *
+ *
+ * |_______Cycle counting benchmark for the drivers_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 17:10:41
+ *
+ * Filename: Bench.c
+ * Controller: Atmega32
+ * Oscillator: 1 MHz
+ * Author: Mohammad Sadr
+ * Reference:Atmega32 dataSheet
+ *
+ * Note:
+ *
+ *		The 32-bit count is read like SCHED_Counts(): an overflow which is pending while the interrupts
+ *		are disabled is added when TCNT1 was read after it.
+ *		The cycles of the BENCH_Run() call path itself are measured once on an empty function
+ *		and taken off each result.
+ *
+ */
+
+#include <avr/io.h>
+#include "Configuration.h"
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+#include <util/atomic.h>
+#include "UART.h"
+#include "Format.h"
+#include "Bench.h"
+
+static volatile unsigned int CyclesHigh ;		// Timer1 overflows
+static volatile unsigned int LatencyMin ;
+static volatile unsigned int LatencyMax ;
+static unsigned long Overhead ;				// Cycles of the measurement on an empty function
+
+ISR ( TIMER1_OVF_vect )
+	{
+		CyclesHigh++ ;
+	}
+
+/* Latency probe: TCNT1 has counted on since the match */
+ISR ( TIMER1_COMPA_vect )
+	{
+		unsigned int now = TCNT1 ;
+		unsigned int latency = ( now - OCR1A ) & 0xffff ;		// Across the wrap around, int is wider on the host
+
+		if ( latency < LatencyMin )
+			LatencyMin = latency ;
+		if ( latency > LatencyMax )
+			LatencyMax = latency ;
+		OCR1A = now + BENCH_ProbePeriod ;
+	}
+
+static void BENCH_Empty ( )
+	{
+	}
+
+static void BENCH_Print ( const char *text )
+	{
+		while ( *text )
+			UART_TxChar ( *text++ ) ;
+	}
+
+/* Sends ,"name":value */
+static void BENCH_Field ( const char *name , unsigned long value )
+	{
+		char buf [ FORMAT_BufferSize ] ;
+
+		BENCH_Print ( ",\"" ) ;
+		BENCH_Print ( name ) ;
+		BENCH_Print ( "\":" ) ;
+		FORMAT_Unsigned32 ( buf , value , 0 , ' ' ) ;
+		BENCH_Print ( buf ) ;
+	}
+
+/*
+ *
+ * Description  :This function initializes the UART for the report, starts the Timer1 cycle counter
+ *		and measures the overhead of a BENCH_Run() on an empty function. Global interrupts are enabled.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void BENCH_Init ( )
+	{
+		unsigned long start ;
+
+		UART_Init ( ) ;
+
+		TCCR1B = 0 ;							// Stop the timer while it is set up
+		TCCR1A = 0 ;							// Normal mode, OC1A/OC1B disconnected
+		TCNT1 = 0 ;
+		ATOMIC_BLOCK ( ATOMIC_RESTORESTATE )
+			{
+				CyclesHigh = 0 ;
+			}
+		TIFR = ( 1 << TOV1 ) | ( 1 << OCF1A ) ;
+		TIMSK = ( TIMSK & ~ ( 1 << OCIE1A ) ) | ( 1 << TOIE1 ) ;
+		TCCR1B = ( 1 << CS10 ) ;				// F_CPU/1
+		sei ( ) ;
+
+		Overhead = 0 ;
+		start = BENCH_Cycles ( ) ;
+		BENCH_Empty ( ) ;
+		Overhead = BENCH_Cycles ( ) - start ;
+	}
+
+/*
+ *
+ * Description  :This function returns the number of CPU cycles since BENCH_Init().
+ * I/P Arguments: none
+ * Return value : unsigned long--> cycles
+ *
+ */
+unsigned long BENCH_Cycles ( )
+	{
+		unsigned int high , low ;
+
+		ATOMIC_BLOCK ( ATOMIC_RESTORESTATE )
+			{
+				high = CyclesHigh ;
+				low = TCNT1 ;
+				if ( ( TIFR & ( 1 << TOV1 ) ) && low < 0x8000 )
+					high++ ;						// Overflow not served yet, TCNT1 was read after it
+			}
+		return ( ( unsigned long ) high << 16 ) | low ;
+	}
+
+/*
+ *
+ * Description  :This function calls the function twice: the first call is timed with Timer1 alone,
+ *		the second one with the latency probe running. One JSON line is sent for the result,
+ *		so the function must give the same work each time it is called.
+ *		setup is called before each call and is not timed(ex: wait till the EEPROM is ready).
+ * I/P Arguments: const char *--> name of the benchmark
+ *		BenchFunction--> setup function, 0 if none
+ *		BenchFunction--> function to be measured
+ *		unsigned int--> number of driver operations done by one call
+ *		unsigned int--> number of data bytes moved by one call(0 if none)
+ * Return value : unsigned long--> cycles of the first call
+ *
+ */
+unsigned long BENCH_Run ( const char *name , BenchFunction setup , BenchFunction function , unsigned int ops , unsigned int bytes )
+	{
+		unsigned long start , cycles ;
+
+		if ( setup )
+			setup ( ) ;
+		start = BENCH_Cycles ( ) ;
+		function ( ) ;
+		cycles = BENCH_Cycles ( ) - start ;
+		cycles = ( cycles > Overhead ) ? cycles - Overhead : 0 ;
+
+		if ( setup )
+			setup ( ) ;
+		ATOMIC_BLOCK ( ATOMIC_RESTORESTATE )
+			{
+				LatencyMin = 0xffff ;
+				LatencyMax = 0 ;
+				OCR1A = TCNT1 + BENCH_ProbePeriod ;
+				TIFR = ( 1 << OCF1A ) ;
+				TIMSK |= ( 1 << OCIE1A ) ;
+			}
+		function ( ) ;
+		TIMSK &= ~ ( 1 << OCIE1A ) ;
+
+		BENCH_Print ( "{\"bench\":\"" ) ;
+		BENCH_Print ( name ) ;
+		BENCH_Print ( "\"" ) ;
+		BENCH_Field ( "ops" , ops ) ;
+		BENCH_Field ( "bytes" , bytes ) ;
+		BENCH_Field ( "cycles" , cycles ) ;
+		BENCH_Field ( "cycles_per_op" , ops ? cycles / ops : 0 ) ;
+		BENCH_Field ( "bytes_per_s" , ( bytes && cycles ) ? ( unsigned long ) ( ( unsigned long long ) F_CPU * bytes / cycles ) : 0 ) ;
+		if ( LatencyMin == 0xffff )
+			BENCH_Print ( ",\"isr_latency_min\":null,\"isr_latency_max\":null" ) ;
+		else
+			{
+				BENCH_Field ( "isr_latency_min" , LatencyMin ) ;
+				BENCH_Field ( "isr_latency_max" , LatencyMax ) ;
+			}
+		BENCH_Print ( "}\r\n" ) ;
+		return cycles ;
+	}
+
+/*
+ *
+ * Description  :This function sends one JSON line with a value which is not a time,
+ *		ex: {"bench":"sram_freed","value":64}
+ * I/P Arguments: const char *--> name of the value
+ *		unsigned long--> value
+ * Return value : none
+ *
+ */
+void BENCH_Value ( const char *name , unsigned long value )
+	{
+		BENCH_Print ( "{\"bench\":\"" ) ;
+		BENCH_Print ( name ) ;
+		BENCH_Print ( "\"" ) ;
+		BENCH_Field ( "value" , value ) ;
+		BENCH_Print ( "}\r\n" ) ;
+	}
+
+/*
+ *
+ * Description  :This function sends the end line, waits till it is transmitted
+ *		and sleeps with the interrupts disabled, which stops simavr.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void BENCH_Done ( )
+	{
+		BENCH_Print ( "{\"bench\":\"done\"}\r" ) ;
+		UCSRA = ( 1 << TXC ) ;					// Cleared by writing one, set again after the last frame
+		UART_TxChar ( '\n' ) ;
+		while ( ! ( UCSRA & ( 1 << TXC ) ) )
+			;
+
+		cli ( ) ;
+		set_sleep_mode ( SLEEP_MODE_PWR_DOWN ) ;
+		sleep_enable ( ) ;
+		sleep_cpu ( ) ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Benchmark\Bench.c
+////////////////////////////////////////////////////////////////////////////////////////////////////
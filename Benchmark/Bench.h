@@ -0,0 +1,112 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Benchmark\Bench.h
+//
+// summary:	Declares the benchmark class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * Bench.h
+ *
+ *
+ * |_______Cycle counting benchmark for the drivers_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 17:10:41
+ *
+ * Filename: Bench.h
+ * Controller: Atmega32
+ * Oscillator: 1 MHz
+ * Author: Mohammad Sadr
+ * Reference:Atmega32 dataSheet
+ *
+ * Note:
+ *
+ *		Each Bench*.c file is a small firmware image which is run in simavr(see Makefile).
+ *		Timer1 counts the CPU cycles(normal mode, prescaler 1) and its overflow interrupt extends it to 32 bits.
+ *		The compare A interrupt is the latency probe: its ISR reads TCNT1 - OCR1A, the number of cycles
+ *		since the compare match, and sets the next match BENCH_ProbePeriod cycles later.
+ *		The drivers do not use Timer1.
+ *
+ *		The results are sent on the UART as one JSON object per line:
+ *		{"bench":"EEPROM_WriteNBytes","ops":16,"bytes":16,"cycles":...,"cycles_per_op":...,
+ *		"bytes_per_s":...,"isr_latency_min":...,"isr_latency_max":...}
+ *		The latency is in cycles from the compare match to the first instruction of the ISR body,
+ *		so the ISR prologue is included. It is null if the function was shorter than one probe period.
+ *	ex:
+ *		BENCH_Init ( ) ;
+ *		BENCH_Run ( "LCD_Clear" , 0 , LCD_Clear , 1 , 0 ) ;
+ *		BENCH_Done ( ) ;
+ *
+ */
+
+#ifndef BENCH_H_
+#define BENCH_H_
+
+#define BENCH_ProbePeriod		211			// Latency probe period in cycles, a prime so it does not lock to the loops
+
+typedef void ( *BenchFunction ) ( void ) ;
+
+/*
+ *
+ * Description  :This function initializes the UART for the report, starts the Timer1 cycle counter
+ *		and measures the overhead of a BENCH_Run() on an empty function. Global interrupts are enabled.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void BENCH_Init ( ) ;
+
+/*
+ *
+ * Description  :This function returns the number of CPU cycles since BENCH_Init().
+ * I/P Arguments: none
+ * Return value : unsigned long--> cycles
+ *
+ */
+unsigned long BENCH_Cycles ( ) ;
+
+/*
+ *
+ * Description  :This function calls the function twice: the first call is timed with Timer1 alone,
+ *		the second one with the latency probe running. One JSON line is sent for the result,
+ *		so the function must give the same work each time it is called.
+ *		setup is called before each call and is not timed(ex: wait till the EEPROM is ready).
+ * I/P Arguments: const char *--> name of the benchmark
+ *		BenchFunction--> setup function, 0 if none
+ *		BenchFunction--> function to be measured
+ *		unsigned int--> number of driver operations done by one call
+ *		unsigned int--> number of data bytes moved by one call(0 if none)
+ * Return value : unsigned long--> cycles of the first call
+ *
+ */
+unsigned long BENCH_Run ( const char *name , BenchFunction setup , BenchFunction function , unsigned int ops , unsigned int bytes ) ;
+
+/*
+ *
+ * Description  :This function sends one JSON line with a value which is not a time,
+ *		ex: {"bench":"sram_freed","value":64}
+ * I/P Arguments: const char *--> name of the value
+ *		unsigned long--> value
+ * Return value : none
+ *
+ */
+void BENCH_Value ( const char *name , unsigned long value ) ;
+
+/*
+ *
+ * Description  :This function sends the end line, waits till it is transmitted
+ *		and sleeps with the interrupts disabled, which stops simavr.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void BENCH_Done ( ) ;
+
+#endif /* BENCH_H_ */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Benchmark\Bench.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,62 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Benchmark\BenchAdc.c
+//
+// summary:	ADC benchmark
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * BenchAdc.c
+ *
+ *
+ * |_______Benchmark of ADC.c_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 17:10:41
+ *
+ * Filename: BenchAdc.c
+ * Controller: Atmega32
+ * Oscillator: 1 MHz
+ * Author: Mohammad Sadr
+ *
+ * Note:
+ *
+ *		The conversion time comes from the ADC prescaler of ADC_Init(), the inputs are left open.
+ *
+ */
+
+#include <avr/io.h>
+#include "Configuration.h"
+#include "ADC.h"
+#include "Bench.h"
+
+static volatile unsigned int Result ;
+
+static void BenchConversion ( )
+	{
+		Result = ADC_StartConversion ( 0 ) ;
+	}
+
+static void BenchAllChannels ( )
+	{
+		unsigned char channel ;
+
+		for ( channel = 0 ; channel < 8 ; channel++ )
+			Result = ADC_StartConversion ( channel ) ;
+	}
+
+int main ( )
+	{
+		BENCH_Init ( ) ;
+		BENCH_Run ( "ADC_Init" , 0 , ADC_Init , 1 , 0 ) ;
+		BENCH_Run ( "ADC_StartConversion" , 0 , BenchConversion , 1 , 2 ) ;
+		BENCH_Run ( "ADC_StartConversion_8ch" , 0 , BenchAllChannels , 8 , 16 ) ;
+		BENCH_Done ( ) ;
+		return 0 ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Benchmark\BenchAdc.c
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,84 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Benchmark\BenchEeprom.c
+//
+// summary:	EEPROM benchmark
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * BenchEeprom.c
+ *
+ *
+ * |_______Benchmark of EEPROM.c_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 17:10:41
+ *
+ * Filename: BenchEeprom.c
+ * Controller: Atmega32
+ * Oscillator: 1 MHz
+ * Author: Mohammad Sadr
+ *
+ * Note:
+ *
+ *		Each benchmark starts with the EEPROM ready, so EEPROM_WriteByte() shows the cost of starting
+ *		a write and EEPROM_WriteNBytes() the time it blocks waiting for the bytes before the last one.
+ *
+ */
+
+#include <avr/io.h>
+#include "Configuration.h"
+#include "EEPROM.h"
+#include "Bench.h"
+
+#define BenchAddress			0x100
+#define BenchBytes				16
+
+static unsigned char Data [ BenchBytes ] ;
+
+static void BenchReady ( )
+	{
+		while ( EECR & ( 1 << EEWE ) ) ;
+	}
+
+static void BenchWriteByte ( )
+	{
+		EEPROM_WriteByte ( BenchAddress , 0x5a ) ;
+	}
+
+static void BenchReadByte ( )
+	{
+		Data [ 0 ] = EEPROM_ReadByte ( BenchAddress ) ;
+	}
+
+static void BenchWriteNBytes ( )
+	{
+		EEPROM_WriteNBytes ( BenchAddress , Data , BenchBytes ) ;
+	}
+
+static void BenchReadNBytes ( )
+	{
+		EEPROM_ReadNBytes ( BenchAddress , Data , BenchBytes ) ;
+	}
+
+int main ( )
+	{
+		unsigned char i ;
+
+		for ( i = 0 ; i < BenchBytes ; i++ )
+			Data [ i ] = i ;
+
+		BENCH_Init ( ) ;
+		BENCH_Run ( "EEPROM_WriteByte" , BenchReady , BenchWriteByte , 1 , 1 ) ;
+		BENCH_Run ( "EEPROM_ReadByte" , BenchReady , BenchReadByte , 1 , 1 ) ;
+		BENCH_Run ( "EEPROM_WriteNBytes" , BenchReady , BenchWriteNBytes , 1 , BenchBytes ) ;
+		BENCH_Run ( "EEPROM_ReadNBytes" , BenchReady , BenchReadNBytes , 1 , BenchBytes ) ;
+		BENCH_Done ( ) ;
+		return 0 ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Benchmark\BenchEeprom.c
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,50 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Benchmark\BenchHost.cpp
+//
+// summary:	Host start up of the benchmark images
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * BenchHost.cpp
+ *
+ *
+ * |_______Benchmark images on the host simulation_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 17:10:41
+ *
+ * Filename: BenchHost.cpp
+ * Host: Linux g++(the drivers are compiled as C++)
+ * Author: Mohammad Sadr
+ *
+ * Note:
+ *
+ *		The main() of the image is renamed BenchMain() by the Makefile. BENCH_Done() ends the program
+ *		in sleep_cpu(), the UART output is printed on the way out.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "Sim.h"
+
+int BenchMain ( ) ;
+
+static void BenchHost_Output ( )
+	{
+		fputs ( SimUart_Output ( ).c_str ( ) , stdout ) ;
+	}
+
+int main ( )
+	{
+		Sim_Reset ( ) ;
+		atexit ( BenchHost_Output ) ;
+		return BenchMain ( ) ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Benchmark\BenchHost.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
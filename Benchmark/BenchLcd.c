@@ -0,0 +1,71 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Benchmark\BenchLcd.c
+//
+// summary:	LCD benchmark
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * BenchLcd.c
+ *
+ *
+ * |_______Benchmark of LCD_8_bit.c_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 17:10:41
+ *
+ * Filename: BenchLcd.c
+ * Controller: Atmega32
+ * Oscillator: 1 MHz
+ * Author: Mohammad Sadr
+ *
+ * Note:
+ *
+ *		LCD_8_bit.c is measured as it has LCD_DisplayString(), LCD_4_bit.c writes with the same delays.
+ *		Nothing has to be attached to the ports, the drivers do not read the busy flag.
+ *
+ */
+
+#include <avr/io.h>
+#include "Configuration.h"
+#include "LCD_8_bit.h"
+#include "Bench.h"
+
+static char Text [ ] = "0123456789abcdef" ;
+
+static void BenchDataWrite ( )
+	{
+		unsigned char i ;
+
+		for ( i = 0 ; i < 16 ; i++ )
+			LCD_DataWrite ( Text [ i ] ) ;
+	}
+
+static void BenchDisplayString ( )
+	{
+		LCD_DisplayString ( Text ) ;
+	}
+
+static void BenchDisplayNumber ( )
+	{
+		LCD_DisplayNumber ( 65535 ) ;
+	}
+
+int main ( )
+	{
+		BENCH_Init ( ) ;
+		BENCH_Run ( "LCD_Init" , 0 , LCD_Init , 1 , 0 ) ;
+		BENCH_Run ( "LCD_Clear" , 0 , LCD_Clear , 1 , 0 ) ;
+		BENCH_Run ( "LCD_GoToLineTwo" , 0 , LCD_GoToLineTwo , 1 , 0 ) ;
+		BENCH_Run ( "LCD_DataWrite" , 0 , BenchDataWrite , 16 , 16 ) ;
+		BENCH_Run ( "LCD_DisplayString" , LCD_GoToLineOne , BenchDisplayString , 1 , 16 ) ;
+		BENCH_Run ( "LCD_DisplayNumber" , LCD_GoToLineTwo , BenchDisplayNumber , 1 , 5 ) ;
+		BENCH_Done ( ) ;
+		return 0 ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Benchmark\BenchLcd.c
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,66 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Benchmark\BenchRtc.c
+//
+// summary:	DS1307 benchmark
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * BenchRtc.c
+ *
+ *
+ * |_______Benchmark of RTC_DS1307.c_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 17:10:41
+ *
+ * Filename: BenchRtc.c
+ * Controller: Atmega32
+ * Oscillator: 1 MHz
+ * Author: Mohammad Sadr
+ *
+ * Note:
+ *
+ *		simavr has no DS1307, the address is not acknowledged and the reads give 0xff.
+ *		The drivers do not check the TWI status, so the bus time is the same as with the chip.
+ *
+ */
+
+#include <avr/io.h>
+#include "Configuration.h"
+#include "RTC_DS1307.h"
+#include "Bench.h"
+
+static unsigned char Hour , Minute , Second ;
+
+static void BenchGetTime ( )
+	{
+		DS1307_GetTime ( &Hour , &Minute , &Second ) ;
+	}
+
+static void BenchSetTime ( )
+	{
+		DS1307_SetTime ( 0x12 , 0x34 , 0x56 ) ;
+	}
+
+static void BenchGetDate ( )
+	{
+		DS1307_GetDate ( &Hour , &Minute , &Second ) ;
+	}
+
+int main ( )
+	{
+		BENCH_Init ( ) ;
+		BENCH_Run ( "DS1307_Init" , 0 , DS1307_Init , 1 , 1 ) ;
+		BENCH_Run ( "DS1307_SetTime" , 0 , BenchSetTime , 1 , 3 ) ;
+		BENCH_Run ( "DS1307_GetTime" , 0 , BenchGetTime , 1 , 3 ) ;
+		BENCH_Run ( "DS1307_GetDate" , 0 , BenchGetDate , 1 , 3 ) ;
+		BENCH_Done ( ) ;
+		return 0 ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Benchmark\BenchRtc.c
+////////////////////////////////////////////////////////////////////////////////////////////////////
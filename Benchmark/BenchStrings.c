@@ -0,0 +1,98 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Benchmark\BenchStrings.c
+//
+// summary:	Benchmark of the strings in SRAM and in flash
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * BenchStrings.c
+ *
+ *
+ * |_______Benchmark of the _P string functions_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 20:02:37
+ *
+ * Filename: BenchStrings.c
+ * Controller: Atmega32
+ * Oscillator: 1 MHz
+ * Author: Mohammad Sadr
+ *
+ * Note:
+ *
+ *		The same 16 chars(a line for the UART) are sent from SRAM and from flash, ops is the number of chars,
+ *		so cycles_per_op is the cost of one char. pgm_read_byte() is one LPM(3 cycles) where
+ *		the SRAM copy reads with LD(2 cycles), the difference only shows in strlen(), the LCD and
+ *		the UART wait far longer for each char.
+ *		"sram_freed" is the SRAM the strings of this image take when they are not in flash:
+ *		a string in SRAM is also kept in flash and copied to SRAM at startup.
+ *
+ */
+
+#include <avr/io.h>
+#include <avr/pgmspace.h>
+#include <string.h>
+#include "Configuration.h"
+#include "LCD_8_bit.h"
+#include "UART.h"
+#include "Bench.h"
+
+#define TextLength				16
+
+static char RamText [ ] = "0123456789abcdef" ;
+static const char FlashText [ ] PROGMEM = "0123456789abcdef" ;
+static char RamLine [ ] = "0123456789abcd\r\n" ;		// Ends the line, so the report lines stay apart
+static const char FlashLine [ ] PROGMEM = "0123456789abcd\r\n" ;
+static volatile unsigned int Length ;
+
+static void BenchStrlen ( )
+	{
+		Length = strlen ( RamText ) ;
+	}
+
+static void BenchStrlen_P ( )
+	{
+		Length = strlen_P ( FlashText ) ;
+	}
+
+static void BenchLcdString ( )
+	{
+		LCD_DisplayString ( RamText ) ;
+	}
+
+static void BenchLcdString_P ( )
+	{
+		LCD_DisplayString_P ( FlashText ) ;
+	}
+
+static void BenchUartString ( )
+	{
+		UART_TxString ( RamLine ) ;
+	}
+
+static void BenchUartString_P ( )
+	{
+		UART_TxString_P ( FlashLine ) ;
+	}
+
+int main ( )
+	{
+		BENCH_Init ( ) ;
+		LCD_Init ( ) ;
+		BENCH_Value ( "sram_freed" , sizeof ( RamText ) + sizeof ( RamLine ) ) ;
+		BENCH_Run ( "strlen" , 0 , BenchStrlen , TextLength , TextLength ) ;
+		BENCH_Run ( "strlen_P" , 0 , BenchStrlen_P , TextLength , TextLength ) ;
+		BENCH_Run ( "LCD_DisplayString" , LCD_GoToLineOne , BenchLcdString , TextLength , TextLength ) ;
+		BENCH_Run ( "LCD_DisplayString_P" , LCD_GoToLineOne , BenchLcdString_P , TextLength , TextLength ) ;
+		BENCH_Run ( "UART_TxString" , 0 , BenchUartString , TextLength , TextLength ) ;
+		BENCH_Run ( "UART_TxString_P" , 0 , BenchUartString_P , TextLength , TextLength ) ;
+		BENCH_Done ( ) ;
+		return 0 ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Benchmark\BenchStrings.c
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,82 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Benchmark\BenchTrace.c
+//
+// summary:	Trace pin image for simavr
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * BenchTrace.c
+ *
+ *
+ * |_______Trace pins of the drivers in a simavr VCD file_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 18:31:47
+ *
+ * Filename: BenchTrace.c
+ * Controller: Atmega32
+ * Oscillator: 1 MHz
+ * Author: Mohammad Sadr
+ *
+ * Note:
+ *
+ *		The drivers are built with TRACE_ENABLE(see Trace.h and "make trace"). The .mmcu section tells simavr
+ *		to record the trace pins in trace.vcd, so the high times can be measured in GTKWave like on a
+ *		logic analyzer and compared with the cycles of the JSON lines.
+ *		The TWI bus has no DS1307 in simavr: each I2C_Write ends when the byte is shifted out(no ACK is checked).
+ *
+ */
+
+#include <avr/io.h>
+#include "Configuration.h"
+#include "I2C.h"
+#include "RTC_DS1307.h"
+#include "LCD_8_bit.h"
+#include "ADC.h"
+#include "Trace.h"
+#include "Bench.h"
+
+#ifdef __AVR__
+#include "avr_mcu_section.h"
+
+AVR_MCU ( F_CPU , "atmega32" ) ;
+AVR_MCU_VCD_FILE ( "trace.vcd" , 1000 ) ;
+
+const struct avr_mmcu_vcd_trace_t TraceSignals [ ] _MMCU_ =
+	{
+		{ AVR_MCU_VCD_SYMBOL ( "i2c_write" ) , .mask = ( 1 << TRACE_PinI2cWrite ) , .what = ( void * ) &TRACE_PORT , } ,
+		{ AVR_MCU_VCD_SYMBOL ( "lcd_write" ) , .mask = ( 1 << TRACE_PinLcdWrite ) , .what = ( void * ) &TRACE_PORT , } ,
+		{ AVR_MCU_VCD_SYMBOL ( "adc" ) , .mask = ( 1 << TRACE_PinAdc ) , .what = ( void * ) &TRACE_PORT , } ,
+	} ;
+#endif
+
+static void BenchDataWrite ( )
+	{
+		LCD_DataWrite ( 'A' ) ;
+	}
+
+static void BenchConversion ( )
+	{
+		ADC_StartConversion ( 0 ) ;
+	}
+
+int main ( )
+	{
+		BENCH_Init ( ) ;
+		LCD_Init ( ) ;
+		ADC_Init ( ) ;
+		TRACE_Init ( ) ;							// After LCD_Init(), which sets all of PORTD as output
+
+		BENCH_Run ( "DS1307_Init" , 0 , DS1307_Init , 1 , 1 ) ;
+		BENCH_Run ( "LCD_DataWrite" , 0 , BenchDataWrite , 1 , 1 ) ;
+		BENCH_Run ( "ADC_StartConversion" , 0 , BenchConversion , 1 , 2 ) ;
+		BENCH_Done ( ) ;
+		return 0 ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Benchmark\BenchTrace.c
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,184 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Clock.c
+//
+// summary:	Clock class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * Clock.c
+ *
+ *
+ * |_______AVR internal RC oscillator calibration library_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 23:41:37
+ *
+ * Filename: Clock.c
+ * Controller: Atmega8/16/32/128
+ * Oscillator: 8 MHz internal RC
+ * Author: Mohammad Sadr
+ * Reference:Atmega32 and DS1307 dataSheets
+ *
+ * Note:
+ *
+ *		The SQW edges are polled with TCNT1 read just before the pin, so an edge is stamped a few
+ *		cycles late, the same for both edges, well under one Timer1 count(256 cycles).
+ *		OSCCAL is written only between two measurements: the first edge after a change starts the
+ *		next one, so the counted half second runs all at the new frequency.
+ *		The binary search tries each OSCCAL once, the values next to the last step on both sides are
+ *		among the ones tried, so the nearest count is known at the end without an other measurement.
+ *
+ */
+
+#include <avr/io.h>
+#include "Configuration.h"
+#include "Clock.h"
+#include "EEPROM.h"
+#include "RTC_DS1307.h"
+
+#if CLOCK_Divider == 256UL
+	#define ClockPrescaler		( 1 << CS12 )					// F_CPU/256
+#else
+	#define ClockPrescaler		( ( 1 << CS12 ) | ( 1 << CS10 ) )	// F_CPU/1024
+#endif
+#define ClockTimeout			( 4 * CLOCK_HalfSecond )		// Counts without an edge, the clock may be up to 4 times too fast
+
+static unsigned char SavedTccr1a ;
+static unsigned char SavedTccr1b ;
+
+static void ClockTimerStart ( )
+	{
+		SavedTccr1a = TCCR1A ;
+		SavedTccr1b = TCCR1B ;
+		TCCR1B = 0 ;
+		TCCR1A = 0 ;							// Normal mode, OC1A/OC1B disconnected
+		TCCR1B = ClockPrescaler ;
+	}
+
+static void ClockTimerStop ( )
+	{
+		TCCR1B = 0 ;
+		TCCR1A = SavedTccr1a ;
+		TCCR1B = SavedTccr1b ;
+	}
+
+/* Waits for the SQW level to change, returns 0 after ClockTimeout counts without an edge */
+static unsigned char ClockEdge ( unsigned int *stamp )
+	{
+		unsigned char level = CLOCK_SqwInput & ( 1 << CLOCK_SqwPin ) ;
+		unsigned int start = TCNT1 , now ;
+
+		do
+			{
+				now = TCNT1 ;
+				if ( ( ( now - start ) & 0xffff ) > ClockTimeout )		// Across the wrap around, int is wider on the host
+					return 0 ;
+			}
+		while ( ( CLOCK_SqwInput & ( 1 << CLOCK_SqwPin ) ) == level ) ;
+		*stamp = now ;
+		return 1 ;
+	}
+
+/* Timer1 counts from the next edge to the one after it, Timer1 is running */
+static unsigned int ClockMeasure ( )
+	{
+		unsigned int start , end ;
+
+		if ( ! ClockEdge ( &start ) || ! ClockEdge ( &end ) )
+			return 0 ;
+		return ( end - start ) & 0xffff ;
+	}
+
+/*
+ *
+ * Description  :This function measures the clock against SQW/OUT, which must be running at 1Hz.
+ * I/P Arguments: none
+ * Return value : unsigned int-->Timer1 counts of half a second, 0 without edges.
+ *
+ */
+unsigned int CLOCK_Measure ( )
+	{
+		unsigned int counts ;
+
+		CLOCK_SqwDdr &= ~ ( 1 << CLOCK_SqwPin ) ;	// Input with pull-up, SQW/OUT is open drain
+		CLOCK_SqwPort |= ( 1 << CLOCK_SqwPin ) ;
+		ClockTimerStart ( ) ;
+		counts = ClockMeasure ( ) ;
+		ClockTimerStop ( ) ;
+		return counts ;
+	}
+
+/*
+ *
+ * Description  :This function tunes OSCCAL against the 1Hz SQW/OUT of the DS1307 and stores it in EEPROM.
+ * I/P Arguments: none
+ * Return value : unsigned char-->CLOCK_Calibrated or CLOCK_Failed.
+ *
+ */
+unsigned char CLOCK_Calibrate ( )
+	{
+		int low = 0 , high = 255 , middle ;
+		unsigned char best = OSCCAL ;			// Kept when there is no SQW
+		unsigned int counts , error , best_error = 0xffff ;
+
+		DS1307_Init ( ) ;
+		DS1307_SetControl ( DS1307_Sqw1Hz ) ;
+		CLOCK_SqwDdr &= ~ ( 1 << CLOCK_SqwPin ) ;
+		CLOCK_SqwPort |= ( 1 << CLOCK_SqwPin ) ;
+		ClockTimerStart ( ) ;
+
+		while ( low <= high )
+			{
+				middle = ( low + high ) / 2 ;
+				OSCCAL = middle ;
+				counts = ClockMeasure ( ) ;
+				if ( counts == 0 )
+					break ;
+				error = ( counts > CLOCK_HalfSecond ) ? counts - CLOCK_HalfSecond : CLOCK_HalfSecond - counts ;
+				if ( error < best_error )
+					{
+						best_error = error ;
+						best = middle ;
+					}
+				if ( counts < CLOCK_HalfSecond )
+					low = middle + 1 ;			// Too slow
+				else
+					high = middle - 1 ;
+			}
+
+		OSCCAL = best ;
+		ClockTimerStop ( ) ;
+		DS1307_SetControl ( DS1307_SqwOff ) ;
+		if ( best_error > CLOCK_Tolerance )
+			return CLOCK_Failed ;
+
+		EEPROM_WriteByte ( CLOCK_EepromAddress , best ) ;
+		EEPROM_WriteByte ( CLOCK_EepromAddress + 1 , ~ best ) ;
+		return CLOCK_Calibrated ;
+	}
+
+/*
+ *
+ * Description  :This function sets OSCCAL from EEPROM, or calibrates it when nothing valid was stored.
+ * I/P Arguments: none
+ * Return value : unsigned char-->CLOCK_Loaded, CLOCK_Calibrated or CLOCK_Failed.
+ *
+ */
+unsigned char CLOCK_Init ( )
+	{
+		unsigned char osccal = EEPROM_ReadByte ( CLOCK_EepromAddress ) ;
+
+		if ( EEPROM_ReadByte ( CLOCK_EepromAddress + 1 ) == ( unsigned char ) ~ osccal )	// Erased: 0xff 0xff
+			{
+				OSCCAL = osccal ;
+				return CLOCK_Loaded ;
+			}
+		return CLOCK_Calibrate ( ) ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Clock.c
+////////////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
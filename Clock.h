@@ -0,0 +1,114 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Clock.h
+//
+// summary:	Declares the clock class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * Clock.h
+ *
+ *
+ * |_______AVR internal RC oscillator calibration library_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 23:41:37
+ *
+ * Filename: Clock.h
+ * Controller: Atmega8/16/32/128
+ * Oscillator: 8 MHz internal RC
+ * Author: Mohammad Sadr
+ * Reference:Atmega32 and DS1307 dataSheets
+ *
+ * Note:
+ *
+ *		The CPU runs from the 8 MHz internal RC oscillator(CKSEL3:0 = 0100), only its 1 MHz calibration
+ *		byte is loaded into OSCCAL at reset, so the 8 MHz clock is off by up to 10% before it is tuned.
+ *		CLOCK_Calibrate() tunes OSCCAL against the 1Hz SQW/OUT of the DS1307(crystal): Timer1 counts
+ *		F_CPU/CLOCK_Divider between two edges of the square wave(half a second), and OSCCAL is searched
+ *		(binary search, 9 steps, about 8 seconds) for the count nearest to CLOCK_HalfSecond.
+ *		The result is kept in EEPROM(OSCCAL and its complement at CLOCK_EepromAddress), so CLOCK_Init()
+ *		only loads it at the next resets and the DS1307 is not used.
+ *
+ *		SQW/OUT is open drain, it is wired to CLOCK_SqwPin with the internal pull-up.
+ *		The default pin PD6(ICP1) is the RW pin of LCD_8_bit.c: with that LCD, SQW/OUT must be wired
+ *		to a free pin, given by defining CLOCK_SqwPort, CLOCK_SqwDdr, CLOCK_SqwInput and CLOCK_SqwPin
+ *		before this file is included(ex: in Configuration.h). The build with LCD=8(LCD_8_BIT defined)
+ *		stops with an error while the default pin is used.
+ *		Timer1 runs from the prescaler during the measurements, its settings are restored at the end.
+ *	ex:
+ *		status = CLOCK_Init ( ) ;				// Before the UART and the other timings
+ *		UART_PortInit ( UART_Port0 , UART_UbrrU2x ( 38400 ) ) ;
+ *
+ */
+
+#ifndef CLOCK_H_
+#define CLOCK_H_
+
+#include <avr/io.h>
+#include "Configuration.h"
+
+#ifndef CLOCK_SqwPin
+	#define CLOCK_SqwPort		PORTD		// DS1307 SQW/OUT
+	#define CLOCK_SqwDdr		DDRD
+	#define CLOCK_SqwInput		PIND
+	#define CLOCK_SqwPin		PD6
+	#ifdef LCD_8_BIT
+		#error "CLOCK_SqwPin(PD6) is the RW pin of LCD_8_bit.c, define the SQW/OUT pin on a free one"
+	#endif
+#endif
+
+#define CLOCK_EepromAddress		( E2END - 1 )	// 2 bytes, the end of the EEPROM
+
+/* Timer1 prescaler, 2 seconds must fit in the 16-bit counter(time out of a missing edge) */
+#if F_CPU <= 8000000UL
+	#define CLOCK_Divider		256UL
+#else
+	#define CLOCK_Divider		1024UL
+#endif
+#define CLOCK_HalfSecond		( F_CPU / CLOCK_Divider / 2 )	// Timer1 counts between two SQW edges
+#define CLOCK_Tolerance			( CLOCK_HalfSecond / 200 )		// 0.5%
+
+/* Return values of CLOCK_Init() and CLOCK_Calibrate() */
+#define CLOCK_Failed			0			// OSCCAL is the nearest found or the reset one, nothing stored
+#define CLOCK_Calibrated		1			// Within CLOCK_Tolerance and stored in EEPROM
+#define CLOCK_Loaded			2			// Taken from EEPROM
+
+/*
+ *
+ * Description  :This function sets OSCCAL from EEPROM, or calibrates it with CLOCK_Calibrate() when
+ *		nothing valid was stored(first start).
+ * I/P Arguments: none
+ * Return value : unsigned char-->CLOCK_Loaded, CLOCK_Calibrated or CLOCK_Failed.
+ *
+ */
+unsigned char CLOCK_Init ( ) ;
+
+/*
+ *
+ * Description  :This function tunes OSCCAL to F_CPU within 0.5% against the 1Hz SQW/OUT of the DS1307
+ *		and stores it in EEPROM. DS1307_Init() is called, SQW/OUT is turned off at the end.
+ *		It takes about 8 seconds, about 2 seconds without SQW edges.
+ * I/P Arguments: none
+ * Return value : unsigned char-->CLOCK_Calibrated or CLOCK_Failed.
+ *
+ */
+unsigned char CLOCK_Calibrate ( ) ;
+
+/*
+ *
+ * Description  :This function measures the clock against SQW/OUT, which must be running at 1Hz
+ *		(DS1307_SetControl(DS1307_Sqw1Hz)). It takes 0.5 to 1 second.
+ * I/P Arguments: none
+ * Return value : unsigned int-->Timer1 counts of half a second(CLOCK_HalfSecond when exact), 0 without edges.
+ *
+ */
+unsigned int CLOCK_Measure ( ) ;
+
+#endif /* CLOCK_H_ */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Clock.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
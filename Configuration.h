@@ -20,7 +20,12 @@
 #ifndef CONFIGURATION_H_
 #define CONFIGURATION_H_
 
-#define F_CPU 1000000
+#define F_CPU 8000000		// Internal RC oscillator(CKSEL3:0 = 0100), tuned by CLOCK_Init()(see Clock.h)
+
+/* Compile time options, they may also be given with -D */
+//#define PROFILE_ENABLE				// Cycle counters around the blocking driver calls(see Profile.h)
+//#define TRACE_ENABLE					// Trace pins high while the driver routines run(see Trace.h)
+//#define KEYPAD_WAKE_ENABLE			// Key wake-up of KEYPAD_Sleep(), takes the INTx vector(see Keypad.h)
 
 #endif /* CONFIGURATION_H_ */
 
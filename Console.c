@@ -0,0 +1,216 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Console.c
+//
+// summary:	Console class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * Console.c
+ *
+ *
+ * |_______AVR maintenance console on the UART_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 19:41:12
+ *
+ * Filename: Console.c
+ * Controller: Atmega8/16/32/128
+ * Oscillator: 1 MHz
+ * Author: Mohammad Sadr
+ * Reference:Atmega32 dataSheet
+ *
+ * Note:
+ *
+ *		The echo is sent with UART_TxChar(): a received char sends 1 char, a backspace 3, the end of a line 2
+ *		and one more('?' or '!') for a bad line. Without UART_TxStart() each of them waits for UDR, so a
+ *		backspace or a line end waits up to 3 frames while the next chars are kept in the UART receive ring.
+ *		After UART_TxStart() the echo goes to the transmit ring and only waits when the ring is full.
+ *
+ */
+
+#include <avr/io.h>
+#include <avr/pgmspace.h>
+#include "UART.h"
+#include "Console.h"
+
+#define Backspace				0x08
+#define Delete					0x7f
+
+static char Line [ CONSOLE_LineSize ] ;
+static unsigned char Length ;
+static unsigned char Overflow ;			// Chars were dropped, the line is not run
+static unsigned char LastEnd ;			// Last end of line char, CR LF is one line
+static unsigned char Echo ;
+static const ConsoleCommand *Table ;
+
+/*
+ *
+ * Description  :This function selects the command table and clears the line.
+ * I/P Arguments: const ConsoleCommand*-->command table in flash(PROGMEM), ended by an empty name.
+ *		unsigned char-->1 to echo the received chars, 0 for none.
+ * Return value : none
+ *
+ */
+void CONSOLE_Init ( const ConsoleCommand *table , unsigned char echo )
+	{
+		Table = table ;
+		Echo = echo ;
+		Length = 0 ;
+		Overflow = 0 ;
+		LastEnd = 0 ;
+	}
+
+/* Splits the line into words and calls the handler of the first one */
+static void CONSOLE_Run ( )
+	{
+		char *argv [ CONSOLE_MaxArgs ] ;
+		unsigned char argc = 0 ;
+		char *p = Line ;
+		const ConsoleCommand *command ;
+		ConsoleHandler handler ;
+
+		while ( *p )
+			{
+				while ( *p == ' ' )
+					*p++ = 0 ;
+				if ( *p == 0 )
+					break ;
+				if ( argc == CONSOLE_MaxArgs )
+					{
+						UART_TxChar ( '?' ) ;		// Too many words
+						return ;
+					}
+				argv [ argc++ ] = p ;
+				while ( *p && *p != ' ' )
+					p++ ;
+			}
+		if ( argc == 0 )
+			return ;						// Only spaces
+
+		for ( command = Table ; command && pgm_read_byte ( command->name ) ; command++ )
+			if ( strcmp_P ( argv [ 0 ] , command->name ) == 0 )
+				{
+					handler = ( ConsoleHandler ) pgm_read_ptr ( &command->handler ) ;
+					handler ( argc , argv ) ;
+					return ;
+				}
+		UART_TxChar ( '?' ) ;
+	}
+
+/*
+ *
+ * Description  :This function adds one received char to the line.
+ *		At the end of a line the line is split into words and its command is called.
+ * I/P Arguments: char-->received char.
+ * Return value : unsigned char-->1 if the char ended a line, 0 if not.
+ *
+ */
+unsigned char CONSOLE_Feed ( char ch )
+	{
+		if ( ch == '\r' || ch == '\n' )
+			{
+				if ( LastEnd && LastEnd != ch )
+					{
+						LastEnd = 0 ;				// LF of CR LF
+						return 0 ;
+					}
+				LastEnd = ch ;
+				if ( Echo )
+					{
+						UART_TxChar ( '\r' ) ;
+						UART_TxChar ( '\n' ) ;
+					}
+				Line [ Length ] = 0 ;
+				if ( Overflow )
+					UART_TxChar ( '!' ) ;
+				else if ( Length )
+					CONSOLE_Run ( ) ;
+				Length = 0 ;
+				Overflow = 0 ;
+				return 1 ;
+			}
+		LastEnd = 0 ;
+
+		if ( ch == Backspace || ch == Delete )
+			{
+				if ( Length && ! Overflow )
+					{
+						Length-- ;
+						if ( Echo )
+							{
+								UART_TxChar ( Backspace ) ;
+								UART_TxChar ( ' ' ) ;
+								UART_TxChar ( Backspace ) ;
+							}
+					}
+				return 0 ;
+			}
+
+		if ( Length >= CONSOLE_LineSize - 1 )
+			{
+				Overflow = 1 ;
+				return 0 ;
+			}
+		Line [ Length++ ] = ch ;
+		if ( Echo )
+			UART_TxChar ( ch ) ;
+		return 0 ;
+	}
+
+/*
+ *
+ * Description  :This function feeds all the chars waiting in the UART ring, it does not wait.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void CONSOLE_Poll ( )
+	{
+		char ch ;
+
+		while ( UART_RxGet ( &ch ) )
+			CONSOLE_Feed ( ch ) ;
+	}
+
+/*
+ *
+ * Description  :This function converts a decimal or 0x hexadecimal word of a command to a number.
+ * I/P Arguments: const char*-->word, unsigned int*-->where the number is stored.
+ * Return value : unsigned char-->1 if the word is a number(0-65535), 0 if not.
+ *
+ */
+unsigned char CONSOLE_ArgNumber ( const char *arg , unsigned int *value )
+	{
+		unsigned long number = 0 ;
+		unsigned char base = 10 , digit ;
+
+		if ( arg [ 0 ] == '0' && ( arg [ 1 ] == 'x' || arg [ 1 ] == 'X' ) )
+			{
+				base = 16 ;
+				arg += 2 ;
+			}
+		if ( *arg == 0 )
+			return 0 ;
+		while ( *arg )
+			{
+				if ( *arg >= '0' && *arg <= '9' )
+					digit = *arg - '0' ;
+				else if ( base == 16 && ( *arg | 0x20 ) >= 'a' && ( *arg | 0x20 ) <= 'f' )
+					digit = ( *arg | 0x20 ) - 'a' + 10 ;
+				else
+					return 0 ;
+				number = number * base + digit ;
+				if ( number > 0xffff )
+					return 0 ;
+				arg++ ;
+			}
+		*value = number ;
+		return 1 ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Console.c
+////////////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -0,0 +1,110 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Console.h
+//
+// summary:	Declares the console class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * Console.h
+ *
+ *
+ * |_______AVR maintenance console on the UART_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 19:41:12
+ *
+ * Filename: Console.h
+ * Controller: Atmega8/16/32/128
+ * Oscillator: 1 MHz
+ * Author: Mohammad Sadr
+ * Reference:Atmega32 dataSheet
+ *
+ * Note:
+ *
+ *		The received chars are taken from the UART ring(UART_RxStart()) by CONSOLE_Poll(), which never waits
+ *		for input, so it can be called from the main loop or as a scheduler task.
+ *		A line ends with CR or LF(CR LF gives one line), backspace(0x08) or DEL(0x7f) removes the last char.
+ *		A line longer than CONSOLE_LineSize-1 chars is dropped as a whole and "!" is sent in place of it.
+ *		When echo is on each accepted char is sent back, backspace as "\b \b", the end of line as CR LF.
+ *		Start the transmit ring(UART_TxStart()) so the echo does not wait for the UART frames.
+ *
+ *		The line is split at the spaces into at most CONSOLE_MaxArgs words, the first one is looked up in a
+ *		command table in flash, which ends with an empty name. The handler gets the words like main(),
+ *		argv[0] is the command. An unknown command sends "?".
+ *	ex:
+ *		static void Led ( unsigned char argc , char **argv ) { ... }
+ *		static const ConsoleCommand Commands [ ] PROGMEM =
+ *			{
+ *				{ "led" , Led } ,
+ *				{ "" , 0 }
+ *			} ;
+ *
+ *		UART_Init ( ) ;
+ *		UART_RxStart ( ) ;
+ *		UART_TxStart ( ) ;
+ *		CONSOLE_Init ( Commands , 1 ) ;
+ *		SCHED_AddPeriodic ( CONSOLE_Poll , 10 , 0 ) ;
+ *
+ */
+
+#ifndef CONSOLE_H_
+#define CONSOLE_H_
+
+#define CONSOLE_LineSize		32			// Chars of a line with the NULL char
+#define CONSOLE_MaxArgs			6			// Words of a line with the command
+#define CONSOLE_NameSize		8			// Chars of a command name with the NULL char
+
+typedef void ( *ConsoleHandler ) ( unsigned char argc , char **argv ) ;
+
+typedef struct
+	{
+		char name [ CONSOLE_NameSize ] ;	// In the table, so strcmp_P() reads it from flash
+		ConsoleHandler handler ;
+	} ConsoleCommand ;
+
+/*
+ *
+ * Description  :This function selects the command table and clears the line.
+ * I/P Arguments: const ConsoleCommand*-->command table in flash(PROGMEM), ended by an empty name.
+ *		unsigned char-->1 to echo the received chars, 0 for none.
+ * Return value : none
+ *
+ */
+void CONSOLE_Init ( const ConsoleCommand *table , unsigned char echo ) ;
+
+/*
+ *
+ * Description  :This function adds one received char to the line.
+ *		At the end of a line the line is split into words and its command is called.
+ * I/P Arguments: char-->received char.
+ * Return value : unsigned char-->1 if the char ended a line, 0 if not.
+ *
+ */
+unsigned char CONSOLE_Feed ( char ch ) ;
+
+/*
+ *
+ * Description  :This function feeds all the chars waiting in the UART ring, it does not wait.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void CONSOLE_Poll ( ) ;
+
+/*
+ *
+ * Description  :This function converts a decimal or 0x hexadecimal word of a command to a number.
+ * I/P Arguments: const char*-->word, unsigned int*-->where the number is stored.
+ * Return value : unsigned char-->1 if the word is a number(0-65535), 0 if not.
+ *
+ */
+unsigned char CONSOLE_ArgNumber ( const char *arg , unsigned int *value ) ;
+
+#endif /* CONSOLE_H_ */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Console.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -0,0 +1,98 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Coroutine.h
+//
+// summary:	Declares the coroutine class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * Coroutine.h
+ *
+ *
+ * |_______AVR stackless coroutine library_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 15:12:40
+ *
+ * Filename: Coroutine.h
+ * Controller: Atmega8/16/32/128
+ * Oscillator: 1 MHz
+ * Author: Mohammad Sadr
+ *
+ * Note:
+ *
+ *		A coroutine is a normal function which returns CO_Waiting when it has to wait and CO_Done when
+ *		it is finished. The caller keeps calling it(ex: from a scheduler task) till it returns CO_Done.
+ *		The line to continue from is kept in a Coroutine variable, so no stack is needed per coroutine:
+ *		each one costs sizeof(Coroutine) = 5 bytes of RAM.
+ *
+ *		The macros are built on a switch statement(like protothreads), so:
+ *			1- Local variables are lost at every wait, keep them static or in the Coroutine step field.
+ *			2- A switch statement must not contain a wait macro.
+ *			3- Only one wait macro per source line.
+ *
+ *	ex:
+ *		char BlinkCo ( Coroutine *co )
+ *			{
+ *				CO_Begin ( co ) ;
+ *				for ( co->step = 0 ; co->step < 10 ; co->step++ )
+ *					{
+ *						PORTA ^= 0x01 ;
+ *						CO_Delay ( co , 100 ) ;
+ *					}
+ *				CO_End ( co ) ;
+ *			}
+ *
+ *		static Coroutine blink ;
+ *		CO_Init ( &blink ) ;
+ *		while ( BlinkCo ( &blink ) == CO_Waiting )
+ *			SCHED_Run ( ) ;
+ *
+ */
+
+#ifndef COROUTINE_H_
+#define COROUTINE_H_
+
+#include "Scheduler.h"
+
+#define CO_Waiting				0			// Returned while the coroutine is waiting
+#define CO_Done					1			// Returned once the coroutine has finished
+
+typedef struct
+	{
+		unsigned int line ;			// Source line to continue from, 0 to start from the beginning
+		unsigned int time ;			// Start time of CO_Delay()
+		unsigned char step ;		// Loop counter which is kept across the waits
+	} Coroutine ;
+
+/* Prepares the coroutine to run from the beginning */
+#define CO_Init( co )				do { ( co )->line = 0 ; } while ( 0 )
+
+/* First statement of the coroutine function */
+#define CO_Begin( co )				switch ( ( co )->line ) { case 0 :
+
+/* Last statement of the coroutine function, the coroutine can be called again to run from the beginning */
+#define CO_End( co )				} ( co )->line = 0 ; return CO_Done
+
+/* Returns CO_Waiting till the condition is true */
+#define CO_WaitUntil( co , cond )	do { ( co )->line = __LINE__ ; case __LINE__ : if ( ! ( cond ) ) return CO_Waiting ; } while ( 0 )
+
+/* Returns CO_Waiting once, the coroutine continues on the next call */
+#define CO_Yield( co )				do { ( co )->line = __LINE__ ; return CO_Waiting ; case __LINE__ : ; } while ( 0 )
+
+/* Waits for at least ms-1 ms(the ms tick of the scheduler is used) */
+#define CO_Delay( co , ms )			do { ( co )->time = SCHED_Millis ( ) ; CO_WaitUntil ( co , SCHED_Elapsed ( ( co )->time , ( ms ) ) ) ; } while ( 0 )
+
+/* Runs another coroutine till it is done, child_call is ex: LCD_InitCo ( &lcd_co ) */
+#define CO_Call( co , child_call )	CO_WaitUntil ( co , ( child_call ) == CO_Done )
+
+/* Ends the coroutine before CO_End() */
+#define CO_Exit( co )				do { ( co )->line = 0 ; return CO_Done ; } while ( 0 )
+
+#endif /* COROUTINE_H_ */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Coroutine.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
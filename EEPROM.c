@@ -28,6 +28,8 @@
 #include <avr/io.h>
 #include "Configuration.h"
 #include <util/delay.h>
+#include "EEPROM.h"
+#include "Profile.h"
 
 /*
  *
@@ -51,6 +53,8 @@
  */
 void EEPROM_WriteByte ( unsigned int eeprom_Address , unsigned char eeprom_Data )
 	{
+		PROFILE_Begin ( ) ;
+
 		while ( EECR & ( 1 << EEWE ) ) ;   // Wait for completion of previous write, EEWE will be
 		// cleared by hardware once Eeprom write is completed
 
@@ -60,6 +64,7 @@ void EEPROM_WriteByte ( unsigned int eeprom_Address , unsigned char eeprom_Data
 		EECR |= ( 1 << EEMWE ) ;    // Write logical one to EEMWE
 
 		EECR |= ( 1 << EEWE ) ;     // Start eeprom write by setting EEWE
+		PROFILE_End ( PROFILE_EepromWrite ) ;
 	}
 
 /*
@@ -112,6 +117,32 @@ void EEPROM_WriteNBytes ( unsigned int EepromAddr , unsigned char *RamAddr , cha
 			}
 	}
 
+/*
+ *
+ * Description: This function writes N-bytes of data at specified EEPROM_address like EEPROM_WriteNBytes(), as a coroutine.
+ *		Each byte takes about 8.5ms to be written, the coroutine returns CO_Waiting instead of waiting for EEWE,
+ *		so other tasks run meanwhile. It must be called with the same arguments till it returns CO_Done.
+ *		The last byte may still be in progress after CO_Done, the next EEPROM access waits for it.
+ * I/P Arguments:
+ *		1- Coroutine*-->coroutine state.
+ *		2- int,-->eeprom_address from where the N-bytes are to be written.
+ *		3- char*-->Pointer to the N-bytes of data to be written.
+ *		4- char --> Number of bytes to be written
+ *
+ * Return value : char-->CO_Waiting or CO_Done.
+ *
+ */
+char EEPROM_WriteNBytesCo ( Coroutine *co , unsigned int EepromAddr , unsigned char *RamAddr , char NoOfBytes )
+	{
+		CO_Begin ( co ) ;
+		for ( co->step = 0 ; co->step < ( unsigned char ) NoOfBytes ; co->step++ )
+			{
+				CO_WaitUntil ( co , ! ( EECR & ( 1 << EEWE ) ) ) ;	// Yield till the previous write is completed
+				EEPROM_WriteByte ( EepromAddr + co->step , RamAddr [ co->step ] ) ;
+			}
+		CO_End ( co ) ;
+	}
+
 /*
  *
  * Description: This function is used to Read N-bytes of data from specified EEPROM_address.
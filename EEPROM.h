@@ -29,6 +29,8 @@
 #ifndef EEPROM_H_
 #define EEPROM_H_
 
+#include "Coroutine.h"
+
 /*
  *
  * Description:This function is used to write the data at specified EEPROM_address.
@@ -74,6 +76,23 @@ unsigned char EEPROM_ReadByte ( unsigned int eeprom_Address ) ;
  */
 void EEPROM_WriteNBytes ( unsigned int EepromAddr , unsigned char *RamAddr , char NoOfBytes ) ;
 
+/*
+ *
+ * Description: This function writes N-bytes of data at specified EEPROM_address like EEPROM_WriteNBytes(), as a coroutine.
+ *		Each byte takes about 8.5ms to be written, the coroutine returns CO_Waiting instead of waiting for EEWE,
+ *		so other tasks run meanwhile. It must be called with the same arguments till it returns CO_Done.
+ *		The last byte may still be in progress after CO_Done, the next EEPROM access waits for it.
+ * I/P Arguments:
+ *		1- Coroutine*-->coroutine state.
+ *		2- int,-->eeprom_address from where the N-bytes are to be written.
+ *		3- char*-->Pointer to the N-bytes of data to be written.
+ *		4- char --> Number of bytes to be written
+ *
+ * Return value : char-->CO_Waiting or CO_Done.
+ *
+ */
+char EEPROM_WriteNBytesCo ( Coroutine *co , unsigned int EepromAddr , unsigned char *RamAddr , char NoOfBytes ) ;
+
 /*
  *
  * Description: This function is used to Read N-bytes of data from specified EEPROM_address.
@@ -0,0 +1,159 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\EEPROM_24Cxx.c
+//
+// summary:	24Cxx EEPROM class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * EEPROM_24Cxx.c
+ *
+ *
+ * |_______AVR library for the 24C32-24C256 I2C EEPROMs_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 21:05:13
+ *
+ * Filename: EEPROM_24Cxx.c
+ * Controller: Atmega8/16/32/128
+ * Oscillator: 1 MHz
+ * Author: Mohammad Sadr
+ * Reference:AT24C32/AT24C256 dataSheets
+ *
+ * Note:
+ *
+ *		Write: Start, id+W, address high, address low, up to one page of data, Stop(starts the write cycle).
+ *		Read: Start, id+W, address high, address low, repeated Start, id+R, data(ACK) ... last data(NACK), Stop.
+ *		The bytes of a page write which pass the end of the page wrap to its start in the EEPROM,
+ *		so the transfers never cross a page boundary.
+ *
+ */
+
+#include <avr/io.h>
+#include "Configuration.h"
+#include "I2C.h"
+#include "EEPROM_24Cxx.h"
+
+/* Sends the id+W till the EEPROM answers(ACK polling) and the address, the bus is left owned */
+static unsigned char AT24C_Select ( unsigned int address )
+	{
+		unsigned char tries ;
+
+		for ( tries = 0 ; tries < AT24C_PollLimit ; tries++ )
+			{
+				I2C_Start ( ) ;
+				I2C_Write ( AT24C_Id ) ;
+				if ( I2C_Status ( ) == I2C_SlaWAck )
+					{
+						I2C_Write ( address >> 8 ) ;
+						I2C_Write ( address & 0xff ) ;
+						return I2C_Status ( ) == I2C_DataWAck ;
+					}
+				I2C_Stop ( ) ;				// Write cycle in progress
+			}
+		return 0 ;
+	}
+
+/*
+ *
+ * Description  :This function writes one byte at the given address, it returns once the EEPROM has the byte,
+ *		the write cycle runs on in the EEPROM.
+ * I/P Arguments: unsigned int-->EEPROM address, unsigned char-->data.
+ * Return value : unsigned char-->1 if written, 0 if the EEPROM did not answer.
+ *
+ */
+unsigned char AT24C_WriteByte ( unsigned int eeprom_Address , unsigned char eeprom_Data )
+	{
+		return AT24C_WriteNBytes ( eeprom_Address , &eeprom_Data , 1 ) ;
+	}
+
+/*
+ *
+ * Description  :This function reads one byte from the given address.
+ * I/P Arguments: unsigned int-->EEPROM address.
+ * Return value : unsigned char-->data, 0xFF if the EEPROM did not answer.
+ *
+ */
+unsigned char AT24C_ReadByte ( unsigned int eeprom_Address )
+	{
+		unsigned char data ;
+
+		if ( ! AT24C_ReadNBytes ( eeprom_Address , &data , 1 ) )
+			data = 0xff ;
+		return data ;
+	}
+
+/*
+ *
+ * Description  :This function writes N-bytes at the given address with one page write per page.
+ * I/P Arguments:
+ *		1- int,-->eeprom_address from where the N-bytes are to be written.
+ *		2- char*-->Pointer to the N-bytes of data to be written.
+ *		3- int --> Number of bytes to be written
+ *
+ * Return value : unsigned char-->1 if written, 0 if the EEPROM did not answer or refused a byte.
+ *
+ */
+unsigned char AT24C_WriteNBytes ( unsigned int EepromAddr , unsigned char *RamAddr , unsigned int NoOfBytes )
+	{
+		unsigned char count , ok = 1 ;
+
+		while ( NoOfBytes != 0 && ok )
+			{
+				count = AT24C_PageSize - ( EepromAddr & ( AT24C_PageSize - 1 ) ) ;	// Bytes left in the page
+				if ( count > NoOfBytes )
+					count = NoOfBytes ;
+
+				ok = AT24C_Select ( EepromAddr ) ;
+				EepromAddr += count ;
+				NoOfBytes -= count ;
+				for ( ; count != 0 && ok ; count-- )
+					{
+						I2C_Write ( *RamAddr++ ) ;
+						ok = I2C_Status ( ) == I2C_DataWAck ;
+					}
+				I2C_Stop ( ) ;				// Starts the write cycle of the page
+			}
+		return ok ;
+	}
+
+/*
+ *
+ * Description  :This function reads N-bytes from the given address in one transfer(sequential read).
+ * I/P Arguments:
+ *		1- int,-->eeprom_address from where the N-bytes is to be read.
+ *		2- char*-->Pointer into which the N-bytes of data is to be read.
+ *		3- int --> Number of bytes to be Read
+ *
+ * Return value : unsigned char-->1 if read, 0 if the EEPROM did not answer.
+ *
+ */
+unsigned char AT24C_ReadNBytes ( unsigned int EepromAddr , unsigned char *RamAddr , unsigned int NoOfBytes )
+	{
+		if ( NoOfBytes == 0 )
+			return 1 ;
+		if ( ! AT24C_Select ( EepromAddr ) )
+			{
+				I2C_Stop ( ) ;
+				return 0 ;
+			}
+
+		I2C_Start ( ) ;						// Repeated Start
+		I2C_Write ( AT24C_Id | 0x01 ) ;
+		if ( I2C_Status ( ) != I2C_SlaRAck )
+			{
+				I2C_Stop ( ) ;
+				return 0 ;
+			}
+		while ( --NoOfBytes != 0 )
+			*RamAddr++ = I2C_Read ( 1 ) ;	// ACK, the EEPROM sends the next byte
+		*RamAddr = I2C_Read ( 0 ) ;			// NACK on the last byte
+		I2C_Stop ( ) ;
+		return 1 ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\EEPROM_24Cxx.c
+////////////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
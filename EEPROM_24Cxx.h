@@ -0,0 +1,105 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\EEPROM_24Cxx.h
+//
+// summary:	Declares the 24Cxx EEPROM class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * EEPROM_24Cxx.h
+ *
+ *
+ * |_______AVR library for the 24C32-24C256 I2C EEPROMs_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 21:05:13
+ *
+ * Filename: EEPROM_24Cxx.h
+ * Controller: Atmega8/16/32/128
+ * Oscillator: 1 MHz
+ * Author: Mohammad Sadr
+ * Reference:AT24C32/AT24C256 dataSheets
+ *
+ * Note:
+ *
+ *		The EEPROM writes a whole page in one write cycle(5-10ms), so AT24C_WriteNBytes() sends up to
+ *		AT24C_PageSize bytes per transfer, split at the page boundaries. During the write cycle the EEPROM
+ *		does not answer its address: the next access sends the address till it is acknowledged(ACK polling)
+ *		instead of waiting for the longest write time.
+ *		AT24C_ReadNBytes() reads any number of bytes in one transfer, the address counts on over the pages.
+ *		The SCL clock sets the write speed: with I2C_Init() at 8MHz(about 51kHz) a page of 32 bytes takes
+ *		about 11ms(0.35ms per byte), at 100kHz about 8ms(0.26ms per byte), where EEPROM.c takes 8.5ms per byte.
+ *		Page size and memory size: 24C32/24C64 -> 32 bytes, 4/8 KB, 24C128/24C256 -> 64 bytes, 16/32 KB,
+ *		give them with -D or here. The address pins A2-A0 are connected to ground.
+ *	ex:
+ *		I2C_Init ( ) ;
+ *		AT24C_WriteNBytes ( 0x0100 , log , sizeof ( log ) ) ;
+ *		AT24C_ReadNBytes ( 0x0100 , log , sizeof ( log ) ) ;
+ *
+ */
+
+#ifndef EEPROM_24CXX_H_
+#define EEPROM_24CXX_H_
+
+#ifndef AT24C_PageSize
+#define AT24C_PageSize			32			// Bytes of one page write, 32 for the 24C32, 64 for the 24C256
+#endif
+#ifndef AT24C_MemorySize
+#define AT24C_MemorySize		4096UL		// Bytes of the EEPROM, 4096 for the 24C32, 32768 for the 24C256
+#endif
+
+#define AT24C_Id				0xA0		// 1010 A2 A1 A0 R/W
+#define AT24C_PollLimit			100			// Address sent at most this many times while a write cycle runs
+
+/*
+ *
+ * Description  :This function writes one byte at the given address, it returns once the EEPROM has the byte,
+ *		the write cycle runs on in the EEPROM.
+ * I/P Arguments: unsigned int-->EEPROM address, unsigned char-->data.
+ * Return value : unsigned char-->1 if written, 0 if the EEPROM did not answer.
+ *
+ */
+unsigned char AT24C_WriteByte ( unsigned int eeprom_Address , unsigned char eeprom_Data ) ;
+
+/*
+ *
+ * Description  :This function reads one byte from the given address.
+ * I/P Arguments: unsigned int-->EEPROM address.
+ * Return value : unsigned char-->data, 0xFF if the EEPROM did not answer.
+ *
+ */
+unsigned char AT24C_ReadByte ( unsigned int eeprom_Address ) ;
+
+/*
+ *
+ * Description  :This function writes N-bytes at the given address with one page write per page.
+ * I/P Arguments:
+ *		1- int,-->eeprom_address from where the N-bytes are to be written.
+ *		2- char*-->Pointer to the N-bytes of data to be written.
+ *		3- int --> Number of bytes to be written
+ *
+ * Return value : unsigned char-->1 if written, 0 if the EEPROM did not answer or refused a byte.
+ *
+ */
+unsigned char AT24C_WriteNBytes ( unsigned int EepromAddr , unsigned char *RamAddr , unsigned int NoOfBytes ) ;
+
+/*
+ *
+ * Description  :This function reads N-bytes from the given address in one transfer(sequential read).
+ * I/P Arguments:
+ *		1- int,-->eeprom_address from where the N-bytes is to be read.
+ *		2- char*-->Pointer into which the N-bytes of data is to be read.
+ *		3- int --> Number of bytes to be Read
+ *
+ * Return value : unsigned char-->1 if read, 0 if the EEPROM did not answer.
+ *
+ */
+unsigned char AT24C_ReadNBytes ( unsigned int EepromAddr , unsigned char *RamAddr , unsigned int NoOfBytes ) ;
+
+#endif /* EEPROM_24CXX_H_ */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\EEPROM_24Cxx.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
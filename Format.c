@@ -0,0 +1,254 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Format.c
+//
+// summary:	Number format class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * Format.c
+ *
+ *
+ * |_______AVR number to ASCII format library_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 10:02:31
+ *
+ * Filename: Format.c
+ * Controller: Atmega8/16/32/128
+ * Oscillator: 1 MHz
+ * Author: Mohammad Sadr
+ *
+ * Note:
+ *
+ *		Each digit is found by subtracting its power of ten till the number gets smaller(at most 9 times).
+ *		A 16-bit number costs at most 36 subtractions, compared to the five 16-bit divisions
+ *		and five modulos of the old LCD_DisplayNumber()/UART_TxNumber().
+ *		32-bit numbers which fit in 16 bits are converted with the 16-bit table.
+ *
+ */
+
+#include <avr/io.h>
+#include <avr/pgmspace.h>
+#include "Configuration.h"
+#include "Format.h"
+
+#define MaxDigits32		10		// 4294967295
+
+static const unsigned int PowersOfTen16 [ ] PROGMEM = { 10000 , 1000 , 100 , 10 } ;
+
+static const unsigned long PowersOfTen32 [ ] PROGMEM =
+	{
+		1000000000UL , 100000000UL , 10000000UL , 1000000UL , 100000UL
+	} ;
+
+/*
+ *
+ * Description  :This function writes the digits of a 16-bit number without leading zeros.
+ * I/P Arguments: char*-->digit buffer, unsigned int-->number.
+ * Return value : unsigned char-->number of digits(1-5).
+ *
+ */
+static unsigned char FORMAT_Digits16 ( char *digits , unsigned int num )
+	{
+		unsigned char i , len = 0 ;
+		unsigned int power ;
+		char digit ;
+
+		for ( i = 0 ; i < sizeof ( PowersOfTen16 ) / sizeof ( PowersOfTen16 [ 0 ] ) ; i++ )
+			{
+				power = pgm_read_word ( &PowersOfTen16 [ i ] ) ;
+				digit = '0' ;
+				while ( num >= power )		// Subtract the power of ten till the number gets smaller
+					{
+						num -= power ;
+						digit++ ;
+					}
+				if ( len || ( digit != '0' ) )	// Skip the leading zeros
+					digits [ len++ ] = digit ;
+			}
+		digits [ len++ ] = num + '0' ;		// Units are left in num
+		return len ;
+	}
+
+/*
+ *
+ * Description  :This function writes the digits of a 32-bit number without leading zeros.
+ *		The upper five digits are found with the 32-bit table, the lower ones with the 16-bit table.
+ * I/P Arguments: char*-->digit buffer, unsigned long-->number.
+ * Return value : unsigned char-->number of digits(1-10).
+ *
+ */
+static unsigned char FORMAT_Digits32 ( char *digits , unsigned long num )
+	{
+		unsigned char i , len = 0 ;
+		unsigned long power ;
+		char digit ;
+
+		if ( num <= 0xffff )
+			return FORMAT_Digits16 ( digits , ( unsigned int ) num ) ;
+
+		for ( i = 0 ; i < sizeof ( PowersOfTen32 ) / sizeof ( PowersOfTen32 [ 0 ] ) ; i++ )
+			{
+				power = pgm_read_dword ( &PowersOfTen32 [ i ] ) ;
+				digit = '0' ;
+				while ( num >= power )
+					{
+						num -= power ;
+						digit++ ;
+					}
+				if ( len || ( digit != '0' ) )
+					digits [ len++ ] = digit ;
+			}
+
+		// num < 100000 now, the lower five digits are always written(with zeros)
+		for ( i = 0 ; i < 4 ; i++ )
+			{
+				power = pgm_read_word ( &PowersOfTen16 [ i ] ) ;
+				digit = '0' ;
+				while ( num >= power )
+					{
+						num -= power ;
+						digit++ ;
+					}
+				digits [ len++ ] = digit ;
+			}
+		digits [ len++ ] = ( char ) num + '0' ;
+		return len ;
+	}
+
+/*
+ *
+ * Description  :This function copies sign, padding and digits into the caller buffer.
+ *		With '0' padding the sign is written first, with any other pad char it is written next to the digits.
+ * I/P Arguments: char*-->buffer, char*-->digits, unsigned char-->number of digits,
+ *		char-->sign('-' or 0), unsigned char-->width, char-->pad.
+ * Return value : unsigned char-->number of chars written(without NULL char).
+ *
+ */
+static unsigned char FORMAT_Build ( char *buf , const char *digits , unsigned char len , char sign , unsigned char width , char pad )
+	{
+		unsigned char fill = 0 , i = 0 ;
+
+		if ( width > ( len + ( sign != 0 ) ) )
+			fill = width - len - ( sign != 0 ) ;
+
+		if ( sign && ( pad == '0' ) )
+			buf [ i++ ] = sign ;
+
+		while ( fill-- )
+			buf [ i++ ] = pad ;
+
+		if ( sign && ( pad != '0' ) )
+			buf [ i++ ] = sign ;
+
+		while ( len-- )
+			buf [ i++ ] = *digits++ ;
+
+		buf [ i ] = 0 ;		// NULL terminate the string
+		return i ;
+	}
+
+/*
+ *
+ * Description  :This function converts a 16-bit unsigned integer(0-65535) to ASCII.
+ *	ex:
+ *		1- FORMAT_Unsigned(buf,123,5,'0') gives "00123".
+ *		2- FORMAT_Unsigned(buf,123,0,' ') gives "123".
+ * I/P Arguments: char*-->buffer, unsigned int-->number, unsigned char-->width, char-->pad.
+ * Return value : unsigned char-->number of chars written(without NULL char).
+ *
+ */
+unsigned char FORMAT_Unsigned ( char *buf , unsigned int num , unsigned char width , char pad )
+	{
+		char digits [ MaxDigits32 ] ;
+		unsigned char len = FORMAT_Digits16 ( digits , num ) ;
+		return FORMAT_Build ( buf , digits , len , 0 , width , pad ) ;
+	}
+
+/*
+ *
+ * Description  :This function converts a 16-bit signed integer(-32768 to 32767) to ASCII.
+ * I/P Arguments: char*-->buffer, int-->number, unsigned char-->width, char-->pad.
+ * Return value : unsigned char-->number of chars written(without NULL char).
+ *
+ */
+unsigned char FORMAT_Signed ( char *buf , int num , unsigned char width , char pad )
+	{
+		char digits [ MaxDigits32 ] ;
+		unsigned int magnitude = ( num < 0 ) ? 0u - ( unsigned int ) num : ( unsigned int ) num ;
+		unsigned char len = FORMAT_Digits16 ( digits , magnitude ) ;
+		return FORMAT_Build ( buf , digits , len , ( num < 0 ) ? '-' : 0 , width , pad ) ;
+	}
+
+/*
+ *
+ * Description  :This function converts a 32-bit unsigned integer(0-4294967295) to ASCII.
+ * I/P Arguments: char*-->buffer, unsigned long-->number, unsigned char-->width, char-->pad.
+ * Return value : unsigned char-->number of chars written(without NULL char).
+ *
+ */
+unsigned char FORMAT_Unsigned32 ( char *buf , unsigned long num , unsigned char width , char pad )
+	{
+		char digits [ MaxDigits32 ] ;
+		unsigned char len = FORMAT_Digits32 ( digits , num ) ;
+		return FORMAT_Build ( buf , digits , len , 0 , width , pad ) ;
+	}
+
+/*
+ *
+ * Description  :This function converts a 32-bit signed integer to ASCII.
+ * I/P Arguments: char*-->buffer, long-->number, unsigned char-->width, char-->pad.
+ * Return value : unsigned char-->number of chars written(without NULL char).
+ *
+ */
+unsigned char FORMAT_Signed32 ( char *buf , long num , unsigned char width , char pad )
+	{
+		char digits [ MaxDigits32 ] ;
+		unsigned long magnitude = ( num < 0 ) ? 0UL - ( unsigned long ) num : ( unsigned long ) num ;
+		unsigned char len = FORMAT_Digits32 ( digits , magnitude ) ;
+		return FORMAT_Build ( buf , digits , len , ( num < 0 ) ? '-' : 0 , width , pad ) ;
+	}
+
+/*
+ *
+ * Description  :This function converts a fixed-point value to ASCII with a decimal point.
+ *		The value is the real value multiplied by 10^decimals.
+ *	ex:
+ *		1- FORMAT_Fixed(buf,2531,1,0,' ') gives "253.1"  (ex: LM35 reading in 0.1 degree)
+ *		2- FORMAT_Fixed(buf,-5,2,6,' ') gives " -0.05"
+ * I/P Arguments: char*-->buffer, long-->scaled value, unsigned char-->decimals(0-9), unsigned char-->width, char-->pad.
+ * Return value : unsigned char-->number of chars written(without NULL char).
+ *
+ */
+unsigned char FORMAT_Fixed ( char *buf , long num , unsigned char decimals , unsigned char width , char pad )
+	{
+		char digits [ MaxDigits32 ] , fixed [ FORMAT_BufferSize ] ;
+		unsigned long magnitude = ( num < 0 ) ? 0UL - ( unsigned long ) num : ( unsigned long ) num ;
+		unsigned char len = FORMAT_Digits32 ( digits , magnitude ) , i = 0 , j = 0 ;
+
+		if ( decimals >= MaxDigits32 )
+			decimals = MaxDigits32 - 1 ;
+
+		while ( ( len + i ) <= decimals )	// At least one digit before the decimal point(ex: 0.05)
+			fixed [ i++ ] = '0' ;
+
+		while ( j < len )
+			fixed [ i++ ] = digits [ j++ ] ;
+
+		if ( decimals )
+			{
+				for ( j = i ; j > i - decimals ; j-- )	// Shift the fraction one place to the right
+					fixed [ j ] = fixed [ j - 1 ] ;
+				fixed [ i - decimals ] = '.' ;
+				i++ ;
+			}
+
+		return FORMAT_Build ( buf , fixed , i , ( num < 0 ) ? '-' : 0 , width , pad ) ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Format.c
+////////////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -0,0 +1,96 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Format.h
+//
+// summary:	Declares the number format class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * Format.h
+ *
+ *
+ * |_______AVR number to ASCII format library_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 10:02:31
+ *
+ * Filename: Format.h
+ * Controller: Atmega8/16/32/128
+ * Oscillator: 1 MHz
+ * Author: Mohammad Sadr
+ *
+ * Note:
+ *
+ *		All functions write a NULL terminated string into the caller buffer and return its length.
+ *		Digits are found by subtracting powers of ten, so no division is used(AVR has no divide instruction).
+ *		The buffer must hold at least FORMAT_BufferSize bytes, or width+1 bytes if width is bigger.
+ *
+ *		width -> minimum number of chars, the number is right aligned and filled with pad on the left.
+ *		pad   -> '0' or ' ', with '0' the sign is placed before the zeros(ex: -0012).
+ *
+ */
+
+#ifndef FORMAT_H_
+#define FORMAT_H_
+
+#define FORMAT_BufferSize		13		// Sign + 10 digits + decimal point + NULL char
+
+/*
+ *
+ * Description  :This function converts a 16-bit unsigned integer(0-65535) to ASCII.
+ *	ex:
+ *		1- FORMAT_Unsigned(buf,123,5,'0') gives "00123".
+ *		2- FORMAT_Unsigned(buf,123,0,' ') gives "123".
+ * I/P Arguments: char*-->buffer, unsigned int-->number, unsigned char-->width, char-->pad.
+ * Return value : unsigned char-->number of chars written(without NULL char).
+ *
+ */
+unsigned char FORMAT_Unsigned ( char *buf , unsigned int num , unsigned char width , char pad ) ;
+
+/*
+ *
+ * Description  :This function converts a 16-bit signed integer(-32768 to 32767) to ASCII.
+ * I/P Arguments: char*-->buffer, int-->number, unsigned char-->width, char-->pad.
+ * Return value : unsigned char-->number of chars written(without NULL char).
+ *
+ */
+unsigned char FORMAT_Signed ( char *buf , int num , unsigned char width , char pad ) ;
+
+/*
+ *
+ * Description  :This function converts a 32-bit unsigned integer(0-4294967295) to ASCII.
+ * I/P Arguments: char*-->buffer, unsigned long-->number, unsigned char-->width, char-->pad.
+ * Return value : unsigned char-->number of chars written(without NULL char).
+ *
+ */
+unsigned char FORMAT_Unsigned32 ( char *buf , unsigned long num , unsigned char width , char pad ) ;
+
+/*
+ *
+ * Description  :This function converts a 32-bit signed integer to ASCII.
+ * I/P Arguments: char*-->buffer, long-->number, unsigned char-->width, char-->pad.
+ * Return value : unsigned char-->number of chars written(without NULL char).
+ *
+ */
+unsigned char FORMAT_Signed32 ( char *buf , long num , unsigned char width , char pad ) ;
+
+/*
+ *
+ * Description  :This function converts a fixed-point value to ASCII with a decimal point.
+ *		The value is the real value multiplied by 10^decimals.
+ *	ex:
+ *		1- FORMAT_Fixed(buf,2531,1,0,' ') gives "253.1"  (ex: LM35 reading in 0.1 degree)
+ *		2- FORMAT_Fixed(buf,-5,2,6,' ') gives " -0.05"
+ * I/P Arguments: char*-->buffer, long-->scaled value, unsigned char-->decimals(0-9), unsigned char-->width, char-->pad.
+ * Return value : unsigned char-->number of chars written(without NULL char).
+ *
+ */
+unsigned char FORMAT_Fixed ( char *buf , long num , unsigned char decimals , unsigned char width , char pad ) ;
+
+#endif /* FORMAT_H_ */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Format.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -29,6 +29,8 @@
 #include "Configuration.h"
 #include <util/delay.h>
 #include "I2C.h"
+#include "Profile.h"
+#include "Trace.h"
 
 /*
  *
@@ -54,8 +56,11 @@ void I2C_Init ( )
  */
 void I2C_Start ( )
 	{
-		TWCR = ( ( 1 << TWINT ) | ( 1 << TWSTA ) | ( 1 << TWEN ) ) ;
-		while ( ! ( TWCR & ( 1 << TWINT ) ) ) ;
+		PROFILE_Begin ( ) ;
+
+		I2C_StartNoWait ( ) ;
+		while ( ! I2C_Ready ( ) ) ;
+		PROFILE_End ( PROFILE_I2C ) ;
 	}
 
 /*
@@ -68,8 +73,11 @@ void I2C_Start ( )
  */
 void I2C_Stop ( )
 	{
-		TWCR = ( (1 << TWINT ) | ( 1 << TWEN ) | ( 1 << TWSTO ) ) ;
+		PROFILE_Begin ( ) ;
+
+		I2C_StopNoWait ( ) ;
 		_delay_us ( 10 ) ; //wait for a short time
+		PROFILE_End ( PROFILE_I2C ) ;
 	}
 
 /*
@@ -84,9 +92,13 @@ void I2C_Stop ( )
  */
 void I2C_Write ( unsigned char dat )
 	{
-		TWDR = dat ;
-		TWCR = ( ( 1 << TWINT ) | ( 1 << TWEN ) ) ;
-		while ( ! ( TWCR & ( 1 << TWINT ) ) ) ;
+		PROFILE_Begin ( ) ;
+
+		TRACE_On ( TRACE_PinI2cWrite ) ;
+		I2C_WriteNoWait ( dat ) ;
+		while ( ! I2C_Ready ( ) ) ;
+		TRACE_Off ( TRACE_PinI2cWrite ) ;
+		PROFILE_End ( PROFILE_I2C ) ;
 	}
 
 /*
@@ -99,12 +111,285 @@ void I2C_Write ( unsigned char dat )
  *
  */
 unsigned char I2C_Read ( unsigned char ack )
+	{
+		unsigned char dat ;
+		PROFILE_Begin ( ) ;
+
+		I2C_ReadNoWait ( ack ) ;
+		while ( ! I2C_Ready ( ) ) ;
+		dat = I2C_Data ( ) ;
+		PROFILE_End ( PROFILE_I2C ) ;
+		return dat ;
+	}
+
+/*
+ *
+ * Description  :This function starts the I2C Start Condition and returns without waiting.
+ *		I2C_Ready() returns 1 once the Start Condition is sent.
+ * I/P Arguments: none
+ * Return value: none
+ *
+ */
+void I2C_StartNoWait ( )
+	{
+		TWCR = ( ( 1 << TWINT ) | ( 1 << TWSTA ) | ( 1 << TWEN ) ) ;
+	}
+
+/*
+ *
+ * Description  :This function starts the I2C Stop Condition and returns without waiting.
+ *		I2C_Stopped() returns 1 once the Stop Condition is sent.
+ * I/P Arguments: none
+ * Return value: none
+ *
+ */
+void I2C_StopNoWait ( )
+	{
+		TWCR = ( (1 << TWINT ) | ( 1 << TWEN ) | ( 1 << TWSTO ) ) ;
+	}
+
+/*
+ *
+ * Description  :This function starts sending a byte and returns without waiting.
+ *		I2C_Ready() returns 1 once the byte is sent.
+ * I/P Arguments: unsigned char-->8bit data to be sent.
+ * Return value: none
+ *
+ */
+void I2C_WriteNoWait ( unsigned char dat )
+	{
+		TWDR = dat ;
+		TWCR = ( ( 1 << TWINT ) | ( 1 << TWEN ) ) ;
+	}
+
+/*
+ *
+ * Description  :This function starts receiving a byte and returns without waiting.
+ *		I2C_Ready() returns 1 once the byte is received, then it is read with I2C_Data().
+ * I/P Arguments: char: Acknowledgment for the Ninth clock cycle.
+ * Return value: none
+ *
+ */
+void I2C_ReadNoWait ( unsigned char ack )
 	{
 		TWCR = ( ( 1 << TWINT ) | ( 1 << TWEN ) | ( ack << TWEA ) ) ;
-		while ( ! ( TWCR & ( 1 << TWINT ) ) ) ;
+	}
+
+/*
+ *
+ * Description  :This function checks whether the last Start, Write or Read is finished(TWINT is set).
+ * I/P Arguments: none
+ * Return value: unsigned char-->1 if finished, 0 otherwise.
+ *
+ */
+unsigned char I2C_Ready ( )
+	{
+		return ( TWCR & ( 1 << TWINT ) ) != 0 ;
+	}
+
+/*
+ *
+ * Description  :This function checks whether the last Stop Condition is sent(TWSTO is cleared by hardware).
+ * I/P Arguments: none
+ * Return value: unsigned char-->1 if sent, 0 otherwise.
+ *
+ */
+unsigned char I2C_Stopped ( )
+	{
+		return ( TWCR & ( 1 << TWSTO ) ) == 0 ;
+	}
+
+/*
+ *
+ * Description  :This function returns the byte received by I2C_ReadNoWait().
+ * I/P Arguments: none
+ * Return value : Unsigned char(received byte)
+ *
+ */
+unsigned char I2C_Data ( )
+	{
 		return TWDR ;
 	}
 
+/*
+ *
+ * Description  :This function returns the status of the last Start, Write or Read(TWSR without the prescaler bits),
+ *		ex: I2C_SlaWAck after the address of a slave which answered, I2C_SlaWNack if it did not.
+ * I/P Arguments: none
+ * Return value : unsigned char-->status code.
+ *
+ */
+unsigned char I2C_Status ( )
+	{
+		return TWSR & 0xf8 ;
+	}
+
+/*
+ *
+ * Description  :This function writes registers of a slave in one transfer: Start, id, register, data..., Stop.
+ *		The slave increments its register pointer after each byte, like the DS1307 and most sensors do.
+ * I/P Arguments: unsigned char-->slave id(R/W cleared), unsigned char-->first register,
+ *		const unsigned char*-->data, unsigned char-->number of registers.
+ * Return value : unsigned char-->1 if every byte was acknowledged, 0 if not.
+ *
+ */
+unsigned char I2C_RegWrite ( unsigned char id , unsigned char reg , const unsigned char *buf , unsigned char n )
+	{
+		unsigned char ok ;
+
+		I2C_Start ( ) ;
+		I2C_Write ( id ) ;
+		ok = I2C_Status ( ) == I2C_SlaWAck ;
+		if ( ok )
+			{
+				I2C_Write ( reg ) ;
+				ok = I2C_Status ( ) == I2C_DataWAck ;
+			}
+		for ( ; n != 0 && ok ; n-- )
+			{
+				I2C_Write ( *buf++ ) ;
+				ok = I2C_Status ( ) == I2C_DataWAck ;
+			}
+		I2C_Stop ( ) ;
+		return ok ;
+	}
+
+/*
+ *
+ * Description  :This function reads registers of a slave in one transfer with a repeated Start:
+ *		Start, id+W, register, Start, id+R, data(ACK)..., last data(NACK), Stop.
+ * I/P Arguments: unsigned char-->slave id(R/W cleared), unsigned char-->first register,
+ *		unsigned char*-->where the data is stored, unsigned char-->number of registers.
+ * Return value : unsigned char-->1 if read, 0 if the slave did not answer(the data is set to 0xff).
+ *
+ */
+unsigned char I2C_RegRead ( unsigned char id , unsigned char reg , unsigned char *buf , unsigned char n )
+	{
+		unsigned char ok ;
+
+		I2C_Start ( ) ;
+		I2C_Write ( id ) ;
+		ok = I2C_Status ( ) == I2C_SlaWAck ;
+		if ( ok )
+			{
+				I2C_Write ( reg ) ;
+				ok = I2C_Status ( ) == I2C_DataWAck ;
+			}
+		if ( ok )
+			{
+				I2C_Start ( ) ;					// Repeated Start, the bus is kept
+				I2C_Write ( id | 0x01 ) ;
+				ok = I2C_Status ( ) == I2C_SlaRAck ;
+			}
+		if ( ok && n != 0 )
+			{
+				while ( --n != 0 )
+					*buf++ = I2C_Read ( 1 ) ;	// ACK, the slave sends the next register
+				*buf = I2C_Read ( 0 ) ;			// NACK on the last one
+			}
+		else
+			while ( n-- != 0 )
+				*buf++ = 0xff ;					// What the released bus reads, the callers may not check ok
+		I2C_Stop ( ) ;
+		return ok ;
+	}
+
+/*
+ *
+ * Description  :This function sets up a cache of count registers of a slave from the first one,
+ *		their values are unknown till they are written or read.
+ * I/P Arguments: I2CRegCache*-->cache, unsigned char-->slave id(R/W cleared),
+ *		unsigned char-->first register, unsigned char-->number of registers(1-I2C_CacheSize).
+ * Return value : none
+ *
+ */
+void I2C_CacheInit ( I2CRegCache *cache , unsigned char id , unsigned char first , unsigned char count )
+	{
+		cache->id = id ;
+		cache->first = first ;
+		cache->count = ( count > I2C_CacheSize ) ? I2C_CacheSize : count ;
+		cache->known = 0 ;
+		cache->dirty = 0 ;
+	}
+
+/*
+ *
+ * Description  :This function changes a register in the cache only, I2C_CacheFlush() writes it.
+ *		Writing the value the register already has is dropped. A register outside the cache is written at once.
+ * I/P Arguments: I2CRegCache*-->cache, unsigned char-->register, unsigned char-->value.
+ * Return value : none
+ *
+ */
+void I2C_CacheWrite ( I2CRegCache *cache , unsigned char reg , unsigned char value )
+	{
+		unsigned char index = reg - cache->first , bit ;
+
+		if ( index >= cache->count )
+			{
+				I2C_RegWrite ( cache->id , reg , &value , 1 ) ;
+				return ;
+			}
+		bit = 1 << index ;
+		if ( ( cache->known & bit ) && cache->value [ index ] == value )
+			return ;							// Same value, nothing to send
+		cache->value [ index ] = value ;
+		cache->known |= bit ;
+		cache->dirty |= bit ;
+	}
+
+/*
+ *
+ * Description  :This function writes the changed registers of the cache. The changed registers and the
+ *		known ones between them are sent in one transfer, a register of unknown value starts a new transfer.
+ * I/P Arguments: I2CRegCache*-->cache.
+ * Return value : unsigned char-->1 if written(or nothing to write), 0 if the slave did not answer,
+ *		the registers not written are written by the next flush.
+ *
+ */
+unsigned char I2C_CacheFlush ( I2CRegCache *cache )
+	{
+		unsigned char start = 0 , end , i ;
+
+		while ( cache->dirty )
+			{
+				while ( ! ( cache->dirty & ( 1 << start ) ) )
+					start++ ;
+				end = start + 1 ;
+				for ( i = end ; i < cache->count && ( cache->known & ( 1 << i ) ) ; i++ )
+					if ( cache->dirty & ( 1 << i ) )
+						end = i + 1 ;			// The known registers before it are sent again with their value
+
+				if ( ! I2C_RegWrite ( cache->id , cache->first + start , &cache->value [ start ] , end - start ) )
+					return 0 ;
+				cache->dirty &= ~ ( ( ( 1 << end ) - 1 ) & ~ ( ( 1 << start ) - 1 ) ) ;
+				start = end ;
+			}
+		return 1 ;
+	}
+
+/*
+ *
+ * Description  :This function returns a register from the cache, it is read from the slave if its value is unknown.
+ * I/P Arguments: I2CRegCache*-->cache, unsigned char-->register.
+ * Return value : unsigned char-->value, 0xFF if the slave did not answer.
+ *
+ */
+unsigned char I2C_CacheRead ( I2CRegCache *cache , unsigned char reg )
+	{
+		unsigned char index = reg - cache->first , value ;
+
+		if ( index < cache->count && ( cache->known & ( 1 << index ) ) )
+			return cache->value [ index ] ;
+		if ( ! I2C_RegRead ( cache->id , reg , &value , 1 ) )
+			return 0xff ;
+		if ( index < cache->count )
+			{
+				cache->value [ index ] = value ;
+				cache->known |= 1 << index ;
+			}
+		return value ;
+	}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\I2C.c
 ////////////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
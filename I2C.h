@@ -28,6 +28,31 @@
 #ifndef I2C_H_
 #define I2C_H_
 
+/* Status codes of the master mode(I2C_Status()) */
+#define I2C_StartSent			0x08
+#define I2C_RepeatedStartSent	0x10
+#define I2C_SlaWAck				0x18
+#define I2C_SlaWNack			0x20
+#define I2C_DataWAck			0x28
+#define I2C_DataWNack			0x30
+#define I2C_SlaRAck				0x40
+#define I2C_SlaRNack			0x48
+#define I2C_DataRAck			0x50
+#define I2C_DataRNack			0x58
+
+#define I2C_CacheSize			8			// Registers of one cache, one bit each in known and dirty
+
+/* Copy of some registers of a slave, see I2C_CacheWrite() */
+typedef struct
+	{
+		unsigned char id ;					// Slave address with R/W cleared
+		unsigned char first ;				// Register of value[0]
+		unsigned char count ;				// Registers in the cache(1-I2C_CacheSize)
+		unsigned char known ;				// Bit n set: value[n] is the value of the slave(after the flush if dirty)
+		unsigned char dirty ;				// Bit n set: value[n] is still to be written
+		unsigned char value [ I2C_CacheSize ] ;
+	} I2CRegCache ;
+
 /*
  *
  * Description :This function is used to initialize the I2c Module.
@@ -80,6 +105,151 @@ void I2C_Write ( unsigned char dat ) ;
  */
 unsigned char I2C_Read ( unsigned char ack ) ;
 
+/*
+ *
+ * Description  :This function starts the I2C Start Condition and returns without waiting.
+ *		I2C_Ready() returns 1 once the Start Condition is sent.
+ * I/P Arguments: none
+ * Return value: none
+ *
+ */
+void I2C_StartNoWait ( ) ;
+
+/*
+ *
+ * Description  :This function starts the I2C Stop Condition and returns without waiting.
+ *		I2C_Stopped() returns 1 once the Stop Condition is sent.
+ * I/P Arguments: none
+ * Return value: none
+ *
+ */
+void I2C_StopNoWait ( ) ;
+
+/*
+ *
+ * Description  :This function starts sending a byte and returns without waiting.
+ *		I2C_Ready() returns 1 once the byte is sent.
+ * I/P Arguments: unsigned char-->8bit data to be sent.
+ * Return value: none
+ *
+ */
+void I2C_WriteNoWait ( unsigned char dat ) ;
+
+/*
+ *
+ * Description  :This function starts receiving a byte and returns without waiting.
+ *		I2C_Ready() returns 1 once the byte is received, then it is read with I2C_Data().
+ * I/P Arguments: char: Acknowledgment for the Ninth clock cycle.
+ * Return value: none
+ *
+ */
+void I2C_ReadNoWait ( unsigned char ack ) ;
+
+/*
+ *
+ * Description  :This function checks whether the last Start, Write or Read is finished(TWINT is set).
+ * I/P Arguments: none
+ * Return value: unsigned char-->1 if finished, 0 otherwise.
+ *
+ */
+unsigned char I2C_Ready ( ) ;
+
+/*
+ *
+ * Description  :This function checks whether the last Stop Condition is sent(TWSTO is cleared by hardware).
+ * I/P Arguments: none
+ * Return value: unsigned char-->1 if sent, 0 otherwise.
+ *
+ */
+unsigned char I2C_Stopped ( ) ;
+
+/*
+ *
+ * Description  :This function returns the byte received by I2C_ReadNoWait().
+ * I/P Arguments: none
+ * Return value : Unsigned char(received byte)
+ *
+ */
+unsigned char I2C_Data ( ) ;
+
+/*
+ *
+ * Description  :This function returns the status of the last Start, Write or Read(TWSR without the prescaler bits),
+ *		ex: I2C_SlaWAck after the address of a slave which answered, I2C_SlaWNack if it did not.
+ * I/P Arguments: none
+ * Return value : unsigned char-->status code.
+ *
+ */
+unsigned char I2C_Status ( ) ;
+
+/*
+ *
+ * Description  :This function writes registers of a slave in one transfer: Start, id, register, data..., Stop.
+ *		The slave increments its register pointer after each byte, like the DS1307 and most sensors do.
+ * I/P Arguments: unsigned char-->slave id(R/W cleared), unsigned char-->first register,
+ *		const unsigned char*-->data, unsigned char-->number of registers.
+ * Return value : unsigned char-->1 if every byte was acknowledged, 0 if not.
+ *
+ */
+unsigned char I2C_RegWrite ( unsigned char id , unsigned char reg , const unsigned char *buf , unsigned char n ) ;
+
+/*
+ *
+ * Description  :This function reads registers of a slave in one transfer with a repeated Start:
+ *		Start, id+W, register, Start, id+R, data(ACK)..., last data(NACK), Stop.
+ * I/P Arguments: unsigned char-->slave id(R/W cleared), unsigned char-->first register,
+ *		unsigned char*-->where the data is stored, unsigned char-->number of registers.
+ * Return value : unsigned char-->1 if read, 0 if the slave did not answer(the data is set to 0xff).
+ *
+ */
+unsigned char I2C_RegRead ( unsigned char id , unsigned char reg , unsigned char *buf , unsigned char n ) ;
+
+/*
+ *
+ * Description  :This function sets up a cache of count registers of a slave from the first one,
+ *		their values are unknown till they are written or read.
+ * I/P Arguments: I2CRegCache*-->cache, unsigned char-->slave id(R/W cleared),
+ *		unsigned char-->first register, unsigned char-->number of registers(1-I2C_CacheSize).
+ * Return value : none
+ *
+ */
+void I2C_CacheInit ( I2CRegCache *cache , unsigned char id , unsigned char first , unsigned char count ) ;
+
+/*
+ *
+ * Description  :This function changes a register in the cache only, I2C_CacheFlush() writes it.
+ *		Writing the value the register already has is dropped. A register outside the cache is written at once.
+ *		Use it for the registers only the AVR changes(configuration, outputs), not for the ones the slave updates.
+ *	ex:
+ *		I2C_CacheWrite ( &sensor , 0x20 , 0x47 ) ;
+ *		I2C_CacheWrite ( &sensor , 0x23 , 0x08 ) ;
+ *		I2C_CacheFlush ( &sensor ) ;		// One transfer for both
+ * I/P Arguments: I2CRegCache*-->cache, unsigned char-->register, unsigned char-->value.
+ * Return value : none
+ *
+ */
+void I2C_CacheWrite ( I2CRegCache *cache , unsigned char reg , unsigned char value ) ;
+
+/*
+ *
+ * Description  :This function writes the changed registers of the cache. The changed registers and the
+ *		known ones between them are sent in one transfer, a register of unknown value starts a new transfer.
+ * I/P Arguments: I2CRegCache*-->cache.
+ * Return value : unsigned char-->1 if written(or nothing to write), 0 if the slave did not answer,
+ *		the registers not written are written by the next flush.
+ *
+ */
+unsigned char I2C_CacheFlush ( I2CRegCache *cache ) ;
+
+/*
+ *
+ * Description  :This function returns a register from the cache, it is read from the slave if its value is unknown.
+ * I/P Arguments: I2CRegCache*-->cache, unsigned char-->register.
+ * Return value : unsigned char-->value, 0xFF if the slave did not answer.
+ *
+ */
+unsigned char I2C_CacheRead ( I2CRegCache *cache , unsigned char reg ) ;
+
 #endif /* I2C_H_ */
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,233 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\I2C_Slave.c
+//
+// summary:	I2C slave class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * I2C_Slave.c
+ *
+ *
+ * |_______AVR I2C slave with a register file_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 21:48:37
+ *
+ * Filename: I2C_Slave.c
+ * Controller: Atmega8/16/32/128
+ * Oscillator: 1 MHz
+ * Author: Mohammad Sadr
+ * Reference:Atmega32 dataSheet(Slave Receiver and Slave Transmitter modes), I2C-bus specification
+ *
+ * Note:
+ *
+ *		The TWI holds SCL low while TWINT is set, so the master waits for the interrupt(clock stretching)
+ *		and nothing is lost, but a long cli() in the main loop slows the bus down.
+ *		TWEA given with the reply decides the ACK of the next byte: it is cleared when the pointer
+ *		reaches a register the master must not write.
+ *
+ */
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+#include "I2C_Slave.h"
+
+#define SlaveIdle				0
+#define SlavePointer			1			// Addressed for write, the next byte is the register
+#define SlaveWrite				2
+#define SlaveRead				3
+#define SlaveGeneral			4
+
+static volatile unsigned char *Registers ;
+static unsigned char Size ;
+static unsigned char Writable ;
+static volatile unsigned char Pointer ;
+static volatile unsigned char State ;
+static volatile unsigned char Written ;		// Registers written in this transfer
+static volatile unsigned char Changed ;
+static volatile unsigned char GeneralData ;
+static volatile unsigned char GeneralReceived ;
+
+/*
+ *
+ * Description  :This function starts the slave on the TWI, the interrupt answers the master from now on.
+ *		Global interrupts are enabled.
+ * I/P Arguments: unsigned char-->own id(R/W cleared, 0x02-0xEE), unsigned char*-->register file,
+ *		unsigned char-->number of registers, unsigned char-->first register the master can write
+ *		(number of registers for none), unsigned char-->1 to accept the general call, 0 for none.
+ * Return value : none
+ *
+ */
+void I2C_SlaveInit ( unsigned char id , volatile unsigned char *registers , unsigned char size ,
+		unsigned char writable , unsigned char general_call )
+	{
+		ATOMIC_BLOCK ( ATOMIC_RESTORESTATE )
+			{
+				Registers = registers ;
+				Size = size ;
+				Writable = writable ;
+				Pointer = 0 ;
+				State = SlaveIdle ;
+				Written = 0 ;
+				Changed = 0 ;
+				GeneralReceived = 0 ;
+				TWAR = ( id & 0xfe ) | ( general_call ? ( 1 << TWGCE ) : 0 ) ;
+				TWCR = ( 1 << TWEA ) | ( 1 << TWEN ) | ( 1 << TWIE ) ;
+			}
+		sei ( ) ;
+	}
+
+ISR ( TWI_vect )
+	{
+		unsigned char ack = 1 ;
+
+		switch ( TWSR & 0xf8 )
+			{
+				case I2C_SlaveSlaW :
+				case I2C_SlaveLostSlaW :
+					State = SlavePointer ;
+					break ;
+
+				case I2C_SlaveGeneral :
+				case I2C_SlaveLostGeneral :
+					State = SlaveGeneral ;
+					break ;
+
+				case I2C_SlaveDataAck :
+					if ( State == SlavePointer )
+						{
+							Pointer = TWDR ;
+							State = SlaveWrite ;
+						}
+					else
+						{
+							Registers [ Pointer++ ] = TWDR ;
+							Written = 1 ;
+						}
+					ack = ( Pointer >= Writable && Pointer < Size ) ;
+					break ;
+
+				case I2C_SlaveGeneralAck :
+					GeneralData = TWDR ;
+					GeneralReceived = 1 ;
+					break ;
+
+				case I2C_SlaveSlaR :
+				case I2C_SlaveLostSlaR :
+					State = SlaveRead ;
+					// no break: first byte
+				case I2C_SlaveTxAck :
+					if ( Pointer < Size )
+						TWDR = Registers [ Pointer++ ] ;
+					else
+						TWDR = 0xff ;
+					break ;
+
+				case I2C_SlaveDataNack :		// Not addressed any more
+				case I2C_SlaveGeneralNack :
+				case I2C_SlaveStop :
+				case I2C_SlaveTxNack :
+				case I2C_SlaveTxLastAck :
+					if ( Written )
+						Changed = 1 ;
+					Written = 0 ;
+					State = SlaveIdle ;
+					break ;
+
+				default :						// Bus error: release the bus
+					State = SlaveIdle ;
+					TWCR = ( 1 << TWINT ) | ( 1 << TWSTO ) | ( 1 << TWEA ) | ( 1 << TWEN ) | ( 1 << TWIE ) ;
+					return ;
+			}
+		TWCR = ( 1 << TWINT ) | ( ack ? ( 1 << TWEA ) : 0 ) | ( 1 << TWEN ) | ( 1 << TWIE ) ;
+	}
+
+/*
+ *
+ * Description  :This function copies new values into the registers. It is refused while the master reads,
+ *		so the master never gets the bytes of a value from two updates.
+ * I/P Arguments: unsigned char-->first register, const unsigned char*-->data, unsigned char-->number of registers.
+ * Return value : unsigned char-->1 if copied, 0 if the master is reading(try again later).
+ *
+ */
+unsigned char I2C_SlaveUpdate ( unsigned char reg , const unsigned char *buf , unsigned char n )
+	{
+		unsigned char done = 0 ;
+
+		ATOMIC_BLOCK ( ATOMIC_RESTORESTATE )
+			{
+				if ( State != SlaveRead )
+					{
+						while ( n-- )
+							Registers [ reg++ ] = *buf++ ;
+						done = 1 ;
+					}
+			}
+		return done ;
+	}
+
+/*
+ *
+ * Description  :This function copies registers the master writes, with the interrupt disabled.
+ * I/P Arguments: unsigned char-->first register, unsigned char*-->where the data is stored,
+ *		unsigned char-->number of registers.
+ * Return value : none
+ *
+ */
+void I2C_SlaveRead ( unsigned char reg , unsigned char *buf , unsigned char n )
+	{
+		ATOMIC_BLOCK ( ATOMIC_RESTORESTATE )
+			{
+				while ( n-- )
+					*buf++ = Registers [ reg++ ] ;
+			}
+	}
+
+/*
+ *
+ * Description  :This function tells if the master wrote registers since the last call.
+ *		It is set at the end of the write, so all the registers of the transfer are written.
+ * I/P Arguments: none
+ * Return value : unsigned char-->1 if written, 0 if not.
+ *
+ */
+unsigned char I2C_SlaveChanged ( )
+	{
+		unsigned char changed ;
+
+		ATOMIC_BLOCK ( ATOMIC_RESTORESTATE )
+			{
+				changed = Changed ;
+				Changed = 0 ;
+			}
+		return changed ;
+	}
+
+/*
+ *
+ * Description  :This function takes the last data byte of a general call(0x06: reset, 0x04: load the address
+ *		in the I2C specification, any other is the command of the application).
+ * I/P Arguments: unsigned char*-->where the byte is stored.
+ * Return value : unsigned char-->1 if a byte was received since the last call, 0 if not.
+ *
+ */
+unsigned char I2C_SlaveGeneralCall ( unsigned char *data )
+	{
+		unsigned char received ;
+
+		ATOMIC_BLOCK ( ATOMIC_RESTORESTATE )
+			{
+				received = GeneralReceived ;
+				GeneralReceived = 0 ;
+				*data = GeneralData ;
+			}
+		return received ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\I2C_Slave.c
+////////////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -0,0 +1,125 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\I2C_Slave.h
+//
+// summary:	Declares the I2C slave class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * I2C_Slave.h
+ *
+ *
+ * |_______AVR I2C slave with a register file_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 21:48:37
+ *
+ * Filename: I2C_Slave.h
+ * Controller: Atmega8/16/32/128
+ * Oscillator: 1 MHz
+ * Author: Mohammad Sadr
+ * Reference:Atmega32 dataSheet(Slave Receiver and Slave Transmitter modes), I2C-bus specification
+ *
+ * Note:
+ *
+ *		The AVR answers its id on the bus like the DS1307 does, from the TWI interrupt:
+ *			Write: Start, id+W, register, data ... , Stop
+ *			Read : Start, id+W, register, repeated Start, id+R, data(ACK) ... last data(NACK), Stop
+ *		The register pointer counts on after each byte, so I2C_RegRead() and I2C_RegWrite() of the
+ *		master board work on it. A read past the last register gives 0xFF.
+ *		The registers below the writable one are results(read only), a master writing one of them
+ *		gets a NACK. A general call(address 0) is accepted if enabled, its data byte is kept for
+ *		I2C_SlaveGeneralCall().
+ *		A board is either the master(I2C.c) or a slave, I2C_Init() stops the slave.
+ *	ex:
+ *		static unsigned char Registers [ 8 ] ;	// 0-5: three filtered ADC channels, 6-7: settings
+ *
+ *		I2C_SlaveInit ( 0x42 , Registers , 8 , 6 , 1 ) ;
+ *		while ( 1 )
+ *			{
+ *				result [ 0 ] = ... ;
+ *				I2C_SlaveUpdate ( 0 , result , 6 ) ;
+ *			}
+ *
+ */
+
+#ifndef I2C_SLAVE_H_
+#define I2C_SLAVE_H_
+
+/* Status codes of the slave modes(TWSR & 0xF8) */
+#define I2C_SlaveSlaW			0x60
+#define I2C_SlaveLostSlaW		0x68		// Arbitration lost as master, then addressed
+#define I2C_SlaveGeneral		0x70
+#define I2C_SlaveLostGeneral	0x78
+#define I2C_SlaveDataAck		0x80
+#define I2C_SlaveDataNack		0x88
+#define I2C_SlaveGeneralAck		0x90
+#define I2C_SlaveGeneralNack	0x98
+#define I2C_SlaveStop			0xA0		// Stop or repeated Start while addressed
+#define I2C_SlaveSlaR			0xA8
+#define I2C_SlaveLostSlaR		0xB0
+#define I2C_SlaveTxAck			0xB8
+#define I2C_SlaveTxNack			0xC0
+#define I2C_SlaveTxLastAck		0xC8
+#define I2C_SlaveBusError		0x00
+
+/*
+ *
+ * Description  :This function starts the slave on the TWI, the interrupt answers the master from now on.
+ *		Global interrupts are enabled.
+ * I/P Arguments: unsigned char-->own id(R/W cleared, 0x02-0xEE), unsigned char*-->register file,
+ *		unsigned char-->number of registers, unsigned char-->first register the master can write
+ *		(number of registers for none), unsigned char-->1 to accept the general call, 0 for none.
+ * Return value : none
+ *
+ */
+void I2C_SlaveInit ( unsigned char id , volatile unsigned char *registers , unsigned char size ,
+		unsigned char writable , unsigned char general_call ) ;
+
+/*
+ *
+ * Description  :This function copies new values into the registers. It is refused while the master reads,
+ *		so the master never gets the bytes of a value from two updates.
+ * I/P Arguments: unsigned char-->first register, const unsigned char*-->data, unsigned char-->number of registers.
+ * Return value : unsigned char-->1 if copied, 0 if the master is reading(try again later).
+ *
+ */
+unsigned char I2C_SlaveUpdate ( unsigned char reg , const unsigned char *buf , unsigned char n ) ;
+
+/*
+ *
+ * Description  :This function copies registers the master writes, with the interrupt disabled.
+ * I/P Arguments: unsigned char-->first register, unsigned char*-->where the data is stored,
+ *		unsigned char-->number of registers.
+ * Return value : none
+ *
+ */
+void I2C_SlaveRead ( unsigned char reg , unsigned char *buf , unsigned char n ) ;
+
+/*
+ *
+ * Description  :This function tells if the master wrote registers since the last call.
+ *		It is set at the end of the write, so all the registers of the transfer are written.
+ * I/P Arguments: none
+ * Return value : unsigned char-->1 if written, 0 if not.
+ *
+ */
+unsigned char I2C_SlaveChanged ( ) ;
+
+/*
+ *
+ * Description  :This function takes the last data byte of a general call(0x06: reset, 0x04: load the address
+ *		in the I2C specification, any other is the command of the application).
+ * I/P Arguments: unsigned char*-->where the byte is stored.
+ * Return value : unsigned char-->1 if a byte was received since the last call, 0 if not.
+ *
+ */
+unsigned char I2C_SlaveGeneralCall ( unsigned char *data ) ;
+
+#endif /* I2C_SLAVE_H_ */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\I2C_Slave.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -33,12 +33,119 @@
 #include <avr/io.h>
 #include "Configuration.h"
 #include <util/delay.h>
-#include "keypad.h"
+#include <util/atomic.h>
+#include <avr/pgmspace.h>
+#include <avr/cpufunc.h>
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+#include "Keypad.h"
+#include "Queue.h"
 
 #define RowColDirection		DDRC			//Data Direction Configuration for keypad
 #define ROW					PORTC            //Lower four bits of PORTC are used as ROWs
 #define COL					PINC            //Higher four bits of PORTC are used as COLs
 
+#define KeypadRows				4
+#define KeypadCols				4
+#define KeypadNoKey				0xff
+
+/*
+ *
+ * The four COL lines are connected to the wake-up interrupt through a diode each(diode-OR, cathodes
+ * on the COL lines), so any key pulls it low while all the ROW lines are low(KEYPAD_WakeInt in Keypad.h).
+ * INT0/INT1 wake the controller from power-down on the low level only, INT2 is asynchronous on the
+ * Atmega16/32 and wakes it on the falling edge. Without KEYPAD_WAKE_ENABLE, GICR(Atmega128/1284) or
+ * the selected INTx(INT2 on the Atmega8) there is no wake-up and no interrupt vector is taken.
+ *
+ */
+#if ! defined ( KEYPAD_WAKE_ENABLE )
+	// No wake-up, the application may use the INTx vectors
+#elif KEYPAD_WakeInt == 2 && defined ( INT2 ) && defined ( GICR )
+	#define KeypadWake
+	#define WakeDirection		DDRB
+	#define WakePort			PORTB
+	#define WakePin				PB2
+	#define WakeInt				INT2
+	#define WakeFlag			INTF2
+	#define WakeVector			INT2_vect
+	#define WakeSense( )		( MCUCSR &= ~ ( 1 << ISC2 ) )						// Falling edge
+#elif KEYPAD_WakeInt == 1 && defined ( INT1 ) && defined ( GICR )
+	#define KeypadWake
+	#define WakeDirection		DDRD
+	#define WakePort			PORTD
+	#define WakePin				PD3
+	#define WakeInt				INT1
+	#define WakeFlag			INTF1
+	#define WakeVector			INT1_vect
+	#define WakeSense( )		( MCUCR &= ~ ( ( 1 << ISC11 ) | ( 1 << ISC10 ) ) )	// Low level
+#elif KEYPAD_WakeInt == 0 && defined ( INT0 ) && defined ( GICR )
+	#define KeypadWake
+	#define WakeDirection		DDRD
+	#define WakePort			PORTD
+	#define WakePin				PD2
+	#define WakeInt				INT0
+	#define WakeFlag			INTF0
+	#define WakeVector			INT0_vect
+	#define WakeSense( )		( MCUCR &= ~ ( ( 1 << ISC01 ) | ( 1 << ISC00 ) ) )	// Low level
+#endif
+
+#define RowSelect(row)			( ( ~ ( 0x10 << ( row ) ) & 0xF0 ) + 0x0F )	// Pull one ROW low, keep the COL pull-ups on
+
+/*
+ *
+ * Default keymap, ASCII value of each key index(ROW*4+COL).
+ * COL0 is the lowest bit of the COL lines, ROW0 is selected by ScanCode 0xe0.
+ *
+ */
+static const unsigned char DefaultKeymap [ KeypadRows * KeypadCols ] PROGMEM =
+	{
+		'3' , '2' , '1' , '0' ,
+		'7' , '6' , '5' , '4' ,
+		'B' , 'A' , '9' , '8' ,
+		'F' , 'E' , 'D' , 'C'
+	} ;
+
+static const unsigned char *Keymap = DefaultKeymap ;		// Keymap in flash used for decoding
+
+#define KeypadDebounceScans		2				// Full scans a key must read pressed(or released) to change its state(8ms with a 1ms tick)
+#define KeypadRepeatDelay		125				// Full scans before the first repeat event
+#define KeypadRepeatPeriod		25				// Full scans between repeat events
+#define KeypadQueueSize			8				// Events in the queue, must be a power of two
+
+static unsigned char ScanRow = KeypadRows ;			// ROW selected by the last KEYPAD_Tick(), KeypadRows before the first call
+static unsigned char Integrator [ KeypadRows * KeypadCols ] ;
+static unsigned int KeyState ;							// Debounced state, bit(ROW*4+COL) is set while the key is pressed
+static unsigned char RepeatKey = KeypadNoKey ;
+static unsigned char RepeatCount ;
+
+typedef struct
+	{
+		unsigned char event ;		// Event type in the higher nibble, key index(ROW*4+COL) in the lower nibble
+		unsigned int keys ;			// Debounced state of all the keys after the event
+	} KeypadQueueEntry ;
+
+QUEUE_Define ( KeypadQueue , KeypadQueueEntry , KeypadQueueSize ) ;
+static KeypadQueue Events ;							// Pushed only by KEYPAD_Tick(), popped only by KEYPAD_GetEvent()
+
+static volatile unsigned char WakeArmed ;				// 1 while all the ROW lines are pulled low for the key wake-up
+
+/*
+ *
+ * Description  :This function puts an event into the keypad event queue.
+ *		The event is dropped if the queue is full.
+ * I/P Arguments: unsigned char--> event type, unsigned char--> key index(ROW*4+COL)
+ * Return value : none
+ *
+ */
+static void KEYPAD_PutEvent ( unsigned char type , unsigned char index )
+	{
+		KeypadQueueEntry entry ;
+
+		entry.event = ( type << 4 ) | index ;
+		entry.keys = KeyState ;
+		KeypadQueue_Push ( &Events , entry ) ;
+	}
+
 /*
  *
  * Description  : This function the rows and colums for keypad scan
@@ -145,43 +252,358 @@ unsigned char KEYPAD_ScanKey ( )
  * Description:This function waits till a key is pressed and returns its ASCII Value
  *		Wait till the previous key is released..
  *		Wait for the new key press.
- *		Scan all the rows one at a time for the pressed key.
- *		Decode the key pressed depending on ROW-COL combination and returns its ASCII value.
+ *		Scan the complete matrix for the pressed key.
+ *		Decode the key pressed from the keymap table and returns its ASCII value.
  * I/P Arguments: none
- * Return value : char--> ASCII value of the Key Pressed
+ * Return value : char--> ASCII value of the Key Pressed, 'z' if more than one key is pressed
  *
  */
 unsigned char KEYPAD_GetKey ( )
 	{
-		unsigned char key ;
+		unsigned int keys ;
+		unsigned char index = 0 ;
 
 		KEYPAD_WaitForKeyRelease ( ) ;    // Wait for the previous key release
 		_delay_ms ( 1 ) ;
 
 		KEYPAD_WaitForKeyPress ( ) ;      // Wait for the new key press
-		key = KEYPAD_ScanKey ( ) ;        // Scan for the key pressed.
+		keys = KEYPAD_ScanMatrix ( ) ;    // Scan all the keys at once
+
+		if ( ( keys == 0 ) || ( keys & ( keys - 1 ) ) )
+			return ( 'z' ) ;              // No key or more than one key
+
+		while ( ! ( keys & 0x01 ) )       // Find the index of the pressed key
+			{
+				keys >>= 1 ;
+				index++ ;
+			}
+		return ( KEYPAD_MapKey ( index ) ) ;  // Return the key
+	}
+
+/*
+ *
+ * Description  :This function scans the complete 4x4 matrix in one pass.
+ *		Each ROW is pulled low in turn and its four COL lines are shifted into the result,
+ *		so the cost is the same for any number of pressed keys.
+ *		All the ROW lines are left low, as in KEYPAD_WaitForKeyRelease().
+ * I/P Arguments: none
+ * Return value : int--> bitmap of the pressed keys, bit(ROW*4+COL) is set when the key is pressed
+ *
+ */
+unsigned int KEYPAD_ScanMatrix ( )
+	{
+		unsigned int keys = 0 ;
+		unsigned char row ;
+
+		for ( row = 0 ; row < KeypadRows ; row++ )
+			{
+				ROW = RowSelect ( row ) ;        // Select 1-Row at a time
+				_NOP ( ) ;                      // Let the COL lines pass the input synchronizer
+				keys = ( keys >> 4 ) | ( ( unsigned int ) ( ~COL & 0x0F ) << 12 ) ;   // ROW0 ends in the lowest nibble
+			}
+
+		ROW = 0x0f ;                         // Pull all the ROW lines low again
+		return ( keys ) ;
+	}
+
+/*
+ *
+ * Description  :This function selects the keymap used to decode the keys.
+ * I/P Arguments: unsigned char*--> 16 ASCII values in flash(PROGMEM), indexed by ROW*4+COL, 0 for the default keymap
+ * Return value : none
+ *
+ */
+void KEYPAD_SetKeymap ( const unsigned char *keymap_ptr )
+	{
+		Keymap = keymap_ptr ? keymap_ptr : DefaultKeymap ;
+	}
+
+/*
+ *
+ * Description  :This function returns the ASCII value of a key index from the keymap.
+ * I/P Arguments: unsigned char--> key index(ROW*4+COL)
+ * Return value : char--> ASCII value of the Key
+ *
+ */
+unsigned char KEYPAD_MapKey ( unsigned char index )
+	{
+		return pgm_read_byte ( Keymap + ( index & 0x0F ) ) ;
+	}
+
+/*
+ *
+ * Description  :This function converts a bitmap of pressed keys into their ASCII values.
+ *		The keys are written from index 0 to 15 and the string is NULL terminated,
+ *		so a chord like '1'+'A' gives "1A" whatever key was pressed first.
+ * I/P Arguments: int--> bitmap of keys, char*--> buffer of at least 17 chars
+ * Return value : char--> number of keys in the bitmap
+ *
+ */
+unsigned char KEYPAD_KeysToString ( unsigned int keys , char *string_ptr )
+	{
+		unsigned char index , count = 0 ;
+
+		for ( index = 0 ; keys ; index++ , keys >>= 1 )
+			if ( keys & 0x01 )
+				string_ptr [ count++ ] = KEYPAD_MapKey ( index ) ;
+
+		string_ptr [ count ] = 0 ;
+		return ( count ) ;
+	}
+
+/*
+ *
+ * Description  :This function scans one ROW per call and debounces each key of that ROW.
+ *		The COL lines of the ROW selected in the previous call are read, so the lines had one tick to settle.
+ *		Each key has an integrator which counts up while the key reads pressed and down while it reads released.
+ *		A key is pressed when its integrator reaches KeypadDebounceScans and released when it gets back to zero,
+ *		so a bouncing contact has to be stable for several full scans before an event is queued.
+ *		While the last pressed key is held, repeat events are queued after KeypadRepeatDelay full scans,
+ *		then every KeypadRepeatPeriod full scans.
+ *		After the ROW lines were pulled low by KEYPAD_WakeEnable(), the first call only selects its ROW again.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void KEYPAD_Tick ( )
+	{
+		unsigned char pressed , col , index , mask ;
+		unsigned int bit ;
+
+		if ( WakeArmed )                       // ROW lines were pulled low for the wake-up, select the ROW again
+			{
+				WakeArmed = 0 ;
+				if ( ScanRow < KeypadRows )
+					{
+						ROW = RowSelect ( ScanRow ) ;
+						return ;
+					}
+			}
+
+		if ( ScanRow < KeypadRows )
+			{
+				pressed = ~COL & 0x0F ;          // Pressed keys of the selected ROW read low
+				index = ScanRow << 2 ;
+
+				for ( col = 0 , mask = 0x01 ; col < KeypadCols ; col++ , index++ , mask <<= 1 )
+					{
+						bit = 1u << index ;
+						if ( pressed & mask )
+							{
+								if ( ( Integrator [ index ] < KeypadDebounceScans ) &&
+									 ( ++Integrator [ index ] == KeypadDebounceScans ) && ! ( KeyState & bit ) )
+									{
+										KeyState |= bit ;
+										KEYPAD_PutEvent ( KEYPAD_EventPress , index ) ;
+										RepeatKey = index ;
+										RepeatCount = KeypadRepeatDelay ;
+									}
+							}
+						else if ( Integrator [ index ] )
+							{
+								if ( ( --Integrator [ index ] == 0 ) && ( KeyState & bit ) )
+									{
+										KeyState &= ~bit ;
+										KEYPAD_PutEvent ( KEYPAD_EventRelease , index ) ;
+										if ( RepeatKey == index )
+											RepeatKey = KeypadNoKey ;
+									}
+							}
+					}
+
+				if ( ( ScanRow == KeypadRows - 1 ) && ( RepeatKey != KeypadNoKey ) && ( --RepeatCount == 0 ) )
+					{
+						KEYPAD_PutEvent ( KEYPAD_EventRepeat , RepeatKey ) ;
+						RepeatCount = KeypadRepeatPeriod ;
+					}
+
+				ScanRow++ ;
+			}
+
+		if ( ScanRow >= KeypadRows )
+			ScanRow = 0 ;
+
+		ROW = RowSelect ( ScanRow ) ;		// Select the next ROW
+	}
+
+/*
+ *
+ * Description  :This function takes the oldest event from the keypad event queue without waiting.
+ * I/P Arguments: KeypadEvent*--> event to be filled
+ * Return value : char--> 1 if an event was taken, 0 if the queue is empty
+ *
+ */
+unsigned char KEYPAD_GetEvent ( KeypadEvent *event_ptr )
+	{
+		KeypadQueueEntry entry ;
+
+		if ( ! KeypadQueue_Pop ( &Events , &entry ) )
+			return 0 ;
+
+		event_ptr->keys = entry.keys ;
+		event_ptr->type = entry.event >> 4 ;
+		event_ptr->key = KEYPAD_MapKey ( entry.event & 0x0F ) ;
+		return 1 ;
+	}
+
+/*
+ *
+ * Description  :This function returns 1 when no key is pressed and no key is being debounced.
+ * I/P Arguments: none
+ * Return value : char--> 1 if the keypad is idle, 0 otherwise
+ *
+ */
+unsigned char KEYPAD_IsIdle ( )
+	{
+		unsigned char index ;
+
+		for ( index = 0 ; index < KeypadRows * KeypadCols ; index++ )
+			if ( Integrator [ index ] )
+				return 0 ;
+
+		return 1 ;
+	}
+
+#ifdef KeypadWake
+static unsigned char WakeSaved ;						// Direction and pull-up of the wake-up pin before KEYPAD_WakeEnable()
+#endif
+
+/*
+ *
+ * Description  :This function arms the key wake-up.
+ *		All the ROW lines are pulled low, so a key press pulls its COL line and the wake-up line low.
+ *		The sense is set as described in the datasheet: disable INTx, change ISCx, clear INTFx, enable INTx.
+ *		The direction and pull-up of the pin are saved, KEYPAD_WakeDisable() restores them.
+ *		The next KEYPAD_Tick() selects its ROW again instead of reading the COL lines.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void KEYPAD_WakeEnable ( )
+	{
+#ifdef KeypadWake
+		if ( ! WakeArmed )
+			WakeSaved = ( ( WakeDirection >> WakePin ) & 1 ) | ( ( ( WakePort >> WakePin ) & 1 ) << 1 ) ;
+		WakeDirection &= ~ ( 1 << WakePin ) ;	// Input with pull-up
+		WakePort |= 1 << WakePin ;
+
+		WakeArmed = 1 ;
+		ROW = 0x0f ;                         // Pull all the ROW lines low
+
+		GICR &= ~ ( 1 << WakeInt ) ;
+		WakeSense ( ) ;
+		GIFR = 1 << WakeFlag ;               // Clear a pending flag by writing one
+		GICR |= 1 << WakeInt ;
+#endif
+	}
+
+/*
+ *
+ * Description  :This function disarms the key wake-up, restores the wake-up pin and selects the ROW
+ *		of the tick service again.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void KEYPAD_WakeDisable ( )
+	{
+#ifdef KeypadWake
+		GICR &= ~ ( 1 << WakeInt ) ;
+
+		if ( WakeArmed )
+			{
+				WakeArmed = 0 ;
+				if ( WakeSaved & 2 )
+					WakePort |= 1 << WakePin ;
+				else
+					WakePort &= ~ ( 1 << WakePin ) ;
+				if ( WakeSaved & 1 )
+					WakeDirection |= 1 << WakePin ;
+				if ( ScanRow < KeypadRows )
+					ROW = RowSelect ( ScanRow ) ;
+			}
+#endif
+	}
+
+/*
+ *
+ * Description  :This function puts the controller to sleep till the next interrupt.
+ *		While the keypad is idle the key wake-up is armed and the given sleep mode is used,
+ *		so the controller sleeps till a key is pressed(or any other interrupt).
+ *		While a key is pressed or being debounced, SLEEP_MODE_IDLE is used so the timer tick keeps scanning.
+ *		It returns at once if an event is waiting in the queue.
+ *		Without the wake-up diodes or interrupt, SLEEP_MODE_IDLE still saves power between the timer ticks.
+ *
+ *		NOTE: KEYPAD_Tick() must be called from a timer interrupt when this function is used.
+ *		For less than 10ms key latency from power-down, select a short start-up time in the fuses
+ *		(ex: internal RC oscillator with SUT=00, 6CK).
+ *
+ * I/P Arguments: unsigned char--> sleep mode while idle(SLEEP_MODE_IDLE or SLEEP_MODE_PWR_DOWN)
+ * Return value : none
+ *
+ */
+void KEYPAD_Sleep ( unsigned char sleep_mode )
+	{
+		if ( KeypadQueue_Count ( &Events ) )   // Let the main loop take the events first
+			return ;
+
+		cli ( ) ;
+#ifdef KeypadWake
+		if ( KEYPAD_IsIdle ( ) )
+			{
+				KEYPAD_WakeEnable ( ) ;
+				if ( ( COL & 0x0F ) != 0x0F )      // A key is already down, let KEYPAD_Tick() debounce it
+					{
+						KEYPAD_WakeDisable ( ) ;
+						sei ( ) ;
+						return ;
+					}
+			}
+		else
+#endif
+			sleep_mode = SLEEP_MODE_IDLE ;      // Keep the timer tick running while a key is in use
+
+		set_sleep_mode ( sleep_mode ) ;
+		sleep_enable ( ) ;
+		sei ( ) ;                                // The instruction after sei() is executed before any interrupt,
+		sleep_cpu ( ) ;                          // so the wake-up interrupt can not be lost between them
+		sleep_disable ( ) ;
+
+		cli ( ) ;
+		KEYPAD_WakeDisable ( ) ;
+		sei ( ) ;
+	}
+
+#ifdef KeypadWake
+/*
+ *
+ * Description  :Wake-up interrupt, a key was pressed while the keypad was armed for wake-up.
+ *		The interrupt is disabled so a bouncing key(or the low level) does not interrupt again,
+ *		the scan is done by KEYPAD_Tick().
+ *
+ */
+ISR ( WakeVector )
+	{
+		GICR &= ~ ( 1 << WakeInt ) ;
+	}
+#endif
+
+/*
+ *
+ * Description  :This function returns the debounced state of all the keys from the tick service.
+ * I/P Arguments: none
+ * Return value : int--> bitmap of the pressed keys, bit(ROW*4+COL) is set when the key is pressed
+ *
+ */
+unsigned int KEYPAD_GetState ( )
+	{
+		unsigned int keys ;
 
-		switch ( key )                       // Decode the key
+		ATOMIC_BLOCK ( ATOMIC_RESTORESTATE )		// KeyState may be changed by KEYPAD_Tick() from an ISR
 			{
-				case 0xe7 : key = '0' ; break ;
-				case 0xeb : key = '1' ; break ;
-				case 0xed : key = '2' ; break ;
-				case 0xee : key = '3' ; break ;
-				case 0xd7 : key = '4' ; break ;
-				case 0xdb : key = '5' ; break ;
-				case 0xdd : key = '6' ; break ;
-				case 0xde : key = '7' ; break ;
-				case 0xb7 : key = '8' ; break ;
-				case 0xbb : key = '9' ; break ;
-				case 0xbd : key = 'A' ; break ;
-				case 0xbe : key = 'B' ; break ;
-				case 0x77 : key = 'C' ; break ;
-				case 0x7b : key = 'D' ; break ;
-				case 0x7d : key = 'E' ; break ;
-				case 0x7e : key = 'F' ; break ;
-				default : key = 'z' ;
+				keys = KeyState ;
 			}
-		return ( key ) ;                      // Return the key
+		return ( keys ) ;
 	}
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -34,6 +34,28 @@
 #ifndef KEYPAD_H_
 #define KEYPAD_H_
 
+#define KEYPAD_EventPress		1		// Key became pressed
+#define KEYPAD_EventRelease		2		// Key became released
+#define KEYPAD_EventRepeat		3		// Key is still held(auto repeat)
+
+/*
+ * Key wake-up interrupt of KEYPAD_Sleep(), the COL lines are connected to it through diodes.
+ * It is only built with KEYPAD_WAKE_ENABLE(Configuration.h), Keypad.c then takes the INTx vector:
+ *	0: INT0(PD2, low level), 1: INT1(PD3, low level), 2: INT2(PB2, falling edge, Atmega16/32 only).
+ * PB2 is the EN pin of LCD_4_bit.c, INT2 can not be used with that LCD.
+ * PD2/PD3 are also the default trace pins, Trace.h stops the build till they are moved.
+ */
+#ifndef KEYPAD_WakeInt
+	#define KEYPAD_WakeInt			0
+#endif
+
+typedef struct
+	{
+		unsigned char type ;	// KEYPAD_EventPress, KEYPAD_EventRelease or KEYPAD_EventRepeat
+		unsigned char key ;		// ASCII value of the Key
+		unsigned int keys ;		// Bitmap of all the keys held after the event(chords), bit(ROW*4+COL)
+	} KeypadEvent ;
+
 /*
  *
  * Description  : This function the rows and colums for keypad scan
@@ -88,14 +110,136 @@ unsigned char KEYPAD_ScanKey ( ) ;
  * Description:This function waits till a key is pressed and returns its ASCII Value
  *		Wait till the previous key is released..
  *		Wait for the new key press.
- *		Scan all the rows one at a time for the pressed key.
- *		Decode the key pressed depending on ROW-COL combination and returns its ASCII value.
+ *		Scan the complete matrix for the pressed key.
+ *		Decode the key pressed from the keymap table and returns its ASCII value.
  * I/P Arguments: none
- * Return value : char--> ASCII value of the Key Pressed
+ * Return value : char--> ASCII value of the Key Pressed, 'z' if more than one key is pressed
  *
  */
 unsigned char KEYPAD_GetKey ( ) ;
 
+/*
+ *
+ * Description  :This function scans the complete 4x4 matrix in one pass.
+ *		Each ROW is pulled low in turn and its four COL lines are shifted into the result,
+ *		so the cost is the same for any number of pressed keys.
+ *		All the ROW lines are left low, as in KEYPAD_WaitForKeyRelease().
+ * I/P Arguments: none
+ * Return value : int--> bitmap of the pressed keys, bit(ROW*4+COL) is set when the key is pressed
+ *
+ */
+unsigned int KEYPAD_ScanMatrix ( ) ;
+
+/*
+ *
+ * Description  :This function selects the keymap used to decode the keys.
+ * I/P Arguments: unsigned char*--> 16 ASCII values in flash(PROGMEM), indexed by ROW*4+COL, 0 for the default keymap
+ * Return value : none
+ *
+ */
+void KEYPAD_SetKeymap ( const unsigned char *keymap_ptr ) ;
+
+/*
+ *
+ * Description  :This function returns the ASCII value of a key index from the keymap.
+ * I/P Arguments: unsigned char--> key index(ROW*4+COL)
+ * Return value : char--> ASCII value of the Key
+ *
+ */
+unsigned char KEYPAD_MapKey ( unsigned char index ) ;
+
+/*
+ *
+ * Description  :This function converts a bitmap of pressed keys into their ASCII values.
+ *		The keys are written from index 0 to 15 and the string is NULL terminated,
+ *		so a chord like '1'+'A' gives "1A" whatever key was pressed first.
+ * I/P Arguments: int--> bitmap of keys, char*--> buffer of at least 17 chars
+ * Return value : char--> number of keys in the bitmap
+ *
+ */
+unsigned char KEYPAD_KeysToString ( unsigned int keys , char *string_ptr ) ;
+
+/*
+ *
+ * Description  :This function scans one ROW per call and debounces each key of that ROW.
+ *		It should be called from a periodic timer tick(ex: every 1ms) or the main loop, it never waits.
+ *		A full scan of the 4 ROWs takes 4 calls. Press, release and repeat events are put into a small queue.
+ *		Do not use KEYPAD_GetKey() while the tick service is running, both drive the ROW lines.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void KEYPAD_Tick ( ) ;
+
+/*
+ *
+ * Description  :This function takes the oldest event from the keypad event queue without waiting.
+ * I/P Arguments: KeypadEvent*--> event to be filled
+ * Return value : char--> 1 if an event was taken, 0 if the queue is empty
+ *
+ */
+unsigned char KEYPAD_GetEvent ( KeypadEvent *event_ptr ) ;
+
+/*
+ *
+ * Description  :This function returns the debounced state of all the keys from the tick service.
+ * I/P Arguments: none
+ * Return value : int--> bitmap of the pressed keys, bit(ROW*4+COL) is set when the key is pressed
+ *
+ */
+unsigned int KEYPAD_GetState ( ) ;
+
+/*
+ *
+ * Description  :This function returns 1 when no key is pressed and no key is being debounced.
+ * I/P Arguments: none
+ * Return value : char--> 1 if the keypad is idle, 0 otherwise
+ *
+ */
+unsigned char KEYPAD_IsIdle ( ) ;
+
+/*
+ *
+ * Description  :This function arms the key wake-up(KEYPAD_WakeInt).
+ *		All the ROW lines are pulled low, so a key press pulls its COL line and the wake-up line low
+ *		(COL lines connected to it through diodes). The wake-up pin is made an input with pull-up.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void KEYPAD_WakeEnable ( ) ;
+
+/*
+ *
+ * Description  :This function disarms the key wake-up, restores the direction and pull-up of the wake-up pin
+ *		and selects the ROW of the tick service again.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void KEYPAD_WakeDisable ( ) ;
+
+/*
+ *
+ * Description  :This function puts the controller to sleep till the next interrupt.
+ *		While the keypad is idle the key wake-up is armed and the given sleep mode is used.
+ *		Without a wake-up interrupt(no KEYPAD_WAKE_ENABLE, Atmega128/1284, INT2 on the Atmega8)
+ *		SLEEP_MODE_IDLE is always used.
+ *		While a key is in use SLEEP_MODE_IDLE is used, so the timer tick keeps scanning.
+ *		It returns at once if an event is waiting in the queue.
+ *	ex:
+ *		ISR ( TIMER0_COMP_vect ) { KEYPAD_Tick ( ) ; }       // 1ms tick
+ *
+ *		while ( 1 )
+ *			{
+ *				while ( KEYPAD_GetEvent ( &event ) ) { ... }
+ *				KEYPAD_Sleep ( SLEEP_MODE_PWR_DOWN ) ;
+ *			}
+ * I/P Arguments: unsigned char--> sleep mode while idle(SLEEP_MODE_IDLE or SLEEP_MODE_PWR_DOWN)
+ * Return value : none
+ *
+ */
+void KEYPAD_Sleep ( unsigned char sleep_mode ) ;
 
 #endif /* KEYPAD_H_ */
 
@@ -34,7 +34,11 @@
 #include <avr/io.h>
 #include "Configuration.h"
 #include <util/delay.h>
+#include <util/atomic.h>
+#include <avr/pgmspace.h>
 #include "LCD_4_bit.h"
+#include "Profile.h"
+#include "Trace.h"
 
 #define databus_direction			DDRB //  LCD data and Control bus Direction Configuration
 
@@ -53,6 +57,36 @@
 
 #define BlankSpace				' '
 
+#define PowerUpDelay			50			// ms after power on before the first command
+#define CommandDelay			2			// ms wait of CO_Delay() after each command(at least 1ms)
+#define ClearDelay				3			// ms wait of CO_Delay() after Clear and Home(1.52ms, at least 2ms)
+#define CommandWait(command)	( ( command ) <= 0x03 ? ClearDelay : CommandDelay )	// 0x01 Clear, 0x02/0x03 Home
+#define LcdPins					( 0xf0 | ( 1 << rs ) | ( 1 << rw ) | ( 1 << en ) )	// PB3 is left to the other drivers
+
+/*
+ *
+ * Puts a nibble on D4-D7(PB4-PB7) and keeps PB0-PB3. PB3 is the RS-485 DE of UART.c by default,
+ * which the TXC interrupt clears, so the read-modify-write is done with the interrupts disabled.
+ *
+ */
+static void LCD_Bus ( unsigned char nibble )
+	{
+		ATOMIC_BLOCK ( ATOMIC_RESTORESTATE )
+			{
+				databus = ( databus & 0x0f ) | ( nibble & 0xf0 ) ;
+			}
+	}
+
+/* Commands sent by LCD_Init() and LCD_InitCo() */
+static const unsigned char InitCommands [ ] PROGMEM =
+	{
+		0x02 ,			// Initilize the LCD in 4bit Mode
+		0x28 ,
+		0x0E ,			// Display ON cursor ON
+		0x01 ,			// Clear the LCD
+		0x80			// Move the Cursor to First line First Position
+	} ;
+
 /*
  *
  * Description  :This function is used to initialize the lcd in 4-bit mode
@@ -63,13 +97,38 @@
  */
 void LCD_Init ( )
 	{
-		_delay_ms ( 50 ) ;
-		databus_direction = 0xff ;  // Configure both databus and controlbus as output
-		LCD_CmdWrite ( 0x02 ) ;	       //Initilize the LCD in 4bit Mode
-		LCD_CmdWrite ( 0x28 ) ;
-		LCD_CmdWrite ( 0x0E ) ;	      // Display ON cursor ON
-		LCD_CmdWrite ( 0x01 ) ;	      // Clear the LCD
-		LCD_CmdWrite ( 0x80 ) ;	      // Move the Cursor to First line First Position
+		unsigned char i ;
+
+		_delay_ms ( PowerUpDelay ) ;
+		databus_direction |= LcdPins ;  // Configure both databus and controlbus as output
+		for ( i = 0 ; i < sizeof ( InitCommands ) ; i++ )
+			LCD_CmdWrite ( pgm_read_byte ( &InitCommands [ i ] ) ) ;
+	}
+
+/*
+ *
+ * Description  :This function sends a command to LCD without waiting for the LCD to execute it.
+ * I/P Arguments: 8-bit command supported by LCD.
+ * Return value : none
+ *
+ */
+static void LCD_CmdSend ( char cmd )
+	{
+		LCD_Bus ( cmd ) ;        // Send the Higher Nibble of the command to LCD
+		control_bus &= ~ ( 1 << rs ) ;  // Select the Command Register by pulling RS LOW
+		control_bus &= ~ ( 1 << rw ) ;  // Select the Write Operation  by pulling RW LOW
+		control_bus |= 1 << en ;     // Send a High-to-Low Pusle at Enable Pin
+		_delay_us ( 1 ) ;
+		control_bus &= ~ ( 1 << en ) ;
+
+		_delay_us ( 10 ) ;				// wait for some time
+
+		LCD_Bus ( cmd << 4 ) ;   // Send the Lower Nibble of the command to LCD
+		control_bus &= ~ ( 1 << rs ) ;  // Select the Command Register by pulling RS LOW
+		control_bus &= ~ ( 1 << rw ) ;  // Select the Write Operation  by pulling RW LOW
+		control_bus |= 1 << en ;     // Send a High-to-Low Pusle at Enable Pin
+		_delay_us ( 1 ) ;
+		control_bus &= ~ ( 1 << en ) ;
 	}
 
 /*
@@ -91,22 +150,41 @@ void LCD_Init ( )
  */
 void LCD_CmdWrite ( char cmd )
 	{
-		databus = ( cmd & 0xf0 ) ;        // Send the Higher Nibble of the command to LCD
-		control_bus &= ~ ( 1 << rs ) ;  // Select the Command Register by pulling RS LOW
-		control_bus &= ~ ( 1 << rw ) ;  // Select the Write Operation  by pulling RW LOW
-		control_bus |= 1 << en ;     // Send a High-to-Low Pusle at Enable Pin
-		_delay_us ( 1 ) ;
-		control_bus &= ~ ( 1 << en ) ;
+		PROFILE_Begin ( ) ;
 
-		_delay_us ( 10 ) ;				// wait for some time
+		LCD_CmdSend ( cmd ) ;
+		if ( ( unsigned char ) cmd <= 0x03 )
+			_delay_ms ( 2 ) ;			// Clear and Return home take 1.52ms
+		else
+			_delay_ms ( 1 ) ;
+		PROFILE_End ( PROFILE_LcdWrite ) ;
+	}
 
-		databus = ( ( cmd << 4 ) & 0xf0 ) ;   // Send the Lower Nibble of the command to LCD
-		control_bus &= ~ ( 1 << rs ) ;  // Select the Command Register by pulling RS LOW
-		control_bus &= ~ ( 1 << rw ) ;  // Select the Write Operation  by pulling RW LOW
-		control_bus |= 1 << en ;     // Send a High-to-Low Pusle at Enable Pin
-		_delay_us ( 1 ) ;
-		control_bus &= ~ ( 1 << en ) ;
-		_delay_ms ( 1 ) ;
+/*
+ *
+ * Description  :This function initializes the lcd in 4-bit mode like LCD_Init(), as a coroutine.
+ *		The 50ms power up wait and the wait after each command use CO_Delay() instead of _delay_ms(),
+ *		so other tasks run meanwhile. It must be called till it returns CO_Done, SCHED_Init() must be called first.
+ *	ex:
+ *		static Coroutine lcd_co ;
+ *		CO_Init ( &lcd_co ) ;
+ *		while ( LCD_InitCo ( &lcd_co ) == CO_Waiting )
+ *			SCHED_Run ( ) ;
+ * I/P Arguments: Coroutine*-->coroutine state.
+ * Return value : char-->CO_Waiting or CO_Done.
+ *
+ */
+char LCD_InitCo ( Coroutine *co )
+	{
+		CO_Begin ( co ) ;
+		CO_Delay ( co , PowerUpDelay ) ;
+		databus_direction |= LcdPins ;
+		for ( co->step = 0 ; co->step < sizeof ( InitCommands ) ; co->step++ )
+			{
+				LCD_CmdSend ( pgm_read_byte ( &InitCommands [ co->step ] ) ) ;
+				CO_Delay ( co , CommandWait ( pgm_read_byte ( &InitCommands [ co->step ] ) ) ) ;
+			}
+		CO_End ( co ) ;
 	}
 
 /*
@@ -130,7 +208,10 @@ void LCD_CmdWrite ( char cmd )
  */
 void LCD_DataWrite ( char dat )
 	{
-		databus = ( dat & 0xf0 ) ;	  // Send the Higher Nibble of the Data to LCD
+		PROFILE_Begin ( ) ;
+
+		TRACE_On ( TRACE_PinLcdWrite ) ;
+		LCD_Bus ( dat ) ;	  // Send the Higher Nibble of the Data to LCD
 		control_bus |= 1 << rs ;	  // Select the Data Register by pulling RS HIGH
 		control_bus &= ~ ( 1 << rw ) ;	  // Select the Write Operation  by pulling RW LOW
 		control_bus |= 1 << en ;	  // Send a High-to-Low Pusle at Enable Pin
@@ -138,14 +219,15 @@ void LCD_DataWrite ( char dat )
 		control_bus &= ~ ( 1 << en ) ;
 		_delay_us ( 10 ) ;
 
-		databus = ( ( dat << 4 ) & 0xf0 ) ; // Send the Lower Nibble of the Data to LCD
+		LCD_Bus ( dat << 4 ) ; // Send the Lower Nibble of the Data to LCD
 		control_bus |= 1 << rs ;	   // Select the Data Register by pulling RS HIGH
 		control_bus &= ~ ( 1 << rw ) ;	   // Select the Write Operation  by pulling RW LOW
 		control_bus |= 1 << en ;	   // Send a High-to-Low Pusle at Enable Pin
 		_delay_us ( 1 ) ;
 		control_bus &= ~ ( 1 << en ) ;
 		_delay_ms ( 1 ) ;
-
+		TRACE_Off ( TRACE_PinLcdWrite ) ;
+		PROFILE_End ( PROFILE_LcdWrite ) ;
 	}
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
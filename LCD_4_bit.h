@@ -32,6 +32,8 @@
 #ifndef LCD_4_BIT_H_
 #define LCD_4_BIT_H_
 
+#include "Coroutine.h"
+
 /*
  *
  * Description  :This function is used to initialize the lcd in 4-bit mode
@@ -42,6 +44,22 @@
  */
 void LCD_Init ( ) ;
 
+/*
+ *
+ * Description  :This function initializes the lcd in 4-bit mode like LCD_Init(), as a coroutine.
+ *		The 50ms power up wait and the wait after each command use CO_Delay() instead of _delay_ms(),
+ *		so other tasks run meanwhile. It must be called till it returns CO_Done, SCHED_Init() must be called first.
+ *	ex:
+ *		static Coroutine lcd_co ;
+ *		CO_Init ( &lcd_co ) ;
+ *		while ( LCD_InitCo ( &lcd_co ) == CO_Waiting )
+ *			SCHED_Run ( ) ;
+ * I/P Arguments: Coroutine*-->coroutine state.
+ * Return value : char-->CO_Waiting or CO_Done.
+ *
+ */
+char LCD_InitCo ( Coroutine *co ) ;
+
 /*
  *
  * Description  :This function sends a command to LCD in the following steps.
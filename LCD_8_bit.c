@@ -36,7 +36,11 @@
 #include <avr/io.h>
 #include "Configuration.h"
 #include <util/delay.h>
+#include <avr/pgmspace.h>
 #include "LCD_8_bit.h"
+#include "Profile.h"
+#include "Trace.h"
+#include "Format.h"
 
 #define databus_direction		DDRC		 //  LCD databus Direction Configuration
 #define controlbus_direction	 DDRD	  //  LCD Control bus Direction Configuration
@@ -56,6 +60,37 @@
 
 #define BlankSpace ' '
 
+#define PowerUpDelay	50			// ms after power on before the first command
+#define CommandDelay	2			// ms wait of CO_Delay() after each command(at least 1ms)
+#define ClearDelay		3			// ms wait of CO_Delay() after Clear and Home(1.52ms, at least 2ms)
+#define CommandWait(command)	( ( command ) <= 0x03 ? ClearDelay : CommandDelay )	// 0x01 Clear, 0x02/0x03 Home
+
+/* Commands sent by LCD_Init() and LCD_InitCo() */
+static const unsigned char InitCommands [ ] PROGMEM =
+	{
+		0x38 ,			// LCD 2lines, 5*7 matrix
+		0x0E ,			// Display ON cursor ON
+		0x01 ,			// Clear the LCD
+		0x80			// Move the Cursor to First line First Position
+	} ;
+
+/*
+ *
+ * Description :This function sends a command to LCD without waiting for the LCD to execute it.
+ * I/P Arguments: 8-bit command supported by LCD.
+ * Return value : none
+ *
+ */
+static void LCD_CmdSend ( char cmd )
+	{
+		databus = cmd ;             // Send the command to LCD
+		control_bus &= ~ ( 1 << rs ) ;  // Select the Command Register by pulling RS LOW
+		control_bus &= ~ ( 1 << rw ) ;  // Select the Write Operation  by pulling RW LOW
+		control_bus |= 1 << en ;     // Send a High-to-Low Pusle at Enable Pin
+			_delay_us ( 1 ) ;
+		control_bus &= ~ ( 1 << en ) ;
+	}
+
 /*
  *
  * Description :This function sends a command to LCD in the following steps.
@@ -71,13 +106,14 @@
  */
 void LCD_CmdWrite ( char cmd )
 	{
-		databus = cmd ;             // Send the command to LCD
-		control_bus &= ~ ( 1 << rs ) ;  // Select the Command Register by pulling RS LOW
-		control_bus &= ~ ( 1 << rw ) ;  // Select the Write Operation  by pulling RW LOW
-		control_bus |= 1 << en ;     // Send a High-to-Low Pusle at Enable Pin
-			_delay_us ( 1 ) ;
-		control_bus &= ~ ( 1 << en ) ;
-		_delay_ms ( 1 );
+		PROFILE_Begin ( ) ;
+
+		LCD_CmdSend ( cmd ) ;
+		if ( ( unsigned char ) cmd <= 0x03 )
+			_delay_ms ( 2 ) ;			// Clear and Return home take 1.52ms
+		else
+			_delay_ms ( 1 ) ;
+		PROFILE_End ( PROFILE_LcdWrite ) ;
 	}
 
 /*
@@ -90,13 +126,41 @@ void LCD_CmdWrite ( char cmd )
  */
 void LCD_Init ( )
 	{
-		_delay_ms ( 50 ) ;
+		unsigned char i ;
+
+		_delay_ms ( PowerUpDelay ) ;
 	   databus_direction = 0xff ;   // Configure both databus and controlbus as output
 	   controlbus_direction = 0xff ;
-	   LCD_CmdWrite ( 0x38 ) ;			// LCD 2lines, 5*7 matrix
-	   LCD_CmdWrite ( 0x0E ) ;			// Display ON cursor ON
-	   LCD_CmdWrite ( 0x01 ) ;			// Clear the LCD
-	   LCD_CmdWrite ( 0x80 ) ;			// Move the Cursor to First line First Position
+		for ( i = 0 ; i < sizeof ( InitCommands ) ; i++ )
+			LCD_CmdWrite ( pgm_read_byte ( &InitCommands [ i ] ) ) ;
+	}
+
+/*
+ *
+ * Description  :This function initializes the lcd in 8-bit mode like LCD_Init(), as a coroutine.
+ *		The 50ms power up wait and the wait after each command use CO_Delay() instead of _delay_ms(),
+ *		so other tasks run meanwhile. It must be called till it returns CO_Done, SCHED_Init() must be called first.
+ *	ex:
+ *		static Coroutine lcd_co ;
+ *		CO_Init ( &lcd_co ) ;
+ *		while ( LCD_InitCo ( &lcd_co ) == CO_Waiting )
+ *			SCHED_Run ( ) ;
+ * I/P Arguments: Coroutine*-->coroutine state.
+ * Return value : char-->CO_Waiting or CO_Done.
+ *
+ */
+char LCD_InitCo ( Coroutine *co )
+	{
+		CO_Begin ( co ) ;
+		CO_Delay ( co , PowerUpDelay ) ;
+		databus_direction = 0xff ;
+		controlbus_direction = 0xff ;
+		for ( co->step = 0 ; co->step < sizeof ( InitCommands ) ; co->step++ )
+			{
+				LCD_CmdSend ( pgm_read_byte ( &InitCommands [ co->step ] ) ) ;
+				CO_Delay ( co , CommandWait ( pgm_read_byte ( &InitCommands [ co->step ] ) ) ) ;
+			}
+		CO_End ( co ) ;
 	}
 
 /*
@@ -177,7 +241,9 @@ void LCD_GoToXY ( char row , char col )
  */
 void LCD_DataWrite ( char dat )
 	{
+		PROFILE_Begin ( ) ;
 
+		TRACE_On ( TRACE_PinLcdWrite ) ;
 		databus = dat ;            // Send the data to LCD
 		control_bus |= 1 << rs ;	// Select the Data Register by pulling RS HIGH
 		control_bus &= ~ ( 1 << rw ) ;	// Select the Write Operation  by pulling RW LOW
@@ -185,6 +251,8 @@ void LCD_DataWrite ( char dat )
 		_delay_us ( 1 ) ;
 		control_bus &= ~ ( 1 << en ) ;
 		_delay_ms ( 1 ) ;
+		TRACE_Off ( TRACE_PinLcdWrite ) ;
+		PROFILE_End ( PROFILE_LcdWrite ) ;
 	}
 
 /*
@@ -202,6 +270,24 @@ void LCD_DisplayString ( char *string_ptr )
 			LCD_DataWrite ( *string_ptr++ );
 	}
 
+/*
+ *
+ * Description  :This function displays an ASCII string stored in flash(PROGMEM), read with pgm_read_byte(),
+ *		so the string is not copied into SRAM at startup.
+ *	ex:
+ *		LCD_DisplayString_P ( PSTR ( "Explore Embedded" ) ) ;
+ * I/P Arguments: const char*-->address of the string in flash.
+ * Return value : none
+ *
+ */
+void LCD_DisplayString_P ( const char *string_ptr )
+	{
+		char ch ;
+
+		while ( ( ch = pgm_read_byte ( string_ptr++ ) ) != 0 )
+			LCD_DataWrite ( ch ) ;
+	}
+
 /*
  *
  * Description  :This function is used to display a 5-digit integer(0-65535).
@@ -216,18 +302,10 @@ void LCD_DisplayString ( char *string_ptr )
  */
 void LCD_DisplayNumber ( unsigned int num )
 	{
-		LCD_DataWrite ( ( num / 10000 ) + 0x30 ) ;
-			num = num % 10000 ;
+		char buffer [ FORMAT_BufferSize ] ;
 
-		LCD_DataWrite ( ( num / 1000 ) + 0x30 ) ;
-			num = num % 1000 ;
-
-		LCD_DataWrite ( ( num / 100 ) + 0x30 ) ;
-			num = num % 100 ;
-
-		LCD_DataWrite ( ( num / 10 ) + 0x30 ) ;
-
-		LCD_DataWrite ( ( num % 10 ) + 0x30 ) ;
+		FORMAT_Unsigned ( buffer , num , 5 , '0' ) ;	// 5-digit zero padded, no division used
+		LCD_DisplayString ( buffer ) ;
 	}
 
 /*
@@ -262,6 +340,36 @@ void LCD_ScrollMessage ( char *msg_ptr )
 		LCD_CmdWrite ( 0x0E ) ;			  //Enable the Cursor
 	}
 
+/*
+ *
+ * Description  :This function scrolls a message stored in flash(PROGMEM) on the first line, like LCD_ScrollMessage().
+ * I/P Arguments: const char*-->address of the message in flash.
+ * Return value : none
+ *
+ */
+void LCD_ScrollMessage_P ( const char *msg_ptr )
+	{
+		unsigned char j ;
+		const char *p ;
+		char ch ;
+
+		LCD_CmdWrite ( 0x0c ) ;			 //Disable the Cursor
+		for ( ; pgm_read_byte ( msg_ptr ) ; msg_ptr++ )
+			{
+				LCD_GoToLineOne ( ) ;
+
+				p = msg_ptr ;
+				for ( j = 0 ; j < LCDMaxChars && ( ch = pgm_read_byte ( p ) ) != 0 ; j++ , p++ )
+					LCD_DataWrite ( ch ) ;
+
+				for ( ; j < LCDMaxChars ; j++ )
+					LCD_DataWrite ( BlankSpace ) ;
+
+				_delay_ms ( 500 ) ;
+			}
+		LCD_CmdWrite ( 0x0E ) ;			  //Enable the Cursor
+	}
+
 /*
  *
  * Description  :This function display hour,min,sec read from DS1307.
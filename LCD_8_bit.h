@@ -36,6 +36,8 @@
 #ifndef LCD_8_BIT_H_
 #define LCD_8_BIT_H_
 
+#include "Coroutine.h"
+
 /*
  *
  * Description :This function sends a command to LCD in the following steps.
@@ -61,6 +63,22 @@ void LCD_CmdWrite ( char cmd ) ;
  */
 void LCD_Init ( ) ;
 
+/*
+ *
+ * Description  :This function initializes the lcd in 8-bit mode like LCD_Init(), as a coroutine.
+ *		The 50ms power up wait and the wait after each command use CO_Delay() instead of _delay_ms(),
+ *		so other tasks run meanwhile. It must be called till it returns CO_Done, SCHED_Init() must be called first.
+ *	ex:
+ *		static Coroutine lcd_co ;
+ *		CO_Init ( &lcd_co ) ;
+ *		while ( LCD_InitCo ( &lcd_co ) == CO_Waiting )
+ *			SCHED_Run ( ) ;
+ * I/P Arguments: Coroutine*-->coroutine state.
+ * Return value : char-->CO_Waiting or CO_Done.
+ *
+ */
+char LCD_InitCo ( Coroutine *co ) ;
+
 /*
  *
  * Description  :This function clears the LCD and moves the cursor to first Position
@@ -125,6 +143,18 @@ void LCD_DataWrite ( char dat) ;
  */
 void LCD_DisplayString ( char *string_ptr ) ;
 
+/*
+ *
+ * Description  :This function displays an ASCII string stored in flash(PROGMEM), read with pgm_read_byte(),
+ *		so the string is not copied into SRAM at startup.
+ *	ex:
+ *		LCD_DisplayString_P ( PSTR ( "Explore Embedded" ) ) ;
+ * I/P Arguments: const char*-->address of the string in flash.
+ * Return value : none
+ *
+ */
+void LCD_DisplayString_P ( const char *string_ptr ) ;
+
 /*
  *
  * Description  :This function is used to display a 5-digit integer(0-65535).
@@ -152,6 +182,15 @@ void LCD_DisplayNumber ( unsigned int num ) ;
  */
 void LCD_ScrollMessage ( char *msg_ptr ) ;
 
+/*
+ *
+ * Description  :This function scrolls a message stored in flash(PROGMEM) on the first line, like LCD_ScrollMessage().
+ * I/P Arguments: const char*-->address of the message in flash.
+ * Return value : none
+ *
+ */
+void LCD_ScrollMessage_P ( const char *msg_ptr ) ;
+
 /*
  *
  * Description  :This function display hour,min,sec read from DS1307.
@@ -0,0 +1,194 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\LCD_Glyph.c
+//
+// summary:	LCD custom glyph class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * LCD_Glyph.c
+ *
+ *
+ * |_______AVR LCD CGRAM custom glyph library_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 11:20:47
+ *
+ * Filename: LCD_Glyph.c
+ * Controller: Atmega8/16/32/128
+ * Oscillator: 1 MHz
+ * Author: Mohammad Sadr
+ * Reference: HD44780 dataSheet
+ *
+ * Note:
+ *
+ *		LruOrder[] keeps the slot numbers from the most recently used(index 0)
+ *		to the least recently used(index 7). A used slot is moved to the front.
+ *
+ */
+
+#include <avr/io.h>
+#include <avr/pgmspace.h>
+#include "Configuration.h"
+#include "LCD_4_bit.h"
+#include "LCD_Glyph.h"
+
+#define CgramSlots				8
+#define GlyphRows				8
+#define GlyphColumns			5
+
+#define SetCgramAddress			0x40		// CGRAM address command, slot*8 is added
+#define LineOne					0x80
+
+#define BlankSpace				' '
+#define FullBlock				0xff		// Block char of the HD44780 A00 ROM
+
+/* Bar graph glyphs with 1 to 4 pixel columns filled from the left in all 8 rows, like the ROM block of the full cells */
+static const unsigned char BarGlyph [ GlyphColumns - 1 ] [ GlyphRows ] PROGMEM =
+	{
+		{ 0x10 , 0x10 , 0x10 , 0x10 , 0x10 , 0x10 , 0x10 , 0x10 } ,
+		{ 0x18 , 0x18 , 0x18 , 0x18 , 0x18 , 0x18 , 0x18 , 0x18 } ,
+		{ 0x1c , 0x1c , 0x1c , 0x1c , 0x1c , 0x1c , 0x1c , 0x1c } ,
+		{ 0x1e , 0x1e , 0x1e , 0x1e , 0x1e , 0x1e , 0x1e , 0x1e }
+	} ;
+
+static const unsigned char *SlotGlyph [ CgramSlots ] ;	// Glyph loaded in each slot, 0 if empty
+static unsigned char LruOrder [ CgramSlots ] = { 0 , 1 , 2 , 3 , 4 , 5 , 6 , 7 } ;
+
+/*
+ *
+ * Description  :This function moves the slot at the given LRU position to the front(most recently used).
+ * I/P Arguments: unsigned char-->position in LruOrder[].
+ * Return value : unsigned char-->slot number.
+ *
+ */
+static unsigned char LCD_GlyphTouch ( unsigned char pos )
+	{
+		unsigned char slot = LruOrder [ pos ] ;
+
+		for ( ; pos ; pos-- )
+			LruOrder [ pos ] = LruOrder [ pos - 1 ] ;
+		LruOrder [ 0 ] = slot ;
+
+		return slot ;
+	}
+
+/*
+ *
+ * Description  :This function forgets all the glyphs loaded into CGRAM.
+ *		It should be called after LCD_Init(), as the LCD contents are unknown after a reset.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void LCD_GlyphReset ( )
+	{
+		unsigned char i ;
+
+		for ( i = 0 ; i < CgramSlots ; i++ )
+			{
+				SlotGlyph [ i ] = 0 ;
+				LruOrder [ i ] = i ;
+			}
+	}
+
+/*
+ *
+ * Description  :This function makes sure the glyph is in CGRAM and returns its char code.
+ *		If the glyph is already loaded, only the LRU order is updated.
+ *		Otherwise the least recently used slot is written with the 8 rows of the glyph.
+ *
+ *		NOTE: Writing CGRAM moves the LCD address counter, so set the cursor position
+ *		(ex: LCD_GoToXY()) after this function before writing chars.
+ *
+ * I/P Arguments: unsigned char*-->address of the 8 byte glyph in flash.
+ * Return value : unsigned char-->char code(0-7) to be written with LCD_DataWrite().
+ *
+ */
+unsigned char LCD_GlyphLoad ( const unsigned char *glyph_ptr )
+	{
+		unsigned char pos , slot , i ;
+
+		for ( pos = 0 ; pos < CgramSlots ; pos++ )
+			if ( SlotGlyph [ LruOrder [ pos ] ] == glyph_ptr )
+				return LCD_GlyphTouch ( pos ) ;		// Already in CGRAM, nothing to write
+
+		slot = LCD_GlyphTouch ( CgramSlots - 1 ) ;	// Replace the least recently used slot
+		SlotGlyph [ slot ] = glyph_ptr ;
+
+		LCD_CmdWrite ( SetCgramAddress | ( slot << 3 ) ) ;
+		for ( i = 0 ; i < GlyphRows ; i++ )
+			LCD_DataWrite ( pgm_read_byte ( glyph_ptr + i ) ) ;
+
+		return slot ;
+	}
+
+/*
+ *
+ * Description  :This function displays a glyph at the specified position.
+ * I/P Arguments:
+ *		1- unsigned char-->line number(line1=0, line2=1).
+ *		2- unsigned char-->char number(0-15).
+ *		3- unsigned char*-->address of the 8 byte glyph in flash.
+ * Return value : none
+ *
+ */
+void LCD_GlyphDisplay ( unsigned char row , unsigned char col , const unsigned char *glyph_ptr )
+	{
+		unsigned char code = LCD_GlyphLoad ( glyph_ptr ) ;
+
+		LCD_CmdWrite ( LineOne + ( row << 6 ) + col ) ;	// Move the Cursor back to DDRAM
+		LCD_DataWrite ( code ) ;
+	}
+
+/*
+ *
+ * Description  :This function draws a horizontal bar graph with one pixel column resolution.
+ *		Each char has 5 pixel columns, so a 16 char bar has 80 steps.
+ *		Full chars use the ROM block char(0xFF), empty chars use BlankSpace and only
+ *		the partly filled char needs a CGRAM glyph(1-4 columns).
+ *	ex:
+ *		LCD_BarGraph(1,0,16,40) fills the left half of the second line.
+ * I/P Arguments:
+ *		1- unsigned char-->line number(line1=0, line2=1).
+ *		2- unsigned char-->first char number of the bar(0-15).
+ *		3- unsigned char-->length of the bar in chars(1-16).
+ *		4- unsigned char-->level in pixel columns(0 to length*5), bigger values draw a full bar.
+ * Return value : none
+ *
+ */
+void LCD_BarGraph ( unsigned char row , unsigned char col , unsigned char length , unsigned char level )
+	{
+		unsigned char full = 0 , code = 0 ;
+
+		while ( ( level >= GlyphColumns ) && ( full < length ) )	// Split the level into full chars and remaining columns
+			{
+				level -= GlyphColumns ;
+				full++ ;
+			}
+		if ( full == length )
+			level = 0 ;
+
+		if ( level )
+			code = LCD_GlyphLoad ( BarGlyph [ level - 1 ] ) ;	// Load before the DDRAM address is set
+
+		LCD_CmdWrite ( LineOne + ( row << 6 ) + col ) ;
+
+		for ( ; full ; full-- , length-- )
+			LCD_DataWrite ( FullBlock ) ;
+
+		if ( level )
+			{
+				LCD_DataWrite ( code ) ;			// Partly filled char
+				length-- ;
+			}
+
+		for ( ; length ; length-- )
+			LCD_DataWrite ( BlankSpace ) ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\LCD_Glyph.c
+////////////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -0,0 +1,99 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\LCD_Glyph.h
+//
+// summary:	Declares the LCD custom glyph class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * LCD_Glyph.h
+ *
+ *
+ * |_______AVR LCD CGRAM custom glyph library_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 11:20:47
+ *
+ * Filename: LCD_Glyph.h
+ * Controller: Atmega8/16/32/128
+ * Oscillator: 1 MHz
+ * Author: Mohammad Sadr
+ * Reference: HD44780 dataSheet
+ *
+ * Note:
+ *
+ *		Works on top of LCD_CmdWrite()/LCD_DataWrite(), so it can be linked with either LCD_4_bit.c or LCD_8_bit.c.
+ *		A glyph is 8 bytes in flash(PROGMEM), one byte per pixel row from top to bottom, using the lower 5 bits.
+ *			ex: static const unsigned char Bell [ 8 ] PROGMEM = { 0x04 , 0x0e , 0x0e , 0x0e , 0x1f , 0x00 , 0x04 , 0x00 } ;
+ *		The HD44780 has 8 CGRAM slots(char codes 0-7). Loaded glyphs are remembered by their flash address,
+ *		so loading a glyph which is already in CGRAM costs no LCD write.
+ *		When all slots are used, the least recently used glyph is replaced. The chars already on the
+ *		display which use the replaced slot change to the new glyph, so keep at most 8 glyphs on the screen.
+ *
+ */
+
+#ifndef LCD_GLYPH_H_
+#define LCD_GLYPH_H_
+
+/*
+ *
+ * Description  :This function forgets all the glyphs loaded into CGRAM.
+ *		It should be called after LCD_Init(), as the LCD contents are unknown after a reset.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void LCD_GlyphReset ( ) ;
+
+/*
+ *
+ * Description  :This function makes sure the glyph is in CGRAM and returns its char code.
+ *		If the glyph is already loaded, only the LRU order is updated.
+ *		Otherwise the least recently used slot is written with the 8 rows of the glyph.
+ *
+ *		NOTE: Writing CGRAM moves the LCD address counter, so set the cursor position
+ *		(ex: LCD_GoToXY()) after this function before writing chars.
+ *
+ * I/P Arguments: unsigned char*-->address of the 8 byte glyph in flash.
+ * Return value : unsigned char-->char code(0-7) to be written with LCD_DataWrite().
+ *
+ */
+unsigned char LCD_GlyphLoad ( const unsigned char *glyph_ptr ) ;
+
+/*
+ *
+ * Description  :This function displays a glyph at the specified position.
+ * I/P Arguments:
+ *		1- unsigned char-->line number(line1=0, line2=1).
+ *		2- unsigned char-->char number(0-15).
+ *		3- unsigned char*-->address of the 8 byte glyph in flash.
+ * Return value : none
+ *
+ */
+void LCD_GlyphDisplay ( unsigned char row , unsigned char col , const unsigned char *glyph_ptr ) ;
+
+/*
+ *
+ * Description  :This function draws a horizontal bar graph with one pixel column resolution.
+ *		Each char has 5 pixel columns, so a 16 char bar has 80 steps.
+ *		Full chars use the ROM block char(0xFF), empty chars use BlankSpace and only
+ *		the partly filled char needs a CGRAM glyph(1-4 columns).
+ *	ex:
+ *		LCD_BarGraph(1,0,16,40) fills the left half of the second line.
+ * I/P Arguments:
+ *		1- unsigned char-->line number(line1=0, line2=1).
+ *		2- unsigned char-->first char number of the bar(0-15).
+ *		3- unsigned char-->length of the bar in chars(1-16).
+ *		4- unsigned char-->level in pixel columns(0 to length*5), bigger values draw a full bar.
+ * Return value : none
+ *
+ */
+void LCD_BarGraph ( unsigned char row , unsigned char col , unsigned char length , unsigned char level ) ;
+
+#endif /* LCD_GLYPH_H_ */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\LCD_Glyph.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -0,0 +1,243 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\LCD_I2C.c
+//
+// summary:	LCD I2C class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * LCD_I2C.c
+ *
+ *
+ * |_______AVR LCD library for the PCF8574 I2C backpack_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 22:17:05
+ *
+ * Filename: LCD_I2C.c
+ * Controller: Atmega8/16/32/128
+ * Oscillator: 1 MHz
+ * Author: Mohammad Sadr
+ * Reference:HD44780 and PCF8574 dataSheets
+ *
+ * Note:
+ *
+ *		The PCF8574 changes its pins at the acknowledge of each byte, so the EN pulse is one byte long
+ *		(144us at 62.5kHz) and no delay is needed between the nibbles. A port written pin by pin,
+ *		like LCD_4_bit.c does on PORTB, would need one I2C write for each pin change.
+ *		The LCD may be in 4-bit mode after a reset of the AVR alone, so LCD_Init() starts with the
+ *		initialization by instruction(3 times 0x3, then 0x2) of the HD44780 dataSheet.
+ *
+ */
+
+#include <avr/io.h>
+#include "Configuration.h"
+#include <util/delay.h>
+#include <avr/pgmspace.h>
+#include "I2C.h"
+#include "LCD_I2C.h"
+#include "Profile.h"
+#include "Trace.h"
+
+#define PowerUpDelay			50			// ms after power on before the first command
+#define ResetDelay				5			// ms after each 0x3 nibble(at least 4.1ms)
+#define CommandDelay			2			// ms wait of CO_Delay() after each command(at least 1ms)
+#define ClearDelay				3			// ms wait of CO_Delay() after Clear and Home(1.52ms, at least 2ms)
+#define CommandWait(command)	( ( command ) <= 0x03 ? ClearDelay : CommandDelay )	// 0x01 Clear, 0x02/0x03 Home
+
+/* TWBR for LCD_I2CScl, prescaler 1 */
+#if F_CPU / LCD_I2CScl > 16 + 2 * 255
+#define LcdTwbr					255
+#elif F_CPU / LCD_I2CScl > 16
+#define LcdTwbr					( ( F_CPU / LCD_I2CScl - 16 ) / 2 )
+#else
+#define LcdTwbr					0
+#endif
+
+/* Commands sent by LCD_Init() and LCD_InitCo() after the 4-bit mode is set */
+static const unsigned char InitCommands [ ] PROGMEM =
+	{
+		0x28 ,			// 4bit Mode, 2 lines
+		0x0E ,			// Display ON cursor ON
+		0x01 ,			// Clear the LCD
+		0x80			// Move the Cursor to First line First Position
+	} ;
+
+static unsigned char Backlight = 1 << LCD_I2CBacklight ;
+
+/* Sends the 4 expander bytes of one LCD byte, the I2C write must be started */
+static void LCD_Byte ( unsigned char value , unsigned char control )
+	{
+		unsigned char high = ( value & 0xf0 ) | control | Backlight ;
+		unsigned char low = ( value << 4 ) | control | Backlight ;
+
+		I2C_Write ( high | ( 1 << LCD_I2CEn ) ) ;
+		I2C_Write ( high ) ;			// EN High-to-Low: the nibble is latched
+		I2C_Write ( low | ( 1 << LCD_I2CEn ) ) ;
+		I2C_Write ( low ) ;
+	}
+
+/* One nibble in its own I2C write, for the initialization by instruction */
+static void LCD_Nibble ( unsigned char nibble )
+	{
+		I2C_Start ( ) ;
+		I2C_Write ( LCD_I2CId ) ;
+		I2C_Write ( nibble | Backlight | ( 1 << LCD_I2CEn ) ) ;
+		I2C_Write ( nibble | Backlight ) ;
+		I2C_Stop ( ) ;
+	}
+
+/*
+ *
+ * Description  :This function sends a command to LCD without waiting for the LCD to execute it.
+ * I/P Arguments: 8-bit command supported by LCD.
+ * Return value : none
+ *
+ */
+static void LCD_CmdSend ( char cmd )
+	{
+		I2C_Start ( ) ;
+		I2C_Write ( LCD_I2CId ) ;
+		LCD_Byte ( cmd , 0 ) ;			// RS and RW low
+		I2C_Stop ( ) ;
+	}
+
+/* Selects the SCL of the LCD, after I2C_Init() */
+static void LCD_Bus ( )
+	{
+		I2C_Init ( ) ;
+		TWBR = LcdTwbr ;
+	}
+
+/*
+ *
+ * Description  :This function is used to initialize the lcd in 4-bit mode through the backpack.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void LCD_Init ( )
+	{
+		unsigned char i ;
+
+		_delay_ms ( PowerUpDelay ) ;
+		LCD_Bus ( ) ;
+		for ( i = 0 ; i < 3 ; i++ )
+			{
+				LCD_Nibble ( 0x30 ) ;
+				_delay_ms ( ResetDelay ) ;
+			}
+		LCD_Nibble ( 0x20 ) ;
+		_delay_ms ( 1 ) ;
+		for ( i = 0 ; i < sizeof ( InitCommands ) ; i++ )
+			LCD_CmdWrite ( pgm_read_byte ( &InitCommands [ i ] ) ) ;
+	}
+
+/*
+ *
+ * Description  :This function initializes the lcd like LCD_Init(), as a coroutine.
+ *		The waits use CO_Delay() instead of _delay_ms(), so other tasks run meanwhile.
+ *		It must be called till it returns CO_Done, SCHED_Init() must be called first.
+ * I/P Arguments: Coroutine*-->coroutine state.
+ * Return value : char-->CO_Waiting or CO_Done.
+ *
+ */
+char LCD_InitCo ( Coroutine *co )
+	{
+		CO_Begin ( co ) ;
+		CO_Delay ( co , PowerUpDelay ) ;
+		LCD_Bus ( ) ;
+		for ( co->step = 0 ; co->step < 3 ; co->step++ )
+			{
+				LCD_Nibble ( 0x30 ) ;
+				CO_Delay ( co , ResetDelay ) ;
+			}
+		LCD_Nibble ( 0x20 ) ;
+		CO_Delay ( co , CommandDelay ) ;
+		for ( co->step = 0 ; co->step < sizeof ( InitCommands ) ; co->step++ )
+			{
+				LCD_CmdSend ( pgm_read_byte ( &InitCommands [ co->step ] ) ) ;
+				CO_Delay ( co , CommandWait ( pgm_read_byte ( &InitCommands [ co->step ] ) ) ) ;
+			}
+		CO_End ( co ) ;
+	}
+
+/*
+ *
+ * Description  :This function sends a command to LCD in one I2C write.
+ *		Only clear and return home wait, the write of the next command takes longer than 37us.
+ * I/P Arguments: 8-bit command supported by LCD.
+ * Return value : none
+ *
+ */
+void LCD_CmdWrite ( char cmd )
+	{
+		PROFILE_Begin ( ) ;
+
+		LCD_CmdSend ( cmd ) ;
+		if ( ( unsigned char ) cmd <= 0x03 )
+			_delay_ms ( 2 ) ;			// Clear and Return home take 1.52ms
+		PROFILE_End ( PROFILE_LcdWrite ) ;
+	}
+
+/*
+ *
+ * Description  :This function sends a character to be displayed on LCD in one I2C write.
+ * I/P Arguments: ASCII value of the char to be displayed.
+ * Return value : none
+ *
+ */
+void LCD_DataWrite ( char dat )
+	{
+		PROFILE_Begin ( ) ;
+
+		TRACE_On ( TRACE_PinLcdWrite ) ;
+		I2C_Start ( ) ;
+		I2C_Write ( LCD_I2CId ) ;
+		LCD_Byte ( dat , 1 << LCD_I2CRs ) ;
+		I2C_Stop ( ) ;
+		TRACE_Off ( TRACE_PinLcdWrite ) ;
+		PROFILE_End ( PROFILE_LcdWrite ) ;
+	}
+
+/*
+ *
+ * Description  :This function sends chars to the LCD in one I2C write, 4 bytes each.
+ *		The HD44780 has executed a char(37us) before the 2 bytes of the next nibble are on the bus.
+ * I/P Arguments: const char*-->chars, unsigned char-->number of chars.
+ * Return value : none
+ *
+ */
+void LCD_DataBurst ( const char *data , unsigned char n )
+	{
+		PROFILE_Begin ( ) ;
+
+		I2C_Start ( ) ;
+		I2C_Write ( LCD_I2CId ) ;
+		while ( n-- )
+			LCD_Byte ( *data++ , 1 << LCD_I2CRs ) ;
+		I2C_Stop ( ) ;
+		PROFILE_End ( PROFILE_LcdWrite ) ;
+	}
+
+/*
+ *
+ * Description  :This function switches the backlight of the backpack on or off.
+ * I/P Arguments: unsigned char-->1 for on, 0 for off.
+ * Return value : none
+ *
+ */
+void LCD_Backlight ( unsigned char on )
+	{
+		Backlight = on ? ( 1 << LCD_I2CBacklight ) : 0 ;
+		I2C_Start ( ) ;
+		I2C_Write ( LCD_I2CId ) ;
+		I2C_Write ( Backlight ) ;
+		I2C_Stop ( ) ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\LCD_I2C.c
+////////////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
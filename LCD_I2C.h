@@ -0,0 +1,81 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\LCD_I2C.h
+//
+// summary:	Declares the LCD I2C class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * LCD_I2C.h
+ *
+ *
+ * |_______AVR LCD library for the PCF8574 I2C backpack_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 22:17:05
+ *
+ * Filename: LCD_I2C.h
+ * Controller: Atmega8/16/32/128
+ * Oscillator: 1 MHz
+ * Author: Mohammad Sadr
+ * Reference:HD44780 and PCF8574 dataSheets
+ *
+ * Note:
+ *
+ *		LCD_I2C.c has the functions of LCD_4_bit.h(LCD_Init, LCD_InitCo, LCD_CmdWrite, LCD_DataWrite),
+ *		so LCD_Glyph.c, LCD_Marquee.c and Stream.c work on it unchanged. Only one of LCD_4_bit.c and
+ *		LCD_I2C.c is linked(make LCD=i2c).
+ *		Expander pins of the common backpack: P0 RS, P1 RW, P2 EN, P3 backlight, P4-P7 D4-D7.
+ *		Each expander byte sets all the pins, so a nibble is two bytes(EN high, then EN low with the same data)
+ *		and a whole LCD byte is 4 bytes of one I2C write. LCD_DataBurst() sends many chars in one write.
+ *		LCD_Init() sets SCL to LCD_I2CScl, the other slaves on the bus must support it.
+ *	ex:
+ *		LCD_Init ( ) ;
+ *		LCD_DataBurst ( "Hello world" , 11 ) ;
+ *
+ */
+
+#ifndef LCD_I2C_H_
+#define LCD_I2C_H_
+
+#include "LCD_4_bit.h"
+
+#ifndef LCD_I2CId
+#define LCD_I2CId				0x4E		// PCF8574 with A0-A2 high(0x27), 0x7E for the PCF8574A
+#endif
+
+#ifndef LCD_I2CScl
+#define LCD_I2CScl				100000UL	// Hz, limited to F_CPU/16(500kHz at 8 MHz)
+#endif
+
+#define LCD_I2CRs				0
+#define LCD_I2CRw				1
+#define LCD_I2CEn				2
+#define LCD_I2CBacklight		3
+
+/*
+ *
+ * Description  :This function sends chars to the LCD in one I2C write, 4 bytes each.
+ *		The HD44780 has executed a char(37us) before the 2 bytes of the next nibble are on the bus.
+ * I/P Arguments: const char*-->chars, unsigned char-->number of chars.
+ * Return value : none
+ *
+ */
+void LCD_DataBurst ( const char *data , unsigned char n ) ;
+
+/*
+ *
+ * Description  :This function switches the backlight of the backpack on or off.
+ * I/P Arguments: unsigned char-->1 for on, 0 for off.
+ * Return value : none
+ *
+ */
+void LCD_Backlight ( unsigned char on ) ;
+
+#endif /* LCD_I2C_H_ */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\LCD_I2C.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
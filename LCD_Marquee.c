@@ -0,0 +1,261 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\LCD_Marquee.c
+//
+// summary:	LCD marquee class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * LCD_Marquee.c
+ *
+ *
+ * |_______AVR LCD non-blocking marquee library_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 09:14:05
+ *
+ * Filename: LCD_Marquee.c
+ * Controller: Atmega8/16/32/128
+ * Oscillator: 1 MHz
+ * Author: Mohammad Sadr
+ * Reference: HD44780 dataSheet
+ *
+ * Note:
+ *
+ *		The HD44780 display-shift command(0x18/0x1C) moves both lines together,
+ *		so independent speeds per line are done with a shadow copy of each line instead.
+ *		A step of a scrolling text changes most of the 16 chars, but a short message
+ *		followed by BlankSpaces only costs the chars which really changed.
+ *		Each LCD write waits about 1ms, so a full line is 16-17 ms. LCD_MarqueeTick() writes at most
+ *		MarqueeWrites times and the step goes on from the next column on the next call.
+ *
+ */
+
+#include <avr/io.h>
+#include <avr/pgmspace.h>
+#include "Configuration.h"
+#include "LCD_4_bit.h"
+#include "LCD_Marquee.h"
+
+/* 16x2 LCD Specification */
+#define LCDMaxLines				 2
+#define LCDMaxChars				16
+#define LineOne					0x80
+
+#define BlankSpace				' '
+
+#define CursorOff				0x0c		// Display ON cursor OFF
+#define CursorOn				0x0e		// Display ON cursor ON
+
+#define UnknownChar				0x00		// Shadow value which never matches a displayed char
+#define MarqueeWrites			4			// LCD writes per LCD_MarqueeTick(), 1ms each(a cursor move and 3 chars)
+
+typedef struct
+	{
+		const char *msg_ptr ;		// Message being scrolled, 0 if the line is stopped
+		const char *draw_ptr ;		// Message char of the next column to draw
+		unsigned char pos ;			// Index of the first char shown by the next step
+		unsigned char col ;			// Next column to draw, LCDMaxChars when the step is drawn
+		unsigned char period ;		// Ticks per char step
+		unsigned char count ;		// Ticks left till the next step
+		unsigned char flash ;		// 1 if msg_ptr points to flash(PROGMEM)
+	} MarqueeLine ;
+
+static MarqueeLine marquee [ LCDMaxLines ] ;
+static char shadow [ LCDMaxLines ] [ LCDMaxChars ] ;	// Chars currently shown on the LCD
+
+/* Reads one char of the message of a line from SRAM or flash */
+static char LCD_MarqueeChar ( unsigned char line , const char *ptr )
+	{
+		return marquee [ line ].flash ? pgm_read_byte ( ptr ) : *ptr ;
+	}
+
+/* Starts the next step of a line: the chars from msg_ptr[pos], after the last char a blank line */
+static void LCD_MarqueeNext ( unsigned char line )
+	{
+		MarqueeLine *line_ptr = &marquee [ line ] ;
+
+		line_ptr->draw_ptr = line_ptr->msg_ptr + line_ptr->pos ;
+		line_ptr->col = 0 ;
+		if ( LCD_MarqueeChar ( line , line_ptr->draw_ptr ) )
+			line_ptr->pos++ ;
+		else
+			line_ptr->pos = 0 ;		// The last char has scrolled out, start the message again from the first char
+	}
+
+/*
+ *
+ * Description  :This function draws the step of a line from its next column, with at most writes LCD writes.
+ *		Chars equal to the shadow copy are skipped, the cursor is moved only when a gap was skipped.
+ *		It stops before a char it has no writes left for, the next call goes on from there.
+ * I/P Arguments: unsigned char-->line number, unsigned char-->LCD writes allowed.
+ * Return value : unsigned char-->LCD writes left.
+ *
+ */
+static unsigned char LCD_MarqueeDraw ( unsigned char line , unsigned char writes )
+	{
+		MarqueeLine *line_ptr = &marquee [ line ] ;
+		unsigned char cursor = LCDMaxChars ;		// cursor=LCDMaxChars -> position unknown
+		char ch , shown ;
+
+		while ( line_ptr->col < LCDMaxChars )
+			{
+				ch = LCD_MarqueeChar ( line , line_ptr->draw_ptr ) ;
+				shown = ch ? ch : BlankSpace ;		// After the Null char the rest of the line is blank
+
+				if ( shadow [ line ] [ line_ptr->col ] != shown )
+					{
+						if ( writes < ( ( cursor != line_ptr->col ) ? 2 : 1 ) )
+							break ;						// Drawn on the next call from this column
+						if ( cursor != line_ptr->col )
+							{
+								LCD_CmdWrite ( LineOne + ( line << 6 ) + line_ptr->col ) ;	// Move the Cursor to the changed char
+								writes-- ;
+							}
+
+						LCD_DataWrite ( shown ) ;
+						writes-- ;
+						shadow [ line ] [ line_ptr->col ] = shown ;
+						cursor = line_ptr->col + 1 ;	// LCD increments the address after each data write
+					}
+
+				if ( ch )
+					line_ptr->draw_ptr++ ;				// Stay on the Null char
+				line_ptr->col++ ;
+			}
+		return writes ;
+	}
+
+/* Starts a line on a message in SRAM(flash=0) or flash(flash=1), an empty message is ignored */
+static void LCD_MarqueeBegin ( unsigned char line , const char *msg_ptr , unsigned char period , unsigned char flash )
+	{
+		unsigned char col ;
+
+		if ( ( line >= LCDMaxLines ) || ( ( flash ? pgm_read_byte ( msg_ptr ) : msg_ptr [ 0 ] ) == 0 ) )
+			return ;
+
+		for ( col = 0 ; col < LCDMaxChars ; col++ )
+			shadow [ line ] [ col ] = UnknownChar ;	// Force a full redraw on the first step
+
+		marquee [ line ].msg_ptr = msg_ptr ;
+		marquee [ line ].flash = flash ;
+		marquee [ line ].pos = 0 ;
+		marquee [ line ].col = LCDMaxChars ;		// No step being drawn
+		marquee [ line ].period = period ? period : 1 ;
+		marquee [ line ].count = 1 ;			// Start the first step on the next tick
+
+		LCD_CmdWrite ( CursorOff ) ;			 //Disable the Cursor
+	}
+
+/*
+ *
+ * Description  :This function starts scrolling a message on the given line.
+ *		The message is not copied, so it must stay valid while the line is scrolling.
+ *		After the last char has scrolled out, the message starts again from the first char.
+ * I/P Arguments:
+ *		1- unsigned char-->line number(line1=0, line2=1).
+ *		2- char*-->message to be scrolled.
+ *		3- unsigned char-->number of LCD_MarqueeTick() calls per one char step(1-255), longer when
+ *		   drawing the step takes more calls.
+ * Return value : none
+ *
+ */
+void LCD_MarqueeStart ( unsigned char line , const char *msg_ptr , unsigned char period )
+	{
+		LCD_MarqueeBegin ( line , msg_ptr , period , 0 ) ;
+	}
+
+/*
+ *
+ * Description  :This function starts scrolling a message stored in flash(PROGMEM) on the given line,
+ *		like LCD_MarqueeStart(). Each step reads the 16 chars with pgm_read_byte(), so the message needs no SRAM.
+ * I/P Arguments:
+ *		1- unsigned char-->line number(line1=0, line2=1).
+ *		2- const char*-->address of the message in flash.
+ *		3- unsigned char-->number of LCD_MarqueeTick() calls per one char step(1-255), longer when
+ *		   drawing the step takes more calls.
+ * Return value : none
+ *
+ */
+void LCD_MarqueeStart_P ( unsigned char line , const char *msg_ptr , unsigned char period )
+	{
+		LCD_MarqueeBegin ( line , msg_ptr , period , 1 ) ;
+	}
+
+/*
+ *
+ * Description  :This function stops scrolling on the given line.
+ *		The last displayed chars are left on the LCD.
+ *		The cursor is enabled again once all the lines are stopped.
+ * I/P Arguments: unsigned char-->line number(line1=0, line2=1).
+ * Return value : none
+ *
+ */
+void LCD_MarqueeStop ( unsigned char line )
+	{
+		unsigned char i ;
+
+		if ( line >= LCDMaxLines )
+			return ;
+
+		marquee [ line ].msg_ptr = 0 ;
+
+		for ( i = 0 ; i < LCDMaxLines ; i++ )
+			if ( marquee [ i ].msg_ptr )
+				return ;
+
+		LCD_CmdWrite ( CursorOn ) ;			  //Enable the Cursor
+	}
+
+/*
+ *
+ * Description  :This function advances every running line whose period has elapsed by one char.
+ *		Only the chars which differ from the shadow copy are written to the LCD, at most MarqueeWrites(4)
+ *		LCD writes per call(about 4ms), the rest of a step is drawn on the next calls.
+ *		A new step starts when the period has elapsed and the previous step is drawn.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void LCD_MarqueeTick ( )
+	{
+		unsigned char line , writes = MarqueeWrites ;
+
+		for ( line = 0 ; line < LCDMaxLines ; line++ )
+			{
+				if ( ! marquee [ line ].msg_ptr )
+					continue ;
+				if ( marquee [ line ].count )
+					marquee [ line ].count-- ;
+				if ( marquee [ line ].col == LCDMaxChars && marquee [ line ].count == 0 )
+					{
+						marquee [ line ].count = marquee [ line ].period ;
+						LCD_MarqueeNext ( line ) ;
+					}
+				writes = LCD_MarqueeDraw ( line , writes ) ;
+			}
+	}
+
+/*
+ *
+ * Description  :This function marks the shadow copy of all lines as unknown.
+ *		Call it after the LCD has been cleared or written by other functions,
+ *		so the next step redraws the complete line.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void LCD_MarqueeInvalidate ( )
+	{
+		unsigned char line , col ;
+
+		for ( line = 0 ; line < LCDMaxLines ; line++ )
+			for ( col = 0 ; col < LCDMaxChars ; col++ )
+				shadow [ line ] [ col ] = UnknownChar ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\LCD_Marquee.c
+////////////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
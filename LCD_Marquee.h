@@ -0,0 +1,106 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\LCD_Marquee.h
+//
+// summary:	Declares the LCD marquee class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * LCD_Marquee.h
+ *
+ *
+ * |_______AVR LCD non-blocking marquee library_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 09:14:05
+ *
+ * Filename: LCD_Marquee.h
+ * Controller: Atmega8/16/32/128
+ * Oscillator: 1 MHz
+ * Author: Mohammad Sadr
+ * Reference: HD44780 dataSheet
+ *
+ * Note:
+ *
+ *		Works on top of LCD_CmdWrite()/LCD_DataWrite(), so it can be linked with either LCD_4_bit.c or LCD_8_bit.c.
+ *		LCD_MarqueeTick() must be called periodically(ex: every 10ms from the main loop or a scheduler task).
+ *		Each line keeps a shadow copy of the 16 chars on the display and only the changed chars are sent,
+ *		at most 4 LCD writes(about 4ms) per call, so a step of a full line is drawn over up to 6 calls.
+ *
+ */
+
+#ifndef LCD_MARQUEE_H_
+#define LCD_MARQUEE_H_
+
+/*
+ *
+ * Description  :This function starts scrolling a message on the given line.
+ *		The message is not copied, so it must stay valid while the line is scrolling.
+ *		After the last char has scrolled out, the message starts again from the first char.
+ * I/P Arguments:
+ *		1- unsigned char-->line number(line1=0, line2=1).
+ *		2- char*-->message to be scrolled.
+ *		3- unsigned char-->number of LCD_MarqueeTick() calls per one char step(1-255), longer when
+ *		   drawing the step takes more calls.
+ * Return value : none
+ *
+ */
+void LCD_MarqueeStart ( unsigned char line , const char *msg_ptr , unsigned char period ) ;
+
+/*
+ *
+ * Description  :This function starts scrolling a message stored in flash(PROGMEM) on the given line,
+ *		like LCD_MarqueeStart(). Each step reads the 16 chars with pgm_read_byte(), so the message needs no SRAM.
+ *	ex:
+ *		static const char Banner [ ] PROGMEM = "Explore Embedded " ;
+ *		LCD_MarqueeStart_P ( 0 , Banner , 250 ) ;
+ * I/P Arguments:
+ *		1- unsigned char-->line number(line1=0, line2=1).
+ *		2- const char*-->address of the message in flash.
+ *		3- unsigned char-->number of LCD_MarqueeTick() calls per one char step(1-255), longer when
+ *		   drawing the step takes more calls.
+ * Return value : none
+ *
+ */
+void LCD_MarqueeStart_P ( unsigned char line , const char *msg_ptr , unsigned char period ) ;
+
+/*
+ *
+ * Description  :This function stops scrolling on the given line.
+ *		The last displayed chars are left on the LCD.
+ *		The cursor is enabled again once all the lines are stopped.
+ * I/P Arguments: unsigned char-->line number(line1=0, line2=1).
+ * Return value : none
+ *
+ */
+void LCD_MarqueeStop ( unsigned char line ) ;
+
+/*
+ *
+ * Description  :This function advances every running line whose period has elapsed by one char.
+ *		Only the chars which differ from the shadow copy are written to the LCD, at most 4 LCD writes
+ *		per call(about 4ms), the rest of a step is drawn on the next calls.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void LCD_MarqueeTick ( ) ;
+
+/*
+ *
+ * Description  :This function marks the shadow copy of all lines as unknown.
+ *		Call it after the LCD has been cleared or written by other functions,
+ *		so the next step redraws the complete line.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void LCD_MarqueeInvalidate ( ) ;
+
+#endif /* LCD_MARQUEE_H_ */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\LCD_Marquee.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -0,0 +1,204 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Profile.c
+//
+// summary:	Profile class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * Profile.c
+ *
+ *
+ * |_______AVR driver call profiling library_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 17:52:06
+ *
+ * Filename: Profile.c
+ * Controller: Atmega8/16/32/128
+ * Oscillator: 1 MHz
+ * Author: Mohammad Sadr
+ * Reference:Atmega32 dataSheet
+ *
+ * Note:
+ *
+ *		Nothing is compiled without PROFILE_ENABLE.
+ *		The counters are only updated from the main loop(the drivers are not called from interrupts).
+ *		The 32-bit time is read like SCHED_Counts(): an overflow which is pending while the interrupts
+ *		are disabled is added when TCNT1 was read after it.
+ *
+ */
+
+#include <avr/io.h>
+#include "Configuration.h"
+#include "Profile.h"
+
+#ifdef PROFILE_ENABLE
+
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+#include "UART.h"
+
+static ProfileStats Sites [ PROFILE_Sites ] ;
+static volatile unsigned int CyclesHigh ;		// Timer1 overflows
+static unsigned long Overhead ;				// Cycles of PROFILE_Now() itself
+static unsigned char Dumping ;				// The UART calls of PROFILE_Dump() are not counted
+
+ISR ( TIMER1_OVF_vect )
+	{
+		CyclesHigh++ ;
+	}
+
+/*
+ *
+ * Description  :This function starts the Timer1 cycle counter and clears the counters of all the sites.
+ *		Global interrupts are enabled.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void PROFILE_Init ( )
+	{
+		unsigned long start ;
+
+		TCCR1B = 0 ;							// Stop the timer while it is set up
+		TCCR1A = 0 ;							// Normal mode, OC1A/OC1B disconnected
+		TCNT1 = 0 ;
+		ATOMIC_BLOCK ( ATOMIC_RESTORESTATE )
+			{
+				CyclesHigh = 0 ;
+			}
+		TIFR = ( 1 << TOV1 ) ;
+		TIMSK |= ( 1 << TOIE1 ) ;
+		TCCR1B = ( 1 << CS10 ) ;				// F_CPU/1
+		sei ( ) ;
+
+		Overhead = 0 ;
+		start = PROFILE_Now ( ) ;
+		Overhead = PROFILE_Now ( ) - start ;
+		PROFILE_Reset ( ) ;
+	}
+
+/*
+ *
+ * Description  :This function clears the counters of all the sites.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void PROFILE_Reset ( )
+	{
+		unsigned char i ;
+
+		for ( i = 0 ; i < PROFILE_Sites ; i++ )
+			{
+				Sites [ i ].calls = 0 ;
+				Sites [ i ].min = 0xffffffff ;
+				Sites [ i ].max = 0 ;
+				Sites [ i ].total = 0 ;
+			}
+	}
+
+/*
+ *
+ * Description  :This function returns the number of CPU cycles since PROFILE_Init().
+ * I/P Arguments: none
+ * Return value : unsigned long-->cycles.
+ *
+ */
+unsigned long PROFILE_Now ( )
+	{
+		unsigned int high , low ;
+
+		ATOMIC_BLOCK ( ATOMIC_RESTORESTATE )
+			{
+				high = CyclesHigh ;
+				low = TCNT1 ;
+				if ( ( TIFR & ( 1 << TOV1 ) ) && low < 0x8000 )
+					high++ ;						// Overflow not served yet, TCNT1 was read after it
+			}
+		return ( ( unsigned long ) high << 16 ) | low ;
+	}
+
+/*
+ *
+ * Description  :This function adds one call to the counters of a site.
+ * I/P Arguments: unsigned char-->call site(PROFILE_UartTx...), unsigned long-->PROFILE_Now() at the start of the call.
+ * Return value : none
+ *
+ */
+void PROFILE_Record ( unsigned char site , unsigned long start )
+	{
+		unsigned long time = PROFILE_Now ( ) - start ;
+		ProfileStats *stats ;
+
+		if ( Dumping || site >= PROFILE_Sites )
+			return ;
+		time = ( time > Overhead ) ? time - Overhead : 0 ;
+		stats = &Sites [ site ] ;
+		if ( stats->calls != 0xffff )
+			stats->calls++ ;
+		if ( time < stats->min )
+			stats->min = time ;
+		if ( time > stats->max )
+			stats->max = time ;
+		stats->total += time ;
+	}
+
+/*
+ *
+ * Description  :This function copies the counters of a site.
+ * I/P Arguments: unsigned char-->call site, ProfileStats*-->where the counters are copied.
+ * Return value : none
+ *
+ */
+void PROFILE_GetStats ( unsigned char site , ProfileStats *stats )
+	{
+		if ( site < PROFILE_Sites )
+			*stats = Sites [ site ] ;
+	}
+
+/* Sends the bytes of a value, lower byte first, and adds them to the checksum */
+static void PROFILE_Send ( unsigned long value , unsigned char bytes , unsigned char *sum )
+	{
+		while ( bytes-- )
+			{
+				UART_TxChar ( ( char ) value ) ;
+				*sum += ( unsigned char ) value ;
+				value >>= 8 ;
+			}
+	}
+
+/*
+ *
+ * Description  :This function sends the counters of all the sites on the UART as one binary frame.
+ *		The UART must be initialized, the calls of the dump itself are not counted.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void PROFILE_Dump ( )
+	{
+		unsigned char i , sum = 0 ;
+
+		Dumping = 1 ;
+		UART_TxChar ( 'P' ) ;
+		PROFILE_Send ( PROFILE_Sites , 1 , &sum ) ;
+		for ( i = 0 ; i < PROFILE_Sites ; i++ )
+			{
+				PROFILE_Send ( Sites [ i ].calls , 2 , &sum ) ;
+				PROFILE_Send ( Sites [ i ].min , 4 , &sum ) ;
+				PROFILE_Send ( Sites [ i ].max , 4 , &sum ) ;
+				PROFILE_Send ( Sites [ i ].total , 4 , &sum ) ;
+			}
+		UART_TxChar ( ( char ) ( 0 - sum ) ) ;
+		Dumping = 0 ;
+	}
+
+#endif /* PROFILE_ENABLE */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Profile.c
+////////////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -0,0 +1,152 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Profile.h
+//
+// summary:	Declares the profile class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * Profile.h
+ *
+ *
+ * |_______AVR driver call profiling library_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 17:52:06
+ *
+ * Filename: Profile.h
+ * Controller: Atmega8/16/32/128
+ * Oscillator: 1 MHz
+ * Author: Mohammad Sadr
+ * Reference:Atmega32 dataSheet
+ *
+ * Note:
+ *
+ *		The blocking driver functions are timed when PROFILE_ENABLE is defined(Configuration.h or -D).
+ *		Without it every PROFILE_ macro is empty, so the drivers are compiled as if it was not there.
+ *		Timer1 counts the CPU cycles(prescaler 1) and its overflow interrupt extends it to 32 bits,
+ *		so Timer1 must not be used by the application while profiling(the Benchmark images use it too).
+ *
+ *		Call sites:
+ *			PROFILE_UartTx      -> UART_TxChar()
+ *			PROFILE_UartRx      -> UART_RxChar()
+ *			PROFILE_I2C         -> I2C_Start(), I2C_Stop(), I2C_Write() and I2C_Read()
+ *			PROFILE_Adc         -> ADC_StartConversion()
+ *			PROFILE_EepromWrite -> EEPROM_WriteByte()(the wait for the previous write is in it)
+ *			PROFILE_LcdWrite    -> LCD_CmdWrite() and LCD_DataWrite() of both LCD drivers
+ *
+ *		PROFILE_Dump() sends the counters on the UART as one binary frame, little endian:
+ *			'P' , number of sites ,
+ *			for each site: calls(2 bytes) , min(4) , max(4) , total(4) cycles ,
+ *			checksum(1 byte, the sum of all the bytes after 'P' and the checksum is 0).
+ *		The cycles of PROFILE_Now() itself are taken off each call.
+ *	ex:
+ *		PROFILE_Init ( ) ;
+ *		while ( 1 )
+ *			{
+ *				SCHED_Run ( ) ;
+ *				if ( KEYPAD_GetEvent ( &event ) )
+ *					PROFILE_Dump ( ) ;
+ *			}
+ *
+ */
+
+#ifndef PROFILE_H_
+#define PROFILE_H_
+
+#include "Configuration.h"
+
+#define PROFILE_UartTx			0
+#define PROFILE_UartRx			1
+#define PROFILE_I2C				2
+#define PROFILE_Adc				3
+#define PROFILE_EepromWrite		4
+#define PROFILE_LcdWrite		5
+#define PROFILE_Sites			6			// Number of call sites
+
+typedef struct
+	{
+		unsigned int calls ;			// Number of calls since PROFILE_Reset()
+		unsigned long min ;				// Shortest call in cycles, 0xffffffff before the first one
+		unsigned long max ;				// Longest call in cycles
+		unsigned long total ;			// Sum of all the calls in cycles
+	} ProfileStats ;
+
+#ifdef PROFILE_ENABLE
+
+/*
+ *
+ * Description  :This function starts the Timer1 cycle counter and clears the counters of all the sites.
+ *		Global interrupts are enabled.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void PROFILE_Init ( ) ;
+
+/*
+ *
+ * Description  :This function clears the counters of all the sites.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void PROFILE_Reset ( ) ;
+
+/*
+ *
+ * Description  :This function returns the number of CPU cycles since PROFILE_Init().
+ * I/P Arguments: none
+ * Return value : unsigned long-->cycles.
+ *
+ */
+unsigned long PROFILE_Now ( ) ;
+
+/*
+ *
+ * Description  :This function adds one call to the counters of a site.
+ * I/P Arguments: unsigned char-->call site(PROFILE_UartTx...), unsigned long-->PROFILE_Now() at the start of the call.
+ * Return value : none
+ *
+ */
+void PROFILE_Record ( unsigned char site , unsigned long start ) ;
+
+/*
+ *
+ * Description  :This function copies the counters of a site.
+ * I/P Arguments: unsigned char-->call site, ProfileStats*-->where the counters are copied.
+ * Return value : none
+ *
+ */
+void PROFILE_GetStats ( unsigned char site , ProfileStats *stats ) ;
+
+/*
+ *
+ * Description  :This function sends the counters of all the sites on the UART as one binary frame.
+ *		The UART must be initialized, the calls of the dump itself are not counted.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void PROFILE_Dump ( ) ;
+
+#define PROFILE_Begin( )			unsigned long profile_start = PROFILE_Now ( )
+#define PROFILE_End( site )			PROFILE_Record ( site , profile_start )
+
+#else
+
+#define PROFILE_Init( )
+#define PROFILE_Reset( )
+#define PROFILE_Dump( )
+#define PROFILE_Begin( )
+#define PROFILE_End( site )
+
+#endif /* PROFILE_ENABLE */
+
+#endif /* PROFILE_H_ */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Profile.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -0,0 +1,159 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Queue.h
+//
+// summary:	Declares the queue class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * Queue.h
+ *
+ *
+ * |_______AVR single producer single consumer queue library_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-20 00:12:51
+ *
+ * Filename: Queue.h
+ * Controller: Atmega8/16/32/128
+ * Oscillator: 8 MHz internal RC
+ * Author: Mohammad Sadr
+ *
+ * Note:
+ *
+ *		QUEUE_Define(name, type, size) declares a ring of size items(2 to 128, a power of two) and
+ *		its functions: name_Init(), name_Count(), name_Free(), name_Push(), name_Pop(), name_PushN() and name_PopN().
+ *		One side(ex: an ISR) only pushes and the other one(ex: the main loop) only pops, then no interrupt
+ *		has to be disabled: head is written by the producer only, tail by the consumer only, and both
+ *		are single bytes, which the other side reads in one instruction.
+ *
+ *		head and tail count the items pushed and popped modulo 256, the place of an item is the count
+ *		masked with size - 1. So head - tail is the number of items and all the size places are used,
+ *		none is kept free to tell a full ring from an empty one like with wrapped indexes.
+ *		An item is written before head is moved over it, and read before tail is moved over it, with
+ *		QUEUE_Barrier() in between so the compiler keeps that order(the items themselves are not volatile).
+ *		The items may be wider than a byte(ex: a struct), the other side never sees one half written.
+ *		name_PushN()/name_PopN() move as many items as fit and publish them with one index write.
+ *
+ *		QUEUE_Define() must be used at file scope, the functions are static inline in each user.
+ *	ex:
+ *		QUEUE_Define ( AdcQueue , unsigned int , 16 ) ;
+ *		static AdcQueue Samples ;
+ *
+ *		ISR ( ADC_vect )
+ *			{
+ *				AdcQueue_Push ( &Samples , ADC ) ;		// Dropped when full
+ *			}
+ *
+ *		while ( AdcQueue_Pop ( &Samples , &sample ) )
+ *			total += sample ;
+ *
+ */
+
+#ifndef QUEUE_H_
+#define QUEUE_H_
+
+/* Keeps the item accesses on their side of the index write, compiler only(one core, in order) */
+#ifndef QUEUE_Barrier
+#define QUEUE_Barrier( )		__asm__ __volatile__ ( "" : : : "memory" )
+#endif
+
+#define QueueInline				static inline
+
+#define QUEUE_Define( name , type , size )																\
+	typedef struct																						\
+		{																								\
+			volatile unsigned char head ;		/* Items pushed, written by the producer only */		\
+			volatile unsigned char tail ;		/* Items popped, written by the consumer only */		\
+			type items [ size ] ;																		\
+		} name ;																						\
+																										\
+	/* The size must be a power of two from 2 to 128 */													\
+	typedef char name##_SizeCheck [ ( ( size ) >= 2 && ( size ) <= 128 && ( ( size ) & ( ( size ) - 1 ) ) == 0 ) ? 1 : -1 ] ;	\
+																										\
+	/* Empties the queue, while neither side uses it */													\
+	QueueInline void name##_Init ( name *queue )														\
+		{																								\
+			queue->head = 0 ;																			\
+			queue->tail = 0 ;																			\
+		}																								\
+																										\
+	/* Items in the queue, exact for the consumer, at most for the producer */							\
+	QueueInline unsigned char name##_Count ( name *queue )												\
+		{																								\
+			return ( unsigned char ) ( queue->head - queue->tail ) ;									\
+		}																								\
+																										\
+	/* Free places, exact for the producer, at least for the consumer */								\
+	QueueInline unsigned char name##_Free ( name *queue )												\
+		{																								\
+			return ( size ) - name##_Count ( queue ) ;													\
+		}																								\
+																										\
+	/* Producer: returns 0 when the queue is full(the item is not pushed) */							\
+	QueueInline unsigned char name##_Push ( name *queue , type item )									\
+		{																								\
+			unsigned char head = queue->head ;															\
+																										\
+			if ( ( unsigned char ) ( head - queue->tail ) == ( size ) )									\
+				return 0 ;																				\
+			queue->items [ head & ( ( size ) - 1 ) ] = item ;											\
+			QUEUE_Barrier ( ) ;																			\
+			queue->head = head + 1 ;																	\
+			return 1 ;																					\
+		}																								\
+																										\
+	/* Consumer: returns 0 when the queue is empty */													\
+	QueueInline unsigned char name##_Pop ( name *queue , type *item )									\
+		{																								\
+			unsigned char tail = queue->tail ;															\
+																										\
+			if ( tail == queue->head )																	\
+				return 0 ;																				\
+			QUEUE_Barrier ( ) ;																			\
+			*item = queue->items [ tail & ( ( size ) - 1 ) ] ;											\
+			QUEUE_Barrier ( ) ;																			\
+			queue->tail = tail + 1 ;																	\
+			return 1 ;																					\
+		}																								\
+																										\
+	/* Producer: pushes the first count items which fit, returns how many */							\
+	QueueInline unsigned char name##_PushN ( name *queue , const type *items , unsigned char count )		\
+		{																								\
+			unsigned char head = queue->head , i ;														\
+			unsigned char room = ( size ) - ( unsigned char ) ( head - queue->tail ) ;					\
+																										\
+			if ( count > room )																			\
+				count = room ;																			\
+			for ( i = 0 ; i < count ; i++ )																\
+				queue->items [ ( unsigned char ) ( head + i ) & ( ( size ) - 1 ) ] = items [ i ] ;		\
+			QUEUE_Barrier ( ) ;																			\
+			queue->head = head + count ;																\
+			return count ;																				\
+		}																								\
+																										\
+	/* Consumer: pops up to count items, returns how many */											\
+	QueueInline unsigned char name##_PopN ( name *queue , type *items , unsigned char count )			\
+		{																								\
+			unsigned char tail = queue->tail , i ;														\
+			unsigned char used = ( unsigned char ) ( queue->head - tail ) ;								\
+																										\
+			if ( count > used )																			\
+				count = used ;																			\
+			QUEUE_Barrier ( ) ;																			\
+			for ( i = 0 ; i < count ; i++ )																\
+				items [ i ] = queue->items [ ( unsigned char ) ( tail + i ) & ( ( size ) - 1 ) ] ;		\
+			QUEUE_Barrier ( ) ;																			\
+			queue->tail = tail + count ;																\
+			return count ;																				\
+		}																								\
+																										\
+	typedef char name##_End				/* Takes the ; after QUEUE_Define() */
+
+#endif /* QUEUE_H_ */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Queue.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
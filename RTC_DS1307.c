@@ -28,7 +28,7 @@
 #include "Configuration.h"
 #include <util/delay.h>
 
-#include "RTC_ds1307.h"
+#include "RTC_DS1307.h"
 #include "I2C.h"
 
 /*
@@ -44,6 +44,8 @@
 #define DATE_ADDRESS	 0x04 // Address to access Ds1307 DATE register
 #define CONTROL			0x07       // Address to access Ds1307 CONTROL register
 
+static I2CRegCache Control ;		// The CONTROL register is only written by DS1307_SetControl()
+
 /*
  *
  * Description :This function is used to initialize the Ds1307 RTC.
@@ -56,14 +58,21 @@
 void DS1307_Init ( )
 	{
 		I2C_Init ( ) ;             // Initilize the I2c module.
-		I2C_Start ( ) ;            // Start I2C communication
-
-		I2C_Write ( DS1307_ID ) ;   // Connect to DS1307 by sending its ID on I2c Bus
-		I2C_Write ( CONTROL ) ;     // Select the Ds1307 ControlRegister to configure Ds1307
-
-		I2C_Write ( 0x00 ) ;        // Write 0x00 to Control register to disable SQW-Out
+		I2C_CacheInit ( &Control , DS1307_ID , CONTROL , 1 ) ;	// Value unknown, the first write is sent
+		DS1307_SetControl ( DS1307_SqwOff ) ;	// Write 0x00 to Control register to disable SQW-Out
+	}
 
-		I2C_Stop ( ) ;             // Stop I2C communication after initilizing DS1307
+/*
+ *
+ * Description  :This function writes the Control register(SQW/OUT pin), a write of the value it already has is dropped.
+ * I/P Arguments: unsigned char-->DS1307_SqwOff, DS1307_Sqw1Hz ... DS1307_Sqw32768Hz.
+ * Return value : none
+ *
+ */
+void DS1307_SetControl ( unsigned char control )
+	{
+		I2C_CacheWrite ( &Control , CONTROL , control ) ;
+		I2C_CacheFlush ( &Control ) ;
 	}
 
 /*
@@ -79,16 +88,9 @@ void DS1307_Init ( )
  */
 void DS1307_SetTime ( unsigned char hh , unsigned char mm , unsigned char ss )
 	{
-		I2C_Start ( ) ;            // Start I2C communication
-
-		I2C_Write ( DS1307_ID ) ;	// connect to DS1307 by sending its ID on I2c Bus
-		I2C_Write ( SEC_ADDRESS ) ; // Select the SEC RAM address
-
-		I2C_Write ( ss ) ;			// Write sec on RAM address 00H
-		I2C_Write ( mm ) ;			// Write min on RAM address 01H
-		I2C_Write ( hh ) ;			// Write hour on RAM address 02H
+		unsigned char time [ 3 ] = { ss , mm , hh } ;	// RAM address 00H, 01H, 02H
 
-		I2C_Stop ( ) ;           	// Stop I2C communication after Setting the Time
+		I2C_RegWrite ( DS1307_ID , SEC_ADDRESS , time , 3 ) ;
 	}
 
 /*
@@ -104,79 +106,95 @@ void DS1307_SetTime ( unsigned char hh , unsigned char mm , unsigned char ss )
  */
 void DS1307_SetDate(unsigned char dd , unsigned char mm , unsigned char yy)
 	{
-		I2C_Start ( ) ;            // Start I2C communication
+		unsigned char date [ 3 ] = { dd , mm , yy } ;	// RAM address 04H, 05H, 06H
 
-		I2C_Write ( DS1307_ID ) ;	// connect to DS1307 by sending its ID on I2c Bus
-		I2C_Write ( DATE_ADDRESS ) ;		// Request DAY RAM address at 04H
-
-		I2C_Write ( dd ) ;			// Write date on RAM address 04H
-		I2C_Write ( mm ) ;			// Write month on RAM address 05H
-		I2C_Write ( yy ) ;			// Write year on RAM address 06h
-
-		I2C_Stop ( ) ;				// Stop I2C communication after Setting the Date
+		I2C_RegWrite ( DS1307_ID , DATE_ADDRESS , date , 3 ) ;
 	}
 
 /*
  *
  * Description  :This function is used to get the Time(hh,mm,ss) from Ds1307 RTC.
  *		Ds1307 IC is enabled by sending the DS1307 id on the I2C bus.
- *		After selecting DS1307, select the RAM address 0x00 to point to sec.
- *		Get Sec, MIN, Hour one after the other.
+ *		After selecting DS1307, select the RAM address 0x00 to point to sec, repeated start in read mode and
+ *		get Sec, MIN, Hour one after the other.
  *		Stop the I2c communication.
- * I/P Arguments: char *,char *,char *-->pointers to get the hh,mm,ss.
+ * I/P Arguments: char *,char *,char *-->pointers to get the hh,mm,ss, 0xff when the DS1307 does not answer.
  * Return value : none
  *
  */
 void DS1307_GetTime ( unsigned char *h_ptr , unsigned char *m_ptr , unsigned char *s_ptr )
 	{
-		I2C_Start ( ) ;             // Start I2C communication
+		unsigned char time [ 3 ] ;
 
-		I2C_Write ( DS1307_ID ) ;	 // connect to DS1307 by sending its ID on I2c Bus
-		I2C_Write ( SEC_ADDRESS ) ; // Request Sec RAM address at 00H
-
-		I2C_Stop ( ) ;			// Stop I2C communication after selecting Sec Register
-
-		I2C_Start ( ) ;		        // Start I2C communication
-		I2C_Write ( 0xD1 ) ;	        // connect to DS1307( under Read mode)
-		//by sending its ID on I2c Bus
-
-		*s_ptr = I2C_Read ( 1 ) ;      // read second and return Positive ACK
-		*m_ptr = I2C_Read ( 1 ) ; 	// read minute and return Positive ACK
-		*h_ptr = I2C_Read ( 0 ) ;      // read hour and return Negative/No ACK
-
-		I2C_Stop ( ) ;		       // Stop I2C communication after reading the Time
+		I2C_RegRead ( DS1307_ID , SEC_ADDRESS , time , 3 ) ;	// Sec, min, hour from RAM address 00H
+		*s_ptr = time [ 0 ] ;
+		*m_ptr = time [ 1 ] ;
+		*h_ptr = time [ 2 ] ;
 	}
 
 /*
  *
  * Description  :This function is used to get the Date(y,m,d) from Ds1307 RTC.
  *		Ds1307 IC is enabled by sending the DS1307 id on the I2C bus.
- *		After selecting DS1307, select the RAM address 0x00 to point to DAY.
- *		Get Day, Month, Year one after the other.
+ *		After selecting DS1307, select the RAM address 0x00 to point to DAY, repeated start in read mode and
+ *		get Day, Month, Year one after the other.
  *		Stop the I2c communication.
- * I/P Arguments: char *,char *,char *-->pointers to get the y,m,d.
+ * I/P Arguments: char *,char *,char *-->pointers to get the y,m,d, 0xff when the DS1307 does not answer.
  * Return value : none
  *
  */
 void DS1307_GetDate ( unsigned char *d_ptr , unsigned char *m_ptr , unsigned char *y_ptr )
 	{
-		I2C_Start ( ) ;             // Start I2C communication
-
-		I2C_Write ( DS1307_ID ) ;	// connect to DS1307 by sending its ID on I2c Bus
-		I2C_Write ( DATE_ADDRESS ) ;		// Request DAY RAM address at 04H
-
-		I2C_Stop ( ) ;			 // Stop I2C communication after selecting DAY Register
-
+		unsigned char date [ 3 ] ;
 
-		I2C_Start ( ) ;		        // Start I2C communication
-		I2C_Write ( 0xD1 ) ;	        // connect to DS1307( under Read mode)
-		// by sending its ID on I2c Bus
-
-		*d_ptr = I2C_Read ( 1 ) ;       // read Day and return Positive ACK
-		*m_ptr = I2C_Read ( 1 ) ;       // read Month and return Positive ACK
-		*y_ptr = I2C_Read ( 0 ) ;       // read Year and return Negative/No ACK
+		I2C_RegRead ( DS1307_ID , DATE_ADDRESS , date , 3 ) ;	// Day, month, year from RAM address 04H
+		*d_ptr = date [ 0 ] ;
+		*m_ptr = date [ 1 ] ;
+		*y_ptr = date [ 2 ] ;
+	}
 
-		I2C_Stop ( ) ;		       // Stop I2C communication after reading the Time
+/*
+ *
+ * Description  :This function gets the Time(hh,mm,ss) from Ds1307 RTC like DS1307_GetTime(), as a coroutine.
+ *		It returns CO_Waiting instead of waiting for each I2C byte, so other tasks run during the transfer.
+ *		It must be called with the same pointers till it returns CO_Done, the time is valid after that.
+ *	ex:
+ *		while ( DS1307_GetTimeCo ( &rtc_co , &hour , &min , &sec ) == CO_Waiting )
+ *			SCHED_Run ( ) ;
+ * I/P Arguments: Coroutine*-->coroutine state, char *,char *,char *-->pointers to get the hh,mm,ss.
+ * Return value : char-->CO_Waiting or CO_Done.
+ *
+ */
+char DS1307_GetTimeCo ( Coroutine *co , unsigned char *h_ptr , unsigned char *m_ptr , unsigned char *s_ptr )
+	{
+		CO_Begin ( co ) ;
+		I2C_StartNoWait ( ) ;						// Start I2C communication
+		CO_WaitUntil ( co , I2C_Ready ( ) ) ;
+		I2C_WriteNoWait ( DS1307_ID ) ;				// connect to DS1307 by sending its ID on I2c Bus
+		CO_WaitUntil ( co , I2C_Ready ( ) ) ;
+		I2C_WriteNoWait ( SEC_ADDRESS ) ;			// Request Sec RAM address at 00H
+		CO_WaitUntil ( co , I2C_Ready ( ) ) ;
+		I2C_StopNoWait ( ) ;
+		CO_WaitUntil ( co , I2C_Stopped ( ) ) ;
+
+		I2C_StartNoWait ( ) ;
+		CO_WaitUntil ( co , I2C_Ready ( ) ) ;
+		I2C_WriteNoWait ( 0xD1 ) ;					// connect to DS1307( under Read mode)
+		CO_WaitUntil ( co , I2C_Ready ( ) ) ;
+
+		I2C_ReadNoWait ( 1 ) ;						// read second and return Positive ACK
+		CO_WaitUntil ( co , I2C_Ready ( ) ) ;
+		*s_ptr = I2C_Data ( ) ;
+		I2C_ReadNoWait ( 1 ) ;						// read minute and return Positive ACK
+		CO_WaitUntil ( co , I2C_Ready ( ) ) ;
+		*m_ptr = I2C_Data ( ) ;
+		I2C_ReadNoWait ( 0 ) ;						// read hour and return Negative/No ACK
+		CO_WaitUntil ( co , I2C_Ready ( ) ) ;
+		*h_ptr = I2C_Data ( ) ;
+
+		I2C_StopNoWait ( ) ;						// Stop I2C communication after reading the Time
+		CO_WaitUntil ( co , I2C_Stopped ( ) ) ;
+		CO_End ( co ) ;
 	}
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
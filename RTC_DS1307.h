@@ -27,6 +27,14 @@
 #ifndef RTC_DS1307_H_
 #define RTC_DS1307_H_
 
+#include "Coroutine.h"
+
+#define DS1307_SqwOff			0x00		// Control register: SQW/OUT pin low
+#define DS1307_Sqw1Hz			0x10
+#define DS1307_Sqw4096Hz		0x11
+#define DS1307_Sqw8192Hz		0x12
+#define DS1307_Sqw32768Hz		0x13
+
 /*
  *
  * Description :This function is used to initialize the Ds1307 RTC.
@@ -38,6 +46,15 @@
  */
 void DS1307_Init ( ) ;
 
+/*
+ *
+ * Description  :This function writes the Control register(SQW/OUT pin), a write of the value it already has is dropped.
+ * I/P Arguments: unsigned char-->DS1307_SqwOff, DS1307_Sqw1Hz ... DS1307_Sqw32768Hz.
+ * Return value : none
+ *
+ */
+void DS1307_SetControl ( unsigned char control ) ;
+
 /*
  *
  * Description  :This function is used to set Time(hh,mm,ss) into the Ds1307 RTC.
@@ -68,10 +85,10 @@ void DS1307_SetDate(unsigned char dd , unsigned char mm , unsigned char yy) ;
  *
  * Description  :This function is used to get the Time(hh,mm,ss) from Ds1307 RTC.
  *		Ds1307 IC is enabled by sending the DS1307 id on the I2C bus.
- *		After selecting DS1307, select the RAM address 0x00 to point to sec.
- *		Get Sec, MIN, Hour one after the other.
+ *		After selecting DS1307, select the RAM address 0x00 to point to sec, repeated start in read mode and
+ *		get Sec, MIN, Hour one after the other.
  *		Stop the I2c communication.
- * I/P Arguments: char *,char *,char *-->pointers to get the hh,mm,ss.
+ * I/P Arguments: char *,char *,char *-->pointers to get the hh,mm,ss, 0xff when the DS1307 does not answer.
  * Return value : none
  *
  */
@@ -81,15 +98,29 @@ void DS1307_GetTime ( unsigned char *h_ptr , unsigned char *m_ptr , unsigned cha
  *
  * Description  :This function is used to get the Date(y,m,d) from Ds1307 RTC.
  *		Ds1307 IC is enabled by sending the DS1307 id on the I2C bus.
- *		After selecting DS1307, select the RAM address 0x00 to point to DAY.
- *		Get Day, Month, Year one after the other.
+ *		After selecting DS1307, select the RAM address 0x00 to point to DAY, repeated start in read mode and
+ *		get Day, Month, Year one after the other.
  *		Stop the I2c communication.
- * I/P Arguments: char *,char *,char *-->pointers to get the y,m,d.
+ * I/P Arguments: char *,char *,char *-->pointers to get the y,m,d, 0xff when the DS1307 does not answer.
  * Return value : none
  *
  */
 void DS1307_GetDate ( unsigned char *d_ptr , unsigned char *m_ptr , unsigned char *y_ptr ) ;
 
+/*
+ *
+ * Description  :This function gets the Time(hh,mm,ss) from Ds1307 RTC like DS1307_GetTime(), as a coroutine.
+ *		It returns CO_Waiting instead of waiting for each I2C byte, so other tasks run during the transfer.
+ *		It must be called with the same pointers till it returns CO_Done, the time is valid after that.
+ *	ex:
+ *		while ( DS1307_GetTimeCo ( &rtc_co , &hour , &min , &sec ) == CO_Waiting )
+ *			SCHED_Run ( ) ;
+ * I/P Arguments: Coroutine*-->coroutine state, char *,char *,char *-->pointers to get the hh,mm,ss.
+ * Return value : char-->CO_Waiting or CO_Done.
+ *
+ */
+char DS1307_GetTimeCo ( Coroutine *co , unsigned char *h_ptr , unsigned char *m_ptr , unsigned char *s_ptr ) ;
+
 #endif /* RTC_DS1307_H_ */
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,326 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Scheduler.c
+//
+// summary:	Scheduler class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * Scheduler.c
+ *
+ *
+ * |_______AVR cooperative tick scheduler library_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 14:05:12
+ *
+ * Filename: Scheduler.c
+ * Controller: Atmega8/16/32/128
+ * Oscillator: 1 MHz
+ * Author: Mohammad Sadr
+ * Reference:Atmega32 dataSheet
+ *
+ * Note:
+ *
+ *		The interrupt only counts ms, the tasks are called from SCHED_Run().
+ *		Times are compared with a signed difference, so they are correct across the 16-bit wrap around
+ *		as long as periods and delays are below 32768 ms.
+ *		Run time is measured in Timer2 counts(F_CPU/prescaler), ex: 8us per count at 8 MHz.
+ *		A periodic task keeps its release times(due += period), so a late call does not shift the next ones.
+ *		If the task is still late after that, the release times up to now were missed: each of them is
+ *		counted as an overrun and the task is released again one period after now.
+ *
+ */
+
+#include <avr/io.h>
+#include "Configuration.h"
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+#include "Scheduler.h"
+
+/* Timer2 prescaler is selected to give at most 256 counts per ms */
+#if ( F_CPU / 8 / 1000 ) <= 256
+	#define TickPrescaler		( 1 << CS21 )					// F_CPU/8
+	#define TickCounts			( F_CPU / 8 / 1000 )
+#elif ( F_CPU / 64 / 1000 ) <= 256
+	#define TickPrescaler		( 1 << CS22 )					// F_CPU/64
+	#define TickCounts			( F_CPU / 64 / 1000 )
+#else
+	#define TickPrescaler		( ( 1 << CS22 ) | ( 1 << CS21 ) )	// F_CPU/256
+	#define TickCounts			( F_CPU / 256 / 1000 )
+#endif
+
+#define MaxTime					0xffff		// max_time saturates here
+#define CountsWrap				( 65536UL * TickCounts )	// SCHED_Counts() wraps with the ms counter
+
+typedef struct
+	{
+		SchedTask task ;			// 0 if the slot is free
+		unsigned int period ;		// 0 for a deadline(one shot) task
+		unsigned int due ;			// Next release time in ms
+		SchedStats stats ;
+	} SchedEntry ;
+
+static SchedEntry Tasks [ SCHED_MaxTasks ] ;
+static volatile unsigned int Millis ;
+
+/*
+ *
+ * Description  :Timer2 compare match interrupt, counts the ms.
+ *
+ */
+ISR ( TIMER2_COMP_vect )
+	{
+		Millis++ ;
+	}
+
+/*
+ *
+ * Description  :This function starts the 1ms tick on Timer2 and clears the task table.
+ *		Global interrupts are enabled.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void SCHED_Init ( )
+	{
+		unsigned char i ;
+
+		for ( i = 0 ; i < SCHED_MaxTasks ; i++ )
+			Tasks [ i ].task = 0 ;
+
+		ATOMIC_BLOCK ( ATOMIC_RESTORESTATE )
+			{
+				Millis = 0 ;
+			}
+
+		TCCR2 = 0 ;							// Stop the timer while it is set up
+		TCNT2 = 0 ;
+		OCR2 = TickCounts - 1 ;				// CTC: TCNT2 is cleared after OCR2, TickCounts counts per ms
+		TIFR = ( 1 << OCF2 ) ;				// Clear a pending compare flag
+		TIMSK |= ( 1 << OCIE2 ) ;
+		TCCR2 = ( 1 << WGM21 ) | TickPrescaler ;
+		sei ( ) ;
+	}
+
+/*
+ *
+ * Description  :This function fills a free slot of the task table.
+ * I/P Arguments: SchedTask-->function, unsigned int-->period(0 for one shot), unsigned int-->delay before the first call.
+ * Return value : unsigned char-->task id, SCHED_NoTask if the table is full.
+ *
+ */
+static unsigned char SCHED_Add ( SchedTask task , unsigned int period_ms , unsigned int delay_ms )
+	{
+		unsigned char id ;
+		SchedEntry *entry ;
+
+		for ( id = 0 ; id < SCHED_MaxTasks ; id++ )
+			if ( Tasks [ id ].task == 0 )
+				break ;
+		if ( id == SCHED_MaxTasks )
+			return SCHED_NoTask ;
+
+		entry = &Tasks [ id ] ;
+		entry->period = period_ms ;
+		entry->due = SCHED_Millis ( ) + delay_ms ;
+		entry->stats.runs = 0 ;
+		entry->stats.overruns = 0 ;
+		entry->stats.max_time = 0 ;
+		entry->stats.total_time = 0 ;
+		entry->task = task ;				// Set last, the slot is used from now on
+
+		return id ;
+	}
+
+/*
+ *
+ * Description  :This function adds a task which is called every period_ms.
+ * I/P Arguments:
+ *		1- SchedTask-->function to be called.
+ *		2- unsigned int-->period in ms(1-32767).
+ *		3- unsigned int-->delay before the first call in ms, used to spread tasks with the same period.
+ * Return value : unsigned char-->task id, SCHED_NoTask if the table is full.
+ *
+ */
+unsigned char SCHED_AddPeriodic ( SchedTask task , unsigned int period_ms , unsigned int offset_ms )
+	{
+		if ( period_ms == 0 )
+			period_ms = 1 ;
+		return SCHED_Add ( task , period_ms , offset_ms ) ;
+	}
+
+/*
+ *
+ * Description  :This function adds a task which is called once after delay_ms(deadline task).
+ *		The task slot is freed before the task is called, so the task may add itself again.
+ * I/P Arguments: SchedTask-->function to be called, unsigned int-->delay in ms(0-32767).
+ * Return value : unsigned char-->task id, SCHED_NoTask if the table is full.
+ *
+ */
+unsigned char SCHED_AddDeadline ( SchedTask task , unsigned int delay_ms )
+	{
+		return SCHED_Add ( task , 0 , delay_ms ) ;
+	}
+
+/*
+ *
+ * Description  :This function removes a task from the task table.
+ * I/P Arguments: unsigned char-->task id.
+ * Return value : none
+ *
+ */
+void SCHED_Remove ( unsigned char id )
+	{
+		if ( id < SCHED_MaxTasks )
+			Tasks [ id ].task = 0 ;
+	}
+
+/*
+ *
+ * Description  :This function calls every task which is due and updates its statistics.
+ *		It should be called from the main loop as often as possible.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void SCHED_Run ( )
+	{
+		unsigned char id ;
+		unsigned int now ;
+		unsigned long start , time ;
+		SchedEntry *entry ;
+		SchedTask task ;
+
+		for ( id = 0 ; id < SCHED_MaxTasks ; id++ )
+			{
+				entry = &Tasks [ id ] ;
+				task = entry->task ;
+				now = SCHED_Millis ( ) ;
+
+				if ( ( task == 0 ) || ( ( int ) ( now - entry->due ) < 0 ) )
+					continue ;
+
+				if ( entry->period )
+					{
+						entry->due += entry->period ;
+						if ( ( int ) ( now - entry->due ) >= 0 )	// Still late, whole periods were missed
+							{
+								entry->stats.overruns += ( now - entry->due ) / entry->period + 1 ;
+								entry->due = now + entry->period ;
+							}
+					}
+				else
+					entry->task = 0 ;					// Deadline task, free the slot before the call
+
+				start = SCHED_Counts ( ) ;
+				task ( ) ;
+				time = SCHED_Counts ( ) ;
+				if ( time < start )						// The ms counter wrapped around
+					time += CountsWrap ;
+				time -= start ;
+
+				// Skip the statistics if a periodic task removed itself
+				if ( ( entry->task == task ) || ( ( entry->task == 0 ) && ( entry->period == 0 ) ) )
+					{
+						entry->stats.runs++ ;
+						entry->stats.total_time += time ;
+						if ( time > MaxTime )
+							time = MaxTime ;
+						if ( time > entry->stats.max_time )
+							entry->stats.max_time = ( unsigned int ) time ;
+					}
+			}
+	}
+
+/*
+ *
+ * Description  :This function returns the ms tick counter. It wraps around every 65.536 seconds.
+ * I/P Arguments: none
+ * Return value : unsigned int-->ms since SCHED_Init().
+ *
+ */
+unsigned int SCHED_Millis ( )
+	{
+		unsigned int ms ;
+
+		ATOMIC_BLOCK ( ATOMIC_RESTORESTATE )
+			{
+				ms = Millis ;
+			}
+		return ms ;
+	}
+
+/*
+ *
+ * Description  :This function checks whether ms have passed since start, it is used instead of _delay_ms().
+ *	ex:
+ *		start = SCHED_Millis ( ) ;
+ *		...
+ *		if ( SCHED_Elapsed ( start , 50 ) ) { next step }
+ * I/P Arguments: unsigned int-->start time from SCHED_Millis(), unsigned int-->ms(0-32767).
+ * Return value : unsigned char-->1 if the time has passed, 0 otherwise.
+ *
+ */
+unsigned char SCHED_Elapsed ( unsigned int start , unsigned int ms )
+	{
+		return ( unsigned int ) ( SCHED_Millis ( ) - start ) >= ms ;
+	}
+
+/*
+ *
+ * Description  :This function returns the time since SCHED_Init() in timer counts(SCHED_CountsPerMs counts per ms).
+ *		If the compare match happened while the interrupts are disabled, the ms is not counted yet,
+ *		so the pending flag is checked and the counter is read again.
+ * I/P Arguments: none
+ * Return value : unsigned long-->timer counts.
+ *
+ */
+unsigned long SCHED_Counts ( )
+	{
+		unsigned int ms ;
+		unsigned char count ;
+
+		ATOMIC_BLOCK ( ATOMIC_RESTORESTATE )
+			{
+				ms = Millis ;
+				count = TCNT2 ;
+				if ( TIFR & ( 1 << OCF2 ) )
+					{
+						count = TCNT2 ;
+						ms++ ;
+					}
+			}
+		return ( unsigned long ) ms * TickCounts + count ;
+	}
+
+/*
+ *
+ * Description  :This function copies the run time and overrun statistics of a task.
+ * I/P Arguments: unsigned char-->task id, SchedStats*-->statistics to be filled.
+ * Return value : none
+ *
+ */
+void SCHED_GetStats ( unsigned char id , SchedStats *stats_ptr )
+	{
+		if ( id < SCHED_MaxTasks )
+			*stats_ptr = Tasks [ id ].stats ;
+	}
+
+/*
+ *
+ * Description  :This function returns the number of timer counts per ms, the unit of max_time and total_time.
+ * I/P Arguments: none
+ * Return value : unsigned int-->timer counts per ms.
+ *
+ */
+unsigned int SCHED_CountsPerMs ( )
+	{
+		return TickCounts ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Scheduler.c
+////////////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
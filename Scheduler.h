@@ -0,0 +1,160 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Scheduler.h
+//
+// summary:	Declares the scheduler class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * Scheduler.h
+ *
+ *
+ * |_______AVR cooperative tick scheduler library_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 14:05:12
+ *
+ * Filename: Scheduler.h
+ * Controller: Atmega8/16/32/128
+ * Oscillator: 1 MHz
+ * Author: Mohammad Sadr
+ * Reference:Atmega32 dataSheet
+ *
+ * Note:
+ *
+ *		Timer2 is used in CTC mode to generate a 1ms tick(Timer0 has no compare unit on the Atmega8).
+ *		Tasks are plain functions which must return quickly(no _delay_ms), they are called from SCHED_Run()
+ *		in the main loop, never from the interrupt. A longer job is split into steps which keep their
+ *		state in static variables, and wait with SCHED_Elapsed() instead of _delay_ms().
+ *	ex:
+ *		SCHED_Init ( ) ;
+ *		SCHED_AddPeriodic ( KEYPAD_Tick , 1 , 0 ) ;
+ *		SCHED_AddPeriodic ( LCD_MarqueeTick , 10 , 5 ) ;
+ *		while ( 1 )
+ *			SCHED_Run ( ) ;
+ *
+ */
+
+#ifndef SCHEDULER_H_
+#define SCHEDULER_H_
+
+#define SCHED_MaxTasks			8			// Size of the task table
+#define SCHED_NoTask			0xff		// Returned when the task table is full
+
+typedef void ( *SchedTask ) ( void ) ;
+
+typedef struct
+	{
+		unsigned int runs ;				// Number of times the task was called
+		unsigned int overruns ;			// Number of periods missed because the task was started too late
+		unsigned int max_time ;			// Longest run time in timer counts(see SCHED_CountsPerMs)
+		unsigned long total_time ;		// Sum of all the run times in timer counts
+	} SchedStats ;
+
+/*
+ *
+ * Description  :This function starts the 1ms tick on Timer2 and clears the task table.
+ *		Global interrupts are enabled.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void SCHED_Init ( ) ;
+
+/*
+ *
+ * Description  :This function adds a task which is called every period_ms.
+ * I/P Arguments:
+ *		1- SchedTask-->function to be called.
+ *		2- unsigned int-->period in ms(1-32767).
+ *		3- unsigned int-->delay before the first call in ms, used to spread tasks with the same period.
+ * Return value : unsigned char-->task id, SCHED_NoTask if the table is full.
+ *
+ */
+unsigned char SCHED_AddPeriodic ( SchedTask task , unsigned int period_ms , unsigned int offset_ms ) ;
+
+/*
+ *
+ * Description  :This function adds a task which is called once after delay_ms(deadline task).
+ *		The task slot is freed before the task is called, so the task may add itself again.
+ * I/P Arguments: SchedTask-->function to be called, unsigned int-->delay in ms(0-32767).
+ * Return value : unsigned char-->task id, SCHED_NoTask if the table is full.
+ *
+ */
+unsigned char SCHED_AddDeadline ( SchedTask task , unsigned int delay_ms ) ;
+
+/*
+ *
+ * Description  :This function removes a task from the task table.
+ * I/P Arguments: unsigned char-->task id.
+ * Return value : none
+ *
+ */
+void SCHED_Remove ( unsigned char id ) ;
+
+/*
+ *
+ * Description  :This function calls every task which is due and updates its statistics.
+ *		It should be called from the main loop as often as possible.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void SCHED_Run ( ) ;
+
+/*
+ *
+ * Description  :This function returns the ms tick counter. It wraps around every 65.536 seconds.
+ * I/P Arguments: none
+ * Return value : unsigned int-->ms since SCHED_Init().
+ *
+ */
+unsigned int SCHED_Millis ( ) ;
+
+/*
+ *
+ * Description  :This function checks whether ms have passed since start, it is used instead of _delay_ms().
+ *	ex:
+ *		start = SCHED_Millis ( ) ;
+ *		...
+ *		if ( SCHED_Elapsed ( start , 50 ) ) { next step }
+ * I/P Arguments: unsigned int-->start time from SCHED_Millis(), unsigned int-->ms(0-32767).
+ * Return value : unsigned char-->1 if the time has passed, 0 otherwise.
+ *
+ */
+unsigned char SCHED_Elapsed ( unsigned int start , unsigned int ms ) ;
+
+/*
+ *
+ * Description  :This function returns the time since SCHED_Init() in timer counts(SCHED_CountsPerMs counts per ms).
+ * I/P Arguments: none
+ * Return value : unsigned long-->timer counts.
+ *
+ */
+unsigned long SCHED_Counts ( ) ;
+
+/*
+ *
+ * Description  :This function copies the run time and overrun statistics of a task.
+ * I/P Arguments: unsigned char-->task id, SchedStats*-->statistics to be filled.
+ * Return value : none
+ *
+ */
+void SCHED_GetStats ( unsigned char id , SchedStats *stats_ptr ) ;
+
+/*
+ *
+ * Description  :This function returns the number of timer counts per ms, the unit of max_time and total_time.
+ * I/P Arguments: none
+ * Return value : unsigned int-->timer counts per ms.
+ *
+ */
+unsigned int SCHED_CountsPerMs ( ) ;
+
+#endif /* SCHEDULER_H_ */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Scheduler.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
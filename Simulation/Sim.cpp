@@ -0,0 +1,578 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Sim.cpp
+//
+// summary:	Simulator class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * Sim.cpp
+ *
+ *
+ * |_______Host simulation of the Atmega32 and its peripherals_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 16:02:18
+ *
+ * Filename: Sim.cpp
+ * Host: Linux g++(the drivers are compiled as C++)
+ * Author: Mohammad Sadr
+ * Reference:Atmega32 dataSheet
+ *
+ * Note:
+ *
+ *		Registers, simulated time, interrupt dispatch and the test result counters.
+ *		After sei() one more register access is done before an interrupt is called,
+ *		like the instruction after SEI on the AVR, so "sei ( ) ; sleep_cpu ( ) ;" can not lose a wake-up.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+#include <util/atomic.h>
+#include "Sim.h"
+
+#define SimMaxSteps				10000000UL		// Events at the same cycle before the simulator gives up
+#define SimInterruptCycles		4				// Interrupt response time
+
+/* Interrupt vectors, defined by the drivers with ISR() */
+extern "C" void INT0_vect ( void ) __attribute__ ( ( weak ) ) ;
+extern "C" void INT1_vect ( void ) __attribute__ ( ( weak ) ) ;
+extern "C" void INT2_vect ( void ) __attribute__ ( ( weak ) ) ;
+extern "C" void TIMER2_COMP_vect ( void ) __attribute__ ( ( weak ) ) ;
+extern "C" void TIMER2_OVF_vect ( void ) __attribute__ ( ( weak ) ) ;
+extern "C" void TIMER1_COMPA_vect ( void ) __attribute__ ( ( weak ) ) ;
+extern "C" void TIMER1_COMPB_vect ( void ) __attribute__ ( ( weak ) ) ;
+extern "C" void TIMER1_OVF_vect ( void ) __attribute__ ( ( weak ) ) ;
+extern "C" void USART_RXC_vect ( void ) __attribute__ ( ( weak ) ) ;
+extern "C" void USART_UDRE_vect ( void ) __attribute__ ( ( weak ) ) ;
+extern "C" void USART_TXC_vect ( void ) __attribute__ ( ( weak ) ) ;
+extern "C" void USART1_RX_vect ( void ) __attribute__ ( ( weak ) ) ;
+extern "C" void USART1_UDRE_vect ( void ) __attribute__ ( ( weak ) ) ;
+extern "C" void USART1_TX_vect ( void ) __attribute__ ( ( weak ) ) ;
+extern "C" void ADC_vect ( void ) __attribute__ ( ( weak ) ) ;
+extern "C" void TWI_vect ( void ) __attribute__ ( ( weak ) ) ;
+
+typedef struct
+	{
+		SimRegister *enable_reg ;
+		unsigned char enable_bit ;
+		SimRegister *flag_reg ;
+		unsigned char flag_bit ;
+		bool clear_flag ;				// Flag cleared by hardware when the ISR is called
+		void ( *isr ) ( void ) ;
+	} SimVector ;
+
+SimRegister PORTA ( "PORTA" ) , DDRA ( "DDRA" ) , PINA ( "PINA" ) ;
+SimRegister PORTB ( "PORTB" ) , DDRB ( "DDRB" ) , PINB ( "PINB" ) ;
+SimRegister PORTC ( "PORTC" ) , DDRC ( "DDRC" ) , PINC ( "PINC" ) ;
+SimRegister PORTD ( "PORTD" ) , DDRD ( "DDRD" ) , PIND ( "PIND" ) ;
+SimRegister UDR ( "UDR" ) , UCSRA ( "UCSRA" ) , UCSRB ( "UCSRB" ) , UCSRC ( "UCSRC" ) , UBRRH ( "UBRRH" ) , UBRRL ( "UBRRL" ) ;
+SimRegister UDR1 ( "UDR1" ) , UCSR1A ( "UCSR1A" ) , UCSR1B ( "UCSR1B" ) , UCSR1C ( "UCSR1C" ) , UBRR1H ( "UBRR1H" ) , UBRR1L ( "UBRR1L" ) ;
+SimRegister TWBR ( "TWBR" ) , TWSR ( "TWSR" ) , TWAR ( "TWAR" ) , TWDR ( "TWDR" ) , TWCR ( "TWCR" ) ;
+SimRegister ADMUX ( "ADMUX" ) , ADCSRA ( "ADCSRA" ) , ADCL ( "ADCL" ) , ADCH ( "ADCH" ) , SFIOR ( "SFIOR" ) ;
+SimRegister16 ADCW ( "ADCW" ) ;
+SimRegister EEDR ( "EEDR" ) , EECR ( "EECR" ) ;
+SimRegister16 EEAR ( "EEAR" ) ;
+SimRegister TCCR0 ( "TCCR0" ) , TCNT0 ( "TCNT0" ) , OCR0 ( "OCR0" ) ;
+SimRegister TCCR1A ( "TCCR1A" ) , TCCR1B ( "TCCR1B" ) ;
+SimRegister16 TCNT1 ( "TCNT1" ) , OCR1A ( "OCR1A" ) , OCR1B ( "OCR1B" ) , ICR1 ( "ICR1" ) ;
+SimRegister TCCR2 ( "TCCR2" ) , TCNT2 ( "TCNT2" ) , OCR2 ( "OCR2" ) , ASSR ( "ASSR" ) ;
+SimRegister TIMSK ( "TIMSK" ) , TIFR ( "TIFR" ) ;
+SimRegister SPCR ( "SPCR" ) , SPSR ( "SPSR" ) , SPDR ( "SPDR" ) ;
+SimRegister SREG ( "SREG" ) , MCUCR ( "MCUCR" ) , MCUCSR ( "MCUCSR" ) , GICR ( "GICR" ) , GIFR ( "GIFR" ) , OSCCAL ( "OSCCAL" ) , WDTCR ( "WDTCR" ) ;
+
+static SimRegister *const Registers [ ] =
+	{
+		&PORTA , &DDRA , &PINA , &PORTB , &DDRB , &PINB , &PORTC , &DDRC , &PINC , &PORTD , &DDRD , &PIND ,
+		&UDR , &UCSRA , &UCSRB , &UCSRC , &UBRRH , &UBRRL ,
+		&UDR1 , &UCSR1A , &UCSR1B , &UCSR1C , &UBRR1H , &UBRR1L ,
+		&TWBR , &TWSR , &TWAR , &TWDR , &TWCR ,
+		&ADMUX , &ADCSRA , &ADCL , &ADCH , &SFIOR ,
+		&EEDR , &EECR ,
+		&TCCR0 , &TCNT0 , &OCR0 , &TCCR1A , &TCCR1B , &TCCR2 , &TCNT2 , &OCR2 , &ASSR , &TIMSK , &TIFR ,
+		&SPCR , &SPSR , &SPDR ,
+		&SREG , &MCUCR , &MCUCSR , &GICR , &GIFR , &OSCCAL , &WDTCR
+	} ;
+
+static SimRegister16 *const Registers16 [ ] = { &ADCW , &EEAR , &TCNT1 , &OCR1A , &OCR1B , &ICR1 } ;
+
+/* In vector table order, the lower entry has the higher priority */
+static const SimVector Vectors [ ] =
+	{
+		{ &GICR , INT0 , &GIFR , INTF0 , true , INT0_vect } ,
+		{ &GICR , INT1 , &GIFR , INTF1 , true , INT1_vect } ,
+		{ &GICR , INT2 , &GIFR , INTF2 , true , INT2_vect } ,
+		{ &TIMSK , OCIE2 , &TIFR , OCF2 , true , TIMER2_COMP_vect } ,
+		{ &TIMSK , TOIE2 , &TIFR , TOV2 , true , TIMER2_OVF_vect } ,
+		{ &TIMSK , OCIE1A , &TIFR , OCF1A , true , TIMER1_COMPA_vect } ,
+		{ &TIMSK , OCIE1B , &TIFR , OCF1B , true , TIMER1_COMPB_vect } ,
+		{ &TIMSK , TOIE1 , &TIFR , TOV1 , true , TIMER1_OVF_vect } ,
+		{ &UCSRB , RXCIE , &UCSRA , RXC , false , USART_RXC_vect } ,		// Cleared by reading UDR
+		{ &UCSRB , UDRIE , &UCSRA , UDRE , false , USART_UDRE_vect } ,		// Cleared by writing UDR
+		{ &UCSRB , TXCIE , &UCSRA , TXC , true , USART_TXC_vect } ,
+		{ &ADCSRA , ADIE , &ADCSRA , ADIF , true , ADC_vect } ,
+		{ &UCSR1B , RXCIE , &UCSR1A , RXC , false , USART1_RX_vect } ,		// Second USART(SIM_USART1)
+		{ &UCSR1B , UDRIE , &UCSR1A , UDRE , false , USART1_UDRE_vect } ,
+		{ &UCSR1B , TXCIE , &UCSR1A , TXC , true , USART1_TX_vect } ,
+		{ &TWCR , TWIE , &TWCR , TWINT , false , TWI_vect }				// Cleared by writing one to TWINT
+	} ;
+
+static std::vector < SimModel * > Models ;
+static unsigned long long Now ;
+static unsigned long InterruptCount ;
+static bool SeiShadow ;
+static bool PowerDownSleep ;
+static unsigned long RcLow ;				// Sim_RcOscillator(), 0 for a CPU clock of F_CPU
+static unsigned long RcHigh ;
+static bool Installed ;
+static unsigned long Checks ;
+static unsigned long Failures ;
+
+/*
+ *
+ * Description  :This function calls the first enabled interrupt which has its flag set, till none is left.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+static void Sim_Dispatch ( )
+	{
+		unsigned char i ;
+		const SimVector *vector ;
+
+		while ( ( SREG.value & ( 1 << SREG_I ) ) && ! SeiShadow )
+			{
+				vector = 0 ;
+				for ( i = 0 ; i < sizeof ( Vectors ) / sizeof ( Vectors [ 0 ] ) ; i++ )
+					if ( Vectors [ i ].isr
+						&& ( Vectors [ i ].enable_reg->value & ( 1 << Vectors [ i ].enable_bit ) )
+						&& ( Vectors [ i ].flag_reg->value & ( 1 << Vectors [ i ].flag_bit ) ) )
+						{
+							vector = &Vectors [ i ] ;
+							break ;
+						}
+				if ( vector == 0 )
+					return ;
+
+				if ( vector->clear_flag )
+					vector->flag_reg->value &= ~ ( 1 << vector->flag_bit ) ;
+				SREG.value &= ~ ( 1 << SREG_I ) ;
+				InterruptCount++ ;
+				Sim_Advance ( SimInterruptCycles ) ;
+				vector->isr ( ) ;
+				SREG.value |= ( 1 << SREG_I ) ;		// RETI
+			}
+	}
+
+/*
+ *
+ * Description  :This function returns the cycle of the earliest model event.
+ * I/P Arguments: none
+ * Return value : unsigned long long-->cycle, SimNever if no model has an event.
+ *
+ */
+static unsigned long long Sim_NextEvent ( )
+	{
+		unsigned long long next = SimNever , event ;
+		unsigned int i ;
+
+		for ( i = 0 ; i < Models.size ( ) ; i++ )
+			{
+				event = Models [ i ]->NextEvent ( ) ;
+				if ( event < next )
+					next = event ;
+			}
+		return next ;
+	}
+
+/*
+ *
+ * Description  :This function updates every model at the current cycle.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+static void Sim_Update ( )
+	{
+		unsigned int i ;
+
+		for ( i = 0 ; i < Models.size ( ) ; i++ )
+			Models [ i ]->Update ( Now ) ;
+	}
+
+/*
+ *
+ * Description  :This function lets the simulated time run till the given cycle.
+ *		The models are updated at each of their events on the way and the interrupts are called.
+ *		An ISR may move the time further than the cycle, the time never goes back.
+ * I/P Arguments: unsigned long long-->cycle.
+ * Return value : none
+ *
+ */
+void Sim_AdvanceTo ( unsigned long long cycle )
+	{
+		unsigned long long next ;
+		unsigned long steps = 0 ;
+
+		if ( cycle > Now )
+			SeiShadow = false ;					// The instruction after sei() is in the time that runs
+		while ( ( next = Sim_NextEvent ( ) ) <= cycle )
+			{
+				if ( next > Now )
+					{
+						Now = next ;
+						steps = 0 ;
+					}
+				else if ( ++steps > SimMaxSteps )
+					{
+						fprintf ( stderr , "Sim: a model keeps its event at cycle %llu\n" , Now ) ;
+						exit ( 2 ) ;
+					}
+				Sim_Update ( ) ;
+				Sim_Dispatch ( ) ;
+			}
+		if ( cycle > Now )
+			Now = cycle ;
+		Sim_Update ( ) ;
+		Sim_Dispatch ( ) ;
+	}
+
+/*
+ *
+ * Description  :This function lets the simulated time run for a number of cycles.
+ * I/P Arguments: unsigned long-->cycles.
+ * Return value : none
+ *
+ */
+void Sim_Advance ( unsigned long cycles )
+	{
+		SeiShadow = false ;
+		Sim_AdvanceTo ( Now + cycles ) ;
+	}
+
+void Sim_AdvanceUs ( unsigned long us )
+	{
+		Sim_Advance ( ( unsigned long ) Sim_UsToCycles ( us ) ) ;
+	}
+
+unsigned long long Sim_UsToCycles ( unsigned long us )
+	{
+		return ( unsigned long long ) us * ( F_CPU / 1000000UL ) ;
+	}
+
+unsigned long long Sim_Now ( )
+	{
+		return Now ;
+	}
+
+unsigned long Sim_Interrupts ( )
+	{
+		return InterruptCount ;
+	}
+
+bool Sim_PowerDown ( )
+	{
+		return PowerDownSleep ;
+	}
+
+/*
+ *
+ * Description  :This function makes the CPU clock follow OSCCAL like the internal RC oscillator.
+ *		The simulated time is still counted in CPU cycles, a real second becomes Sim_CyclesPerSecond() cycles.
+ * I/P Arguments: unsigned long,unsigned long-->CPU clock(Hz) at OSCCAL 0x00 and at OSCCAL 0xFF.
+ * Return value : none
+ *
+ */
+void Sim_RcOscillator ( unsigned long low_hz , unsigned long high_hz )
+	{
+		RcLow = low_hz ;
+		RcHigh = high_hz ;
+	}
+
+unsigned long Sim_CyclesPerSecond ( )
+	{
+		if ( RcLow == 0 )
+			return F_CPU ;
+		return RcLow + ( unsigned long ) ( ( unsigned long long ) ( RcHigh - RcLow ) * OSCCAL.value / 255 ) ;
+	}
+
+/*
+ *
+ * Description  :sei(), the interrupts are called after the next register access.
+ *
+ */
+void Sim_Sei ( )
+	{
+		SREG.value |= ( 1 << SREG_I ) ;
+		SeiShadow = true ;
+	}
+
+/*
+ *
+ * Description  :cli(). The code between a sei() and the next cli() takes at least one instruction,
+ *		so the pending interrupts are called first(ex: two ATOMIC_BLOCK()s one after the other).
+ *
+ */
+void Sim_Cli ( )
+	{
+		SeiShadow = false ;
+		Sim_Dispatch ( ) ;
+		SREG.value &= ~ ( 1 << SREG_I ) ;
+	}
+
+/*
+ *
+ * Description  :sleep_cpu(), the time runs from event to event till an ISR is called.
+ *		Nothing happens if SE is not set. In the power down, power save and standby modes the timers stop.
+ *		Sleeping with the interrupts disabled ends the program like it does in simavr,
+ *		otherwise the test fails if no model can wake the controller up.
+ *
+ */
+void Sim_Sleep ( )
+	{
+		unsigned long count = InterruptCount ;
+		unsigned char mode = MCUCR.value & ( ( 1 << SM2 ) | ( 1 << SM1 ) | ( 1 << SM0 ) ) ;
+		unsigned long long next ;
+
+		if ( ! ( MCUCR.value & ( 1 << SE ) ) )
+			return ;
+
+		SeiShadow = false ;
+		Sim_Dispatch ( ) ;						// A pending interrupt wakes up at once
+		if ( ! ( SREG.value & ( 1 << SREG_I ) ) )
+			{
+				fprintf ( stderr , "Sim: sleep_cpu() at cycle %llu with the interrupts disabled, stopped\n" , Now ) ;
+				exit ( 0 ) ;
+			}
+
+		PowerDownSleep = ( mode != 0 ) && ( mode != ( 1 << SM0 ) ) ;
+		while ( InterruptCount == count )
+			{
+				next = Sim_NextEvent ( ) ;
+				if ( next == SimNever )
+					{
+						fprintf ( stderr , "Sim: sleep_cpu() at cycle %llu with no wake-up source\n" , Now ) ;
+						exit ( 2 ) ;
+					}
+				Sim_AdvanceTo ( next > Now ? next : Now + 1 ) ;
+			}
+		PowerDownSleep = false ;
+	}
+
+void Sim_AddModel ( SimModel *model )
+	{
+		Models.push_back ( model ) ;
+	}
+
+/*
+ *
+ * Description  :This function brings registers, models and the time back to power on.
+ *		The first call connects the models to the registers.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void Sim_Reset ( )
+	{
+		unsigned int i ;
+
+		if ( ! Installed )
+			{
+				SimTimer_Install ( ) ;
+				SimUart_Install ( ) ;
+				SimTwi_Install ( ) ;
+				SimLcd_Install ( ) ;
+				SimKeypad_Install ( ) ;
+				SimEeprom_Install ( ) ;
+				SimAdc_Install ( ) ;
+				SimVcd_Install ( ) ;
+				Installed = true ;
+			}
+
+		for ( i = 0 ; i < sizeof ( Registers ) / sizeof ( Registers [ 0 ] ) ; i++ )
+			Registers [ i ]->Reset ( ) ;
+		for ( i = 0 ; i < sizeof ( Registers16 ) / sizeof ( Registers16 [ 0 ] ) ; i++ )
+			Registers16 [ i ]->Reset ( ) ;
+
+		Now = 0 ;
+		InterruptCount = 0 ;
+		SeiShadow = false ;
+		PowerDownSleep = false ;
+		RcLow = 0 ;
+
+		for ( i = 0 ; i < Models.size ( ) ; i++ )
+			Models [ i ]->Reset ( ) ;
+	}
+
+void Sim_Check ( bool ok , const char *text , const char *file , int line )
+	{
+		Checks++ ;
+		if ( ! ok )
+			{
+				Failures++ ;
+				printf ( "%s:%d: check failed: %s\n" , file , line , text ) ;
+			}
+	}
+
+int Sim_Summary ( const char *name )
+	{
+		printf ( "%s: %lu checks, %lu failed\n" , name , Checks , Failures ) ;
+		return Failures ? 1 : 0 ;
+	}
+
+/*
+ *
+ * SimRegister
+ *
+ */
+SimRegister::SimRegister ( const char *reg_name ) : name ( reg_name ) , value ( 0 ) , reads ( 0 ) , writes ( 0 ) , read_hook ( 0 )
+	{
+		unsigned char i ;
+
+		for ( i = 0 ; i < SimMaxWriteHooks ; i++ )
+			write_hooks [ i ] = 0 ;
+	}
+
+SimRegister::operator unsigned char ( )
+	{
+		Sim_Advance ( 1 ) ;
+		reads++ ;
+		if ( read_hook )
+			value = read_hook ( *this ) ;
+		return value ;
+	}
+
+SimRegister &SimRegister::operator= ( unsigned int data )
+	{
+		unsigned char old_value = value , i ;
+
+		value = ( unsigned char ) data ;
+		writes++ ;
+		for ( i = 0 ; i < SimMaxWriteHooks && write_hooks [ i ] ; i++ )
+			write_hooks [ i ] ( *this , old_value ) ;
+		Sim_Advance ( 1 ) ;
+		return *this ;
+	}
+
+SimRegister &SimRegister::operator= ( SimRegister &reg )
+	{
+		return *this = ( unsigned char ) reg ;
+	}
+
+SimRegister &SimRegister::operator|= ( unsigned int data )
+	{
+		return *this = ( unsigned char ) *this | data ;
+	}
+
+SimRegister &SimRegister::operator&= ( unsigned int data )
+	{
+		return *this = ( unsigned char ) *this & data ;
+	}
+
+SimRegister &SimRegister::operator^= ( unsigned int data )
+	{
+		return *this = ( unsigned char ) *this ^ data ;
+	}
+
+void SimRegister::OnRead ( ReadHook hook )
+	{
+		read_hook = hook ;
+	}
+
+void SimRegister::OnWrite ( WriteHook hook )
+	{
+		unsigned char i ;
+
+		for ( i = 0 ; i < SimMaxWriteHooks ; i++ )
+			if ( write_hooks [ i ] == 0 )
+				{
+					write_hooks [ i ] = hook ;
+					return ;
+				}
+		fprintf ( stderr , "Sim: too many write hooks on %s\n" , name ) ;
+		exit ( 2 ) ;
+	}
+
+void SimRegister::Reset ( )
+	{
+		value = 0 ;
+		reads = 0 ;
+		writes = 0 ;
+	}
+
+/*
+ *
+ * SimRegister16
+ *
+ */
+SimRegister16::SimRegister16 ( const char *reg_name ) : name ( reg_name ) , value ( 0 ) , reads ( 0 ) , writes ( 0 ) , read_hook ( 0 ) , write_hook ( 0 )
+	{
+	}
+
+SimRegister16::operator unsigned int ( )
+	{
+		Sim_Advance ( 2 ) ;				// Two 8-bit accesses
+		reads++ ;
+		if ( read_hook )
+			value = read_hook ( *this ) ;
+		return value ;
+	}
+
+SimRegister16 &SimRegister16::operator= ( unsigned int data )
+	{
+		value = data & 0xffff ;
+		writes++ ;
+		if ( write_hook )
+			write_hook ( *this ) ;
+		Sim_Advance ( 2 ) ;
+		return *this ;
+	}
+
+void SimRegister16::OnRead ( ReadHook hook )
+	{
+		read_hook = hook ;
+	}
+
+void SimRegister16::OnWrite ( WriteHook hook )
+	{
+		write_hook = hook ;
+	}
+
+void SimRegister16::Reset ( )
+	{
+		value = 0 ;
+		reads = 0 ;
+		writes = 0 ;
+	}
+
+/*
+ *
+ * SimAtomic(util/atomic.h)
+ *
+ */
+unsigned char SimAtomic_Begin ( unsigned char type )
+	{
+		unsigned char sreg = SREG.value ;
+
+		if ( type <= ATOMIC_FORCEON )
+			Sim_Cli ( ) ;
+		else
+			Sim_Sei ( ) ;
+		return sreg ;
+	}
+
+SimAtomic::~SimAtomic ( )
+	{
+		if ( ( type == ATOMIC_FORCEON ) || ( ( type == ATOMIC_RESTORESTATE || type == NONATOMIC_RESTORESTATE ) && ( sreg & ( 1 << SREG_I ) ) ) )
+			Sim_Sei ( ) ;
+		else
+			Sim_Cli ( ) ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Sim.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,217 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Sim.h
+//
+// summary:	Declares the simulator class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * Sim.h
+ *
+ *
+ * |_______Host simulation of the Atmega32 and its peripherals_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 16:02:18
+ *
+ * Filename: Sim.h
+ * Host: Linux g++(the drivers are compiled as C++)
+ * Author: Mohammad Sadr
+ * Reference:Atmega32, DS1307 and HD44780 dataSheets
+ *
+ * Note:
+ *
+ *		The simulated time is counted in CPU cycles at F_CPU. It runs when a register is accessed(1 cycle),
+ *		in _delay_us()/_delay_ms() and in sleep_cpu(). The models are event driven: each one reports the cycle
+ *		of its next event(ex: end of a UART frame) and is updated when the time gets there.
+ *		The CPU clock is exactly F_CPU, unless Sim_RcOscillator() makes it follow OSCCAL: then only the
+ *		crystal of the DS1307 sees the difference, its second lasts Sim_CyclesPerSecond() cycles.
+ *
+ *		Models:
+ *			Timers    -> Timer1 and Timer2 normal/CTC modes with compare and overflow interrupts(SimTimer.cpp).
+ *			UART      -> frame timing from UBRR, 2 byte receive FIFO, loopback or injected input, second USART(SimUart.cpp).
+ *			TWI       -> master mode TWI with a DS1307 slave, clock and 1Hz SQW/OUT(PD6) running from the simulated time,
+ *			             and a 24Cxx EEPROM(SimTwi.cpp).
+ *			HD44780   -> 4-bit(PORTB) or 8-bit(PORTC/PORTD) wiring of the LCD drivers, busy time check(SimLcd.cpp).
+ *			Keypad    -> 4x4 matrix on PORTC with the wake-up diode-OR on INT0/1/2(SimKeypad.cpp).
+ *			EEPROM    -> EEMWE/EEWE sequence and 8.5ms write time(SimEeprom.cpp).
+ *			ADC       -> conversion time from the prescaler, input voltages set by the test(SimAdc.cpp).
+ *			VCD       -> logic analyzer on the port bits, pulse counters and VCD file export(SimVcd.cpp).
+ *
+ *		Each test calls Sim_Reset() first, attaches the external devices it needs(LCD, keypad) and
+ *		checks the results with SIM_Check(). The bus operation counters of each model are printed,
+ *		so a driver change can be compared by its register traffic as well as by its results.
+ *
+ */
+
+#ifndef SIM_H_
+#define SIM_H_
+
+#include <avr/io.h>
+#include "Configuration.h"
+#include <string>
+
+#define SimNever				0xffffffffffffffffULL
+
+/* Base class of the peripheral models */
+class SimModel
+	{
+		public :
+			virtual ~SimModel ( ) { }
+			virtual void Reset ( ) = 0 ;
+			virtual unsigned long long NextEvent ( ) { return SimNever ; }
+			virtual void Update ( unsigned long long now ) { ( void ) now ; }
+	} ;
+
+/*
+ * Core(Sim.cpp)
+ */
+void Sim_Reset ( ) ;								// All registers, models and the time back to power on
+void Sim_AddModel ( SimModel *model ) ;
+unsigned long long Sim_Now ( ) ;					// Simulated CPU cycles since Sim_Reset()
+void Sim_AdvanceTo ( unsigned long long cycle ) ;
+void Sim_AdvanceUs ( unsigned long us ) ;
+unsigned long long Sim_UsToCycles ( unsigned long us ) ;
+unsigned long Sim_Interrupts ( ) ;					// Number of ISRs called since Sim_Reset()
+bool Sim_PowerDown ( ) ;							// true while sleeping in power down(clocks stopped)
+void Sim_RcOscillator ( unsigned long low_hz , unsigned long high_hz ) ;	// CPU clock at OSCCAL 0x00 and 0xFF, linear
+unsigned long Sim_CyclesPerSecond ( ) ;				// CPU cycles of a real second, F_CPU without Sim_RcOscillator()
+
+void Sim_Check ( bool ok , const char *text , const char *file , int line ) ;
+int Sim_Summary ( const char *name ) ;			// Prints the result, returns the exit code of the test
+
+#define SIM_Check( cond )		Sim_Check ( ( cond ) , #cond , __FILE__ , __LINE__ )
+
+/*
+ * UART(SimUart.cpp)
+ */
+void SimUart_Loopback ( bool on ) ;				// TXD connected to RXD
+void SimUart_Inject ( const std::string &data ) ;	// Bytes sent to RXD, one frame after the other
+void SimUart_InjectFrame ( unsigned int frame ) ;	// 9-bit frame to RXD after the others, bit 8 is the ninth bit
+unsigned long SimUart_TxAddressFrames ( ) ;			// Frames sent with TXB8 set(9-bit frames)
+unsigned long SimUart_MpcmDropped ( ) ;				// Frames dropped by the receiver because of MPCM
+std::string SimUart_Output ( ) ;					// Bytes transmitted since Sim_Reset()
+unsigned long SimUart_FrameCycles ( ) ;
+unsigned long SimUart_Overruns ( ) ;
+void SimUart_Print ( ) ;
+
+/*
+ * Second USART(SimUart.cpp), the same model on UDR1, UCSR1A, ..., used by the drivers built with SIM_USART1
+ */
+void SimUart1_Inject ( const std::string &data ) ;
+void SimUart1_InjectFrame ( unsigned int frame ) ;
+std::string SimUart1_Output ( ) ;
+unsigned long SimUart1_FrameCycles ( ) ;
+unsigned long SimUart1_Overruns ( ) ;
+unsigned long SimUart1_MpcmDropped ( ) ;
+void SimUart1_Print ( ) ;
+
+/*
+ * TWI and DS1307(SimTwi.cpp)
+ */
+void SimDs1307_SetRegister ( unsigned char address , unsigned char data ) ;
+unsigned char SimDs1307_GetRegister ( unsigned char address ) ;
+unsigned long SimTwi_Bytes ( ) ;					// Address and data bytes on the bus
+unsigned long SimTwi_Starts ( ) ;
+unsigned long SimTwi_RepeatedStarts ( ) ;			// Starts while the bus is owned, counted in SimTwi_Starts() too
+unsigned long SimTwi_Stops ( ) ;
+void SimTwi_Print ( ) ;
+
+/*
+ * 24Cxx EEPROM on the TWI(SimTwi.cpp), address 0x50, not attached after Sim_Reset()
+ */
+void Sim24Cxx_Attach ( unsigned long size , unsigned int page_size ) ;	// Sizes are powers of 2, erased to 0xFF
+void Sim24Cxx_Set ( unsigned long address , unsigned char data ) ;
+unsigned char Sim24Cxx_Get ( unsigned long address ) ;
+unsigned long Sim24Cxx_WriteCycles ( ) ;			// Page writes done
+unsigned long Sim24Cxx_BusyNacks ( ) ;				// Addresses not acknowledged during a write cycle
+
+/*
+ * Other master on the TWI(SimTwi.cpp), 100kHz, addresses the AVR in slave mode(TWAR)
+ */
+bool SimTwiMaster_Start ( unsigned char sla ) ;		// Start or repeated Start and SLA+R/W, true if acknowledged
+bool SimTwiMaster_Write ( unsigned char data ) ;		// true if acknowledged
+unsigned char SimTwiMaster_Read ( bool ack ) ;			// ack false for the last byte
+void SimTwiMaster_Stop ( ) ;
+unsigned long SimTwiMaster_StretchCycles ( ) ;		// Cycles SCL was held low by the AVR
+
+/*
+ * HD44780(SimLcd.cpp)
+ */
+#define SimLcdNone				0
+#define SimLcd4Bit				4				// LCD_4_bit.c wiring: data PB4-PB7, RS PB0, RW PB1, EN PB2
+#define SimLcd8Bit				8				// LCD_8_bit.c wiring: data PORTC, RS PD5, RW PD6, EN PD7
+#define SimLcdI2c				2				// LCD_I2C.c wiring: PCF8574 at 0x27 on the TWI, data P4-P7, RS P0, RW P1, EN P2
+
+void SimLcd_Attach ( unsigned char wiring ) ;
+std::string SimLcd_Line ( unsigned char line ) ;	// 16 chars of the line as shown(0 or 1)
+unsigned char SimLcd_Cgram ( unsigned char address ) ;
+unsigned char SimLcd_Address ( ) ;					// Address counter
+bool SimLcd_CursorOn ( ) ;
+bool SimLcd_DisplayOn ( ) ;
+unsigned long SimLcd_Commands ( ) ;
+unsigned long SimLcd_DataWrites ( ) ;
+unsigned long SimLcd_BusyViolations ( ) ;			// Writes sent before the previous one was executed
+unsigned char SimLcd_Expander ( ) ;				// Last byte written to the PCF8574
+void SimLcd_Print ( ) ;
+
+/*
+ * Keypad(SimKeypad.cpp)
+ */
+void SimKeypad_Attach ( ) ;
+void SimKeypad_Press ( unsigned char key ) ;		// key = row*4 + col
+void SimKeypad_Release ( unsigned char key ) ;
+void SimKeypad_Schedule ( unsigned long long cycle , unsigned char key , bool down ) ;
+unsigned long SimKeypad_Scans ( ) ;				// PINC reads
+void SimKeypad_Print ( ) ;
+
+/*
+ * EEPROM(SimEeprom.cpp)
+ */
+#define SimEepromSize			1024
+
+unsigned char SimEeprom_Get ( unsigned int address ) ;
+void SimEeprom_Set ( unsigned int address , unsigned char data ) ;
+unsigned long SimEeprom_Writes ( ) ;
+unsigned long SimEeprom_BusyPolls ( ) ;			// EECR reads while a write was in progress
+unsigned long SimEeprom_Errors ( ) ;				// EEWE without EEMWE, EERE while busy
+void SimEeprom_Print ( ) ;
+
+/*
+ * ADC(SimAdc.cpp)
+ */
+void SimAdc_SetInput ( unsigned char channel , unsigned int value ) ;	// 10 bit result of the channel
+unsigned long SimAdc_Conversions ( ) ;
+void SimAdc_Print ( ) ;
+
+/*
+ * Logic analyzer(SimVcd.cpp)
+ */
+unsigned char SimVcd_Watch ( const char *name , SimRegister &port , unsigned char bit ) ;	// Returns the signal number
+unsigned long SimVcd_Pulses ( unsigned char signal ) ;				// High pulses ended since the watch started
+unsigned long long SimVcd_MinHigh ( unsigned char signal ) ;		// Cycles
+unsigned long long SimVcd_MaxHigh ( unsigned char signal ) ;
+bool SimVcd_Write ( const char *file ) ;
+void SimVcd_Print ( ) ;
+
+/* Called by Sim_Reset() the first time to connect the models to the registers */
+void SimTimer_Install ( ) ;
+void SimUart_Install ( ) ;
+void SimTwi_Install ( ) ;
+void SimLcd_Install ( ) ;
+void SimKeypad_Install ( ) ;
+void SimEeprom_Install ( ) ;
+void SimAdc_Install ( ) ;
+void SimVcd_Install ( ) ;
+
+/* PCF8574 backpack: SimTwi.cpp answers its address and gives the written bytes to SimLcd.cpp */
+bool SimLcd_OnTwi ( ) ;
+void SimLcd_ExpanderWritten ( unsigned char value ) ;
+
+#endif /* SIM_H_ */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Sim.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
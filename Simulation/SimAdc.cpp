@@ -0,0 +1,139 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\SimAdc.cpp
+//
+// summary:	Simulated ADC class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * SimAdc.cpp
+ *
+ *
+ * |_______Host simulation of the ADC_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 16:02:18
+ *
+ * Filename: SimAdc.cpp
+ * Host: Linux g++(the drivers are compiled as C++)
+ * Author: Mohammad Sadr
+ * Reference:Atmega32 dataSheet
+ *
+ * Note:
+ *
+ *		Setting ADSC with ADEN set starts a single conversion of the channel in ADMUX(MUX2:0).
+ *		It takes 13 ADC clocks, 25 for the first one after ADEN was set, the ADC clock is F_CPU/prescaler(ADPS2:0).
+ *		At the end ADSC is cleared, ADIF is set and ADCW holds the input of the channel(ADLAR is handled).
+ *		ADIF is cleared by writing one. Auto trigger and the differential channels are not simulated.
+ *
+ */
+
+#include <stdio.h>
+#include "Sim.h"
+
+#define AdcChannels				8
+#define FirstConversionClocks	25
+#define ConversionClocks		13
+
+static const unsigned char AdcPrescalers [ 8 ] = { 2 , 2 , 4 , 8 , 16 , 32 , 64 , 128 } ;
+
+class SimAdc : public SimModel
+	{
+		public :
+			void Reset ( )
+				{
+					unsigned char i ;
+
+					for ( i = 0 ; i < AdcChannels ; i++ )
+						inputs [ i ] = 0 ;
+					done = SimNever ;
+					first = true ;
+					conversions = 0 ;
+				}
+
+			unsigned long long NextEvent ( )
+				{
+					return done ;
+				}
+
+			void Update ( unsigned long long now )
+				{
+					unsigned int result ;
+
+					if ( done > now )
+						return ;
+					result = inputs [ channel ] ;
+					if ( ADMUX.value & ( 1 << ADLAR ) )
+						result <<= 6 ;
+					ADCW.value = result ;
+					ADCL.value = result & 0xff ;
+					ADCH.value = result >> 8 ;
+					ADCSRA.value = ( ADCSRA.value & ~ ( 1 << ADSC ) ) | ( 1 << ADIF ) ;
+					done = SimNever ;
+					conversions++ ;
+				}
+
+			unsigned int inputs [ AdcChannels ] ;
+			unsigned char channel ;
+			unsigned long long done ;
+			bool first ;
+			unsigned long conversions ;
+	} ;
+
+static SimAdc Adc ;
+
+static void SimAdc_AdcsraWritten ( SimRegister &reg , unsigned char old_value )
+	{
+		unsigned char written = reg.value ;
+		unsigned long clocks ;
+
+		/* ADIF is cleared by writing one, ADSC can not be cleared by software */
+		reg.value = ( written & ~ ( 1 << ADIF ) ) | ( ( written & ( 1 << ADIF ) ) ? 0 : ( old_value & ( 1 << ADIF ) ) ) ;
+
+		if ( ! ( written & ( 1 << ADEN ) ) )
+			{
+				Adc.done = SimNever ;
+				Adc.first = true ;
+				reg.value &= ~ ( 1 << ADSC ) ;
+				return ;
+			}
+		if ( Adc.done != SimNever )
+			{
+				reg.value |= ( 1 << ADSC ) ;		// Conversion in progress
+				return ;
+			}
+		if ( written & ( 1 << ADSC ) )
+			{
+				clocks = Adc.first ? FirstConversionClocks : ConversionClocks ;
+				Adc.first = false ;
+				Adc.channel = ADMUX.value & ( AdcChannels - 1 ) ;
+				Adc.done = Sim_Now ( ) + clocks * AdcPrescalers [ written & 0x07 ] ;
+			}
+	}
+
+void SimAdc_Install ( )
+	{
+		Sim_AddModel ( &Adc ) ;
+		ADCSRA.OnWrite ( SimAdc_AdcsraWritten ) ;
+	}
+
+void SimAdc_SetInput ( unsigned char channel , unsigned int value )
+	{
+		Adc.inputs [ channel & ( AdcChannels - 1 ) ] = value & 0x3ff ;
+	}
+
+unsigned long SimAdc_Conversions ( )
+	{
+		return Adc.conversions ;
+	}
+
+void SimAdc_Print ( )
+	{
+		printf ( "  adc: conversions=%lu adcsra_reads=%lu adcsra_writes=%lu\n" , Adc.conversions , ADCSRA.reads , ADCSRA.writes ) ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\SimAdc.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,170 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\SimEeprom.cpp
+//
+// summary:	Simulated EEPROM class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * SimEeprom.cpp
+ *
+ *
+ * |_______Host simulation of the internal EEPROM_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 16:02:18
+ *
+ * Filename: SimEeprom.cpp
+ * Host: Linux g++(the drivers are compiled as C++)
+ * Author: Mohammad Sadr
+ * Reference:Atmega32 dataSheet
+ *
+ * Note:
+ *
+ *		EEMWE is cleared by hardware 4 cycles after it was set. Setting EEWE while EEMWE is set starts
+ *		a write of EEDR at EEAR which takes 8.5ms, EEWE is cleared when it is done.
+ *		EEWE set without EEMWE(write not started) and EERE set while a write is in progress are counted
+ *		as errors. The EECR reads during a write are counted as busy polls, which shows how much
+ *		a driver spins on EEWE.
+ *
+ */
+
+#include <stdio.h>
+#include "Sim.h"
+
+#define MasterWriteCycles		4
+#define WriteUs					8500
+
+class SimEeprom : public SimModel
+	{
+		public :
+			void Reset ( )
+				{
+					unsigned int i ;
+
+					for ( i = 0 ; i < SimEepromSize ; i++ )
+						memory [ i ] = 0xff ;
+					master_until = SimNever ;
+					write_done = SimNever ;
+					writes = 0 ;
+					busy_polls = 0 ;
+					errors = 0 ;
+				}
+
+			unsigned long long NextEvent ( )
+				{
+					return master_until < write_done ? master_until : write_done ;
+				}
+
+			void Update ( unsigned long long now )
+				{
+					if ( master_until <= now )
+						{
+							EECR.value &= ~ ( 1 << EEMWE ) ;
+							master_until = SimNever ;
+						}
+					if ( write_done <= now )
+						{
+							memory [ write_address ] = write_data ;
+							EECR.value &= ~ ( 1 << EEWE ) ;
+							write_done = SimNever ;
+						}
+				}
+
+			bool Busy ( )
+				{
+					return write_done != SimNever ;
+				}
+
+			unsigned char memory [ SimEepromSize ] ;
+			unsigned long long master_until , write_done ;
+			unsigned int write_address ;
+			unsigned char write_data ;
+			unsigned long writes , busy_polls , errors ;
+	} ;
+
+static SimEeprom Eeprom ;
+
+static void SimEeprom_EecrWritten ( SimRegister &reg , unsigned char old_value )
+	{
+		unsigned char written = reg.value ;
+
+		if ( ( written & ( 1 << EEMWE ) ) && ! ( old_value & ( 1 << EEMWE ) ) )
+			Eeprom.master_until = Sim_Now ( ) + MasterWriteCycles ;
+
+		if ( ( written & ( 1 << EEWE ) ) && ! ( old_value & ( 1 << EEWE ) ) )
+			{
+				if ( ( old_value & ( 1 << EEMWE ) ) && ! Eeprom.Busy ( ) )
+					{
+						Eeprom.write_address = EEAR.value & ( SimEepromSize - 1 ) ;
+						Eeprom.write_data = EEDR.value ;
+						Eeprom.write_done = Sim_Now ( ) + Sim_UsToCycles ( WriteUs ) ;
+						Eeprom.writes++ ;
+					}
+				else
+					{
+						reg.value &= ~ ( 1 << EEWE ) ;
+						Eeprom.errors++ ;
+					}
+			}
+
+		if ( written & ( 1 << EERE ) )
+			{
+				if ( Eeprom.Busy ( ) )
+					Eeprom.errors++ ;
+				else
+					EEDR.value = Eeprom.memory [ EEAR.value & ( SimEepromSize - 1 ) ] ;
+				reg.value &= ~ ( 1 << EERE ) ;
+			}
+	}
+
+static unsigned char SimEeprom_EecrRead ( SimRegister &reg )
+	{
+		if ( Eeprom.Busy ( ) )
+			Eeprom.busy_polls++ ;
+		return reg.value ;
+	}
+
+void SimEeprom_Install ( )
+	{
+		Sim_AddModel ( &Eeprom ) ;
+		EECR.OnWrite ( SimEeprom_EecrWritten ) ;
+		EECR.OnRead ( SimEeprom_EecrRead ) ;
+	}
+
+unsigned char SimEeprom_Get ( unsigned int address )
+	{
+		return Eeprom.memory [ address & ( SimEepromSize - 1 ) ] ;
+	}
+
+void SimEeprom_Set ( unsigned int address , unsigned char data )
+	{
+		Eeprom.memory [ address & ( SimEepromSize - 1 ) ] = data ;
+	}
+
+unsigned long SimEeprom_Writes ( )
+	{
+		return Eeprom.writes ;
+	}
+
+unsigned long SimEeprom_BusyPolls ( )
+	{
+		return Eeprom.busy_polls ;
+	}
+
+unsigned long SimEeprom_Errors ( )
+	{
+		return Eeprom.errors ;
+	}
+
+void SimEeprom_Print ( )
+	{
+		printf ( "  eeprom: writes=%lu busy_polls=%lu errors=%lu eecr_reads=%lu\n" ,
+			Eeprom.writes , Eeprom.busy_polls , Eeprom.errors , EECR.reads ) ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\SimEeprom.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,247 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\SimKeypad.cpp
+//
+// summary:	Simulated keypad class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * SimKeypad.cpp
+ *
+ *
+ * |_______Host simulation of the 4x4 keypad matrix_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 16:02:18
+ *
+ * Filename: SimKeypad.cpp
+ * Host: Linux g++(the drivers are compiled as C++)
+ * Author: Mohammad Sadr
+ * Reference:Atmega32 dataSheet
+ *
+ * Note:
+ *
+ *		Wiring of Keypad.c: ROW lines PC4-PC7(outputs), COL lines PC0-PC3(inputs with pull-up).
+ *		A pressed key(ROW*4+COL) pulls its COL line low while its ROW line is driven low.
+ *		The COL lines are connected to the wake-up interrupt of Keypad.c(KEYPAD_WakeInt: INT0 on PD2,
+ *		INT1 on PD3 or INT2 on PB2) through diodes, so the pin is low while any COL line is low.
+ *		INT0/INT1 follow ISCx1:0 in MCUCR, the low level sets INTFx while INTx is enabled(the level
+ *		request of the datasheet), INT2 sets INTF2 on the edge selected by ISC2, also in power down.
+ *		Key changes can be scheduled at a cycle, so the keys can wake the controller from sleep_cpu().
+ *
+ */
+
+#include <deque>
+#include <stdio.h>
+#include "Sim.h"
+#include "Keypad.h"
+
+#if KEYPAD_WakeInt == 2
+	#define WakeDdr					DDRB
+	#define WakePort				PORTB
+	#define WakeInput				PINB
+	#define WakePin					PB2
+	#define WakeInt					INT2
+	#define WakeFlag				INTF2
+	#define WakeSense( )			( ( MCUCSR.value & ( 1 << ISC2 ) ) ? 3 : 2 )			// Rising or falling edge
+#elif KEYPAD_WakeInt == 1
+	#define WakeDdr					DDRD
+	#define WakePort				PORTD
+	#define WakeInput				PIND
+	#define WakePin					PD3
+	#define WakeInt					INT1
+	#define WakeFlag				INTF1
+	#define WakeSense( )			( ( MCUCR.value >> ISC10 ) & 3 )
+#else
+	#define WakeDdr					DDRD
+	#define WakePort				PORTD
+	#define WakeInput				PIND
+	#define WakePin					PD2
+	#define WakeInt					INT0
+	#define WakeFlag				INTF0
+	#define WakeSense( )			( ( MCUCR.value >> ISC00 ) & 3 )
+#endif
+
+typedef struct
+	{
+		unsigned long long cycle ;
+		unsigned char key ;
+		bool down ;
+	} SimKeyEvent ;
+
+class SimKeypad : public SimModel
+	{
+		public :
+			void Reset ( )
+				{
+					attached = false ;
+					keys = 0 ;
+					events.clear ( ) ;
+					wake_level = true ;
+					scans = 0 ;
+					edges = 0 ;
+				}
+
+			unsigned long long NextEvent ( )
+				{
+					return events.empty ( ) ? SimNever : events.front ( ).cycle ;
+				}
+
+			void Update ( unsigned long long now )
+				{
+					while ( ! events.empty ( ) && events.front ( ).cycle <= now )
+						{
+							Set ( events.front ( ).key , events.front ( ).down ) ;
+							events.pop_front ( ) ;
+						}
+				}
+
+			void Set ( unsigned char key , bool down )
+				{
+					if ( down )
+						keys |= 1 << ( key & 0x0f ) ;
+					else
+						keys &= ~ ( 1 << ( key & 0x0f ) ) ;
+					CheckWake ( ) ;
+				}
+
+			unsigned char Columns ( )
+				{
+					unsigned char row , col , levels = 0x0f ;
+
+					for ( row = 0 ; row < 4 ; row++ )
+						{
+							if ( ! ( DDRC.value & ( 0x10 << row ) ) || ( PORTC.value & ( 0x10 << row ) ) )
+								continue ;		// ROW not driven low
+							for ( col = 0 ; col < 4 ; col++ )
+								if ( keys & ( 1 << ( row * 4 + col ) ) )
+									levels &= ~ ( 1 << col ) ;
+						}
+					return levels ;
+				}
+
+			bool WakeLevel ( )
+				{
+					bool level = ( WakeDdr.value & ( 1 << WakePin ) ) ? ( WakePort.value & ( 1 << WakePin ) ) != 0 : true ;
+
+					return level && ( Columns ( ) == 0x0f ) ;
+				}
+
+			/* ISCx1:0 = 0 low level, 1 any change, 2 falling edge, 3 rising edge */
+			void CheckWake ( )
+				{
+					bool level , request ;
+					unsigned char sense = WakeSense ( ) ;
+
+					if ( ! attached )
+						return ;
+					level = WakeLevel ( ) ;
+					if ( sense == 0 )
+						request = ! level && ( GICR.value & ( 1 << WakeInt ) ) ;
+					else
+						request = ( wake_level != level ) && ( sense == 1 || ( sense == 3 ) == level ) ;
+					if ( request && ! ( GIFR.value & ( 1 << WakeFlag ) ) )
+						{
+							GIFR.value |= ( 1 << WakeFlag ) ;
+							edges++ ;
+						}
+					wake_level = level ;
+				}
+
+			bool attached , wake_level ;
+			unsigned int keys ;
+			std::deque < SimKeyEvent > events ;
+			unsigned long scans , edges ;
+	} ;
+
+static SimKeypad Keypad ;
+
+static unsigned char SimKeypad_PincRead ( SimRegister &reg )
+	{
+		( void ) reg ;
+		if ( ! Keypad.attached )
+			return PORTC.value ;
+		Keypad.scans++ ;
+		return ( PORTC.value & 0xf0 ) | ( Keypad.Columns ( ) & ( PORTC.value | 0xf0 ) & 0x0f ) ;
+	}
+
+static unsigned char SimKeypad_WakeRead ( SimRegister &reg )
+	{
+		if ( ! Keypad.attached )
+			return reg.value ;
+		return ( reg.value & ~ ( 1 << WakePin ) ) | ( Keypad.WakeLevel ( ) ? ( 1 << WakePin ) : 0 ) ;
+	}
+
+static void SimKeypad_PinsChanged ( SimRegister &reg , unsigned char old_value )
+	{
+		( void ) reg ;
+		( void ) old_value ;
+		Keypad.CheckWake ( ) ;
+	}
+
+/* GIFR flags are cleared by writing one */
+static void SimKeypad_GifrWritten ( SimRegister &reg , unsigned char old_value )
+	{
+		reg.value = old_value & ~ reg.value ;
+	}
+
+void SimKeypad_Install ( )
+	{
+		Sim_AddModel ( &Keypad ) ;
+		PINC.OnRead ( SimKeypad_PincRead ) ;
+		WakeInput.OnRead ( SimKeypad_WakeRead ) ;
+		PORTC.OnWrite ( SimKeypad_PinsChanged ) ;
+		DDRC.OnWrite ( SimKeypad_PinsChanged ) ;
+		WakePort.OnWrite ( SimKeypad_PinsChanged ) ;
+		WakeDdr.OnWrite ( SimKeypad_PinsChanged ) ;
+		MCUCR.OnWrite ( SimKeypad_PinsChanged ) ;
+		MCUCSR.OnWrite ( SimKeypad_PinsChanged ) ;
+		GICR.OnWrite ( SimKeypad_PinsChanged ) ;
+		GIFR.OnWrite ( SimKeypad_GifrWritten ) ;
+	}
+
+void SimKeypad_Attach ( )
+	{
+		Keypad.attached = true ;
+		Keypad.wake_level = Keypad.WakeLevel ( ) ;
+	}
+
+void SimKeypad_Press ( unsigned char key )
+	{
+		Keypad.Set ( key , true ) ;
+	}
+
+void SimKeypad_Release ( unsigned char key )
+	{
+		Keypad.Set ( key , false ) ;
+	}
+
+/*
+ *
+ * Description  :This function changes a key at the given cycle, the events must be scheduled in time order.
+ * I/P Arguments: unsigned long long-->cycle, unsigned char-->key(ROW*4+COL), bool-->true for pressed.
+ * Return value : none
+ *
+ */
+void SimKeypad_Schedule ( unsigned long long cycle , unsigned char key , bool down )
+	{
+		SimKeyEvent event = { cycle , key , down } ;
+
+		Keypad.events.push_back ( event ) ;
+	}
+
+unsigned long SimKeypad_Scans ( )
+	{
+		return Keypad.scans ;
+	}
+
+void SimKeypad_Print ( )
+	{
+		printf ( "  keypad: pinc_reads=%lu portc_writes=%lu wake_requests=%lu\n" , Keypad.scans , PORTC.writes , Keypad.edges ) ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\SimKeypad.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,331 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\SimLcd.cpp
+//
+// summary:	Simulated HD44780 class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * SimLcd.cpp
+ *
+ *
+ * |_______Host simulation of a 16x2 HD44780 LCD_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 16:02:18
+ *
+ * Filename: SimLcd.cpp
+ * Host: Linux g++(the drivers are compiled as C++)
+ * Author: Mohammad Sadr
+ * Reference:HD44780 dataSheet
+ *
+ * Note:
+ *
+ *		The LCD latches RS and the data bus on the High-to-Low edge of EN(the EN pin must be an output).
+ *		With the 4-bit wirings two nibbles make one byte, higher nibble first.
+ *		The PCF8574 of the I2C wiring changes its pins at the acknowledge of each byte(SimTwi.cpp). The model starts in the mode
+ *		of its wiring, the power on reset sequence of the controller is not simulated.
+ *		Execution times: 1.52ms for clear and home, 37us for the other commands and data writes.
+ *		A write which comes before the previous one was executed is counted as a busy violation,
+ *		the drivers do not read the busy flag so it must stay 0.
+ *
+ */
+
+#include <stdio.h>
+#include "Sim.h"
+
+#define DdramSize				0x80
+#define CgramSize				0x40
+#define LineLength				0x28		// DDRAM bytes of each line in 2 line mode
+#define LineTwoAddress			0x40
+#define DisplayChars			16
+
+#define ShortExecutionUs		37
+#define LongExecutionUs			1520
+
+class SimLcd : public SimModel
+	{
+		public :
+			void Reset ( )
+				{
+					unsigned char i ;
+
+					wiring = SimLcdNone ;
+					for ( i = 0 ; i < DdramSize ; i++ )
+						ddram [ i ] = ' ' ;
+					for ( i = 0 ; i < CgramSize ; i++ )
+						cgram [ i ] = 0 ;
+					address = 0 ;
+					cgram_selected = false ;
+					increment = true ;
+					entry_shift = false ;
+					display_on = false ;
+					cursor_on = false ;
+					blink_on = false ;
+					display_shift = 0 ;
+					nibble_pending = false ;
+					busy_until = 0 ;
+					commands = 0 ;
+					data_writes = 0 ;
+					violations = 0 ;
+					pulses = 0 ;
+					expander = 0xff ;				// Quasi bidirectional pins, high after power on
+				}
+
+			/* EN falling edge: RS and the data bus are latched */
+			void Latch ( bool rs , bool rw , unsigned char bus )
+				{
+					pulses++ ;
+					if ( rw )
+						return ;					// Reads are not simulated
+					if ( wiring == SimLcd4Bit || wiring == SimLcdI2c )
+						{
+							if ( ! nibble_pending )
+								{
+									high_nibble = bus & 0xf0 ;
+									nibble_pending = true ;
+									return ;
+								}
+							nibble_pending = false ;
+							bus = high_nibble | ( bus >> 4 ) ;
+						}
+
+					if ( Sim_Now ( ) < busy_until )
+						violations++ ;
+					if ( rs )
+						Data ( bus ) ;
+					else
+						Command ( bus ) ;
+				}
+
+			void Command ( unsigned char cmd )
+				{
+					unsigned char i ;
+					unsigned long us = ShortExecutionUs ;
+
+					commands++ ;
+					if ( cmd & 0x80 )					// Set DDRAM address
+						{
+							address = cmd & 0x7f ;
+							cgram_selected = false ;
+						}
+					else if ( cmd & 0x40 )				// Set CGRAM address
+						{
+							address = cmd & 0x3f ;
+							cgram_selected = true ;
+						}
+					else if ( cmd & 0x20 )				// Function set, the wiring decides the bus width
+						;
+					else if ( cmd & 0x10 )				// Cursor or display shift
+						{
+							if ( cmd & 0x08 )
+								display_shift = ( display_shift + ( ( cmd & 0x04 ) ? LineLength - 1 : 1 ) ) % LineLength ;
+							else
+								Move ( ( cmd & 0x04 ) != 0 ) ;
+						}
+					else if ( cmd & 0x08 )				// Display on/off control
+						{
+							display_on = ( cmd & 0x04 ) != 0 ;
+							cursor_on = ( cmd & 0x02 ) != 0 ;
+							blink_on = ( cmd & 0x01 ) != 0 ;
+						}
+					else if ( cmd & 0x04 )				// Entry mode set
+						{
+							increment = ( cmd & 0x02 ) != 0 ;
+							entry_shift = ( cmd & 0x01 ) != 0 ;
+						}
+					else if ( cmd & 0x02 )				// Return home
+						{
+							address = 0 ;
+							cgram_selected = false ;
+							display_shift = 0 ;
+							us = LongExecutionUs ;
+						}
+					else if ( cmd & 0x01 )				// Clear display
+						{
+							for ( i = 0 ; i < DdramSize ; i++ )
+								ddram [ i ] = ' ' ;
+							address = 0 ;
+							cgram_selected = false ;
+							increment = true ;
+							display_shift = 0 ;
+							us = LongExecutionUs ;
+						}
+					busy_until = Sim_Now ( ) + Sim_UsToCycles ( us ) ;
+				}
+
+			void Data ( unsigned char data )
+				{
+					data_writes++ ;
+					if ( cgram_selected )
+						{
+							cgram [ address ] = data ;
+							address = ( address + ( increment ? 1 : CgramSize - 1 ) ) & ( CgramSize - 1 ) ;
+						}
+					else
+						{
+							ddram [ address ] = data ;
+							Move ( increment ) ;
+							if ( entry_shift )
+								display_shift = ( display_shift + ( increment ? 1 : LineLength - 1 ) ) % LineLength ;
+						}
+					busy_until = Sim_Now ( ) + Sim_UsToCycles ( ShortExecutionUs ) ;
+				}
+
+			/* DDRAM address counter, 0x27 goes on to 0x40 and 0x67 back to 0x00 */
+			void Move ( bool right )
+				{
+					if ( cgram_selected )
+						{
+							address = ( address + ( right ? 1 : CgramSize - 1 ) ) & ( CgramSize - 1 ) ;
+							return ;
+						}
+					if ( right )
+						{
+							if ( address == LineLength - 1 )
+								address = LineTwoAddress ;
+							else if ( address >= LineTwoAddress + LineLength - 1 )
+								address = 0 ;
+							else
+								address++ ;
+						}
+					else
+						{
+							if ( address == 0 )
+								address = LineTwoAddress + LineLength - 1 ;
+							else if ( address == LineTwoAddress )
+								address = LineLength - 1 ;
+							else
+								address-- ;
+						}
+				}
+
+			unsigned char wiring ;
+			unsigned char ddram [ DdramSize ] , cgram [ CgramSize ] ;
+			unsigned char address , display_shift , high_nibble , expander ;
+			bool cgram_selected , increment , entry_shift , display_on , cursor_on , blink_on , nibble_pending ;
+			unsigned long long busy_until ;
+			unsigned long commands , data_writes , violations , pulses ;
+	} ;
+
+static SimLcd Lcd ;
+
+/* LCD_4_bit.c: data PB4-PB7, RS PB0, RW PB1, EN PB2 */
+static void SimLcd_PortbWritten ( SimRegister &reg , unsigned char old_value )
+	{
+		if ( Lcd.wiring != SimLcd4Bit || ! ( DDRB.value & ( 1 << PB2 ) ) )
+			return ;
+		if ( ( old_value & ( 1 << PB2 ) ) && ! ( reg.value & ( 1 << PB2 ) ) )
+			Lcd.Latch ( ( reg.value & ( 1 << PB0 ) ) != 0 , ( reg.value & ( 1 << PB1 ) ) != 0 , reg.value ) ;
+	}
+
+/* LCD_8_bit.c: data PORTC, RS PD5, RW PD6, EN PD7 */
+static void SimLcd_PortdWritten ( SimRegister &reg , unsigned char old_value )
+	{
+		if ( Lcd.wiring != SimLcd8Bit || ! ( DDRD.value & ( 1 << PD7 ) ) )
+			return ;
+		if ( ( old_value & ( 1 << PD7 ) ) && ! ( reg.value & ( 1 << PD7 ) ) )
+			Lcd.Latch ( ( reg.value & ( 1 << PD5 ) ) != 0 , ( reg.value & ( 1 << PD6 ) ) != 0 , PORTC.value ) ;
+	}
+
+/* LCD_I2C.c: data P4-P7, RS P0, RW P1, EN P2 of the PCF8574 */
+void SimLcd_ExpanderWritten ( unsigned char value )
+	{
+		unsigned char old_value = Lcd.expander ;
+
+		Lcd.expander = value ;
+		if ( ( old_value & 0x04 ) && ! ( value & 0x04 ) )
+			Lcd.Latch ( ( value & 0x01 ) != 0 , ( value & 0x02 ) != 0 , value ) ;
+	}
+
+bool SimLcd_OnTwi ( )
+	{
+		return Lcd.wiring == SimLcdI2c ;
+	}
+
+unsigned char SimLcd_Expander ( )
+	{
+		return Lcd.expander ;
+	}
+
+void SimLcd_Install ( )
+	{
+		Sim_AddModel ( &Lcd ) ;
+		PORTB.OnWrite ( SimLcd_PortbWritten ) ;
+		PORTD.OnWrite ( SimLcd_PortdWritten ) ;
+	}
+
+void SimLcd_Attach ( unsigned char wiring )
+	{
+		Lcd.wiring = wiring ;
+		Lcd.nibble_pending = false ;
+	}
+
+std::string SimLcd_Line ( unsigned char line )
+	{
+		std::string text ;
+		unsigned char i , base = line ? LineTwoAddress : 0 ;
+
+		for ( i = 0 ; i < DisplayChars ; i++ )
+			text += ( char ) Lcd.ddram [ base + ( Lcd.display_shift + i ) % LineLength ] ;
+		return text ;
+	}
+
+unsigned char SimLcd_Cgram ( unsigned char address )
+	{
+		return Lcd.cgram [ address & ( CgramSize - 1 ) ] ;
+	}
+
+unsigned char SimLcd_Address ( )
+	{
+		return Lcd.address ;
+	}
+
+bool SimLcd_CursorOn ( )
+	{
+		return Lcd.cursor_on ;
+	}
+
+bool SimLcd_DisplayOn ( )
+	{
+		return Lcd.display_on ;
+	}
+
+unsigned long SimLcd_Commands ( )
+	{
+		return Lcd.commands ;
+	}
+
+unsigned long SimLcd_DataWrites ( )
+	{
+		return Lcd.data_writes ;
+	}
+
+unsigned long SimLcd_BusyViolations ( )
+	{
+		return Lcd.violations ;
+	}
+
+void SimLcd_Print ( )
+	{
+		std::string text ;
+		unsigned char line ;
+		unsigned int i ;
+
+		printf ( "  lcd: commands=%lu data=%lu en_pulses=%lu busy_violations=%lu\n" ,
+			Lcd.commands , Lcd.data_writes , Lcd.pulses , Lcd.violations ) ;
+		for ( line = 0 ; line < 2 ; line++ )
+			{
+				text = SimLcd_Line ( line ) ;
+				for ( i = 0 ; i < text.size ( ) ; i++ )
+					if ( text [ i ] < ' ' || text [ i ] > '~' )
+						text [ i ] = '.' ;			// CGRAM and ROM symbols
+				printf ( "  lcd: [%s]\n" , text.c_str ( ) ) ;
+			}
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\SimLcd.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
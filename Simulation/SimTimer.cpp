@@ -0,0 +1,298 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\SimTimer.cpp
+//
+// summary:	Simulated timer class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * SimTimer.cpp
+ *
+ *
+ * |_______Host simulation of Timer1 and Timer2_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 16:02:18
+ *
+ * Filename: SimTimer.cpp
+ * Host: Linux g++(the drivers are compiled as C++)
+ * Author: Mohammad Sadr
+ * Reference:Atmega32 dataSheet
+ *
+ * Note:
+ *
+ *		The counters are not stepped, their value is worked out from the cycles since the last change.
+ *		Normal mode counts to the maximum and sets TOVn, CTC mode counts to OCR2/OCR1A and sets OCF2/OCF1A.
+ *		The flags are set when the counter goes back to zero. In normal mode Timer1 also sets OCF1A/OCF1B
+ *		when it counts to OCR1A/OCR1B. PWM modes and Timer0 are not simulated.
+ *		The timers stop while sleeping in power down(Sim_PowerDown()).
+ *
+ */
+
+#include "Sim.h"
+
+/* Counter arithmetic shared by both timers */
+class SimCounter
+	{
+		public :
+			void Reset ( unsigned long counter_size )
+				{
+					size = counter_size ;
+					base_cycle = 0 ;
+					base_count = 0 ;
+					prescaler = 0 ;
+					top = size - 1 ;
+					next = SimNever ;
+					last = 0 ;
+				}
+
+			unsigned long Count ( unsigned long long now )
+				{
+					if ( prescaler == 0 )
+						return base_count ;
+					return ( base_count + ( unsigned long ) ( ( now - base_cycle ) / prescaler ) ) % size ;
+				}
+
+			/* Counter value at now becomes the new base, the next wrap is scheduled with the new settings */
+			void Rebase ( unsigned long long now , unsigned long new_prescaler , unsigned long new_top )
+				{
+					if ( prescaler )
+						{
+							base_count = Count ( now ) ;
+							base_cycle += ( ( now - base_cycle ) / prescaler ) * prescaler ;
+						}
+					else
+						base_cycle = now ;
+					prescaler = new_prescaler ;
+					top = new_top ;
+					Schedule ( ) ;
+				}
+
+			void Load ( unsigned long long now , unsigned long count )
+				{
+					base_count = count % size ;
+					base_cycle = now ;
+					Schedule ( ) ;
+				}
+
+			void Schedule ( )
+				{
+					unsigned long ticks ;
+
+					if ( prescaler == 0 )
+						{
+							next = SimNever ;
+							return ;
+						}
+					ticks = ( base_count <= top ) ? ( top + 1 - base_count ) : ( size - base_count ) ;
+					next = base_cycle + ( unsigned long long ) ticks * prescaler ;
+				}
+
+			/* Cycle at which the counter gets to value after now, SimNever when stopped */
+			unsigned long long Reach ( unsigned long long now , unsigned long value )
+				{
+					unsigned long long ticks ;
+
+					if ( prescaler == 0 )
+						return SimNever ;
+					ticks = ( now - base_cycle ) / prescaler ;
+					ticks += ( value + size - Count ( now ) ) % size ;
+					if ( base_cycle + ticks * prescaler <= now )
+						ticks += size ;
+					return base_cycle + ticks * prescaler ;
+				}
+
+			/* Returns true at each wrap, with compare set when the wrap was the CTC top */
+			bool Wrap ( unsigned long long now , bool &compare )
+				{
+					if ( Sim_PowerDown ( ) )
+						{
+							if ( next != SimNever )
+								next += now - last ;
+							base_cycle += now - last ;
+							last = now ;
+							return false ;
+						}
+					last = now ;
+					if ( next > now )
+						return false ;
+					compare = ( base_count <= top ) && ( top != size - 1 ) ;
+					base_cycle = next ;
+					base_count = 0 ;
+					Schedule ( ) ;
+					return true ;
+				}
+
+			unsigned long size ;
+			unsigned long long base_cycle ;
+			unsigned long base_count ;
+			unsigned long prescaler ;
+			unsigned long top ;
+			unsigned long long next ;
+			unsigned long long last ;
+	} ;
+
+static const unsigned int Timer2Prescalers [ 8 ] = { 0 , 1 , 8 , 32 , 64 , 128 , 256 , 1024 } ;
+static const unsigned int Timer1Prescalers [ 8 ] = { 0 , 1 , 8 , 64 , 256 , 1024 , 0 , 0 } ;	// External clock not simulated
+
+class SimTimers : public SimModel
+	{
+		public :
+			void Reset ( )
+				{
+					timer1.Reset ( 65536 ) ;
+					timer2.Reset ( 256 ) ;
+					compare_a = SimNever ;
+					compare_b = SimNever ;
+				}
+
+			/* Normal mode compare matches of Timer1, worked out again when a setting changes */
+			void ScheduleCompares ( unsigned long long now )
+				{
+					bool normal = ( TCCR1B.value & ( ( 1 << WGM13 ) | ( 1 << WGM12 ) ) ) == 0
+						&& ( TCCR1A.value & ( ( 1 << WGM11 ) | ( 1 << WGM10 ) ) ) == 0 ;
+
+					compare_a = normal ? timer1.Reach ( now , OCR1A.value ) : SimNever ;
+					compare_b = normal ? timer1.Reach ( now , OCR1B.value ) : SimNever ;
+				}
+
+			unsigned long long NextEvent ( )
+				{
+					if ( Sim_PowerDown ( ) )
+						return SimNever ;
+					unsigned long long next = timer1.next < timer2.next ? timer1.next : timer2.next ;
+
+					if ( compare_a < next )
+						next = compare_a ;
+					return compare_b < next ? compare_b : next ;
+				}
+
+			void Update ( unsigned long long now )
+				{
+					bool compare = false ;
+
+					if ( Sim_PowerDown ( ) )
+						{
+							if ( compare_a != SimNever )
+								compare_a += now - timer1.last ;
+							if ( compare_b != SimNever )
+								compare_b += now - timer1.last ;
+						}
+					else
+						{
+							while ( compare_a <= now )
+								{
+									TIFR.value |= ( 1 << OCF1A ) ;
+									compare_a += timer1.size * timer1.prescaler ;
+								}
+							while ( compare_b <= now )
+								{
+									TIFR.value |= ( 1 << OCF1B ) ;
+									compare_b += timer1.size * timer1.prescaler ;
+								}
+						}
+					while ( timer2.Wrap ( now , compare ) )
+						TIFR.value |= compare ? ( 1 << OCF2 ) : ( 1 << TOV2 ) ;
+					while ( timer1.Wrap ( now , compare ) )
+						TIFR.value |= compare ? ( 1 << OCF1A ) : ( 1 << TOV1 ) ;
+				}
+
+			unsigned long Top2 ( )
+				{
+					bool ctc = ( TCCR2.value & ( ( 1 << WGM21 ) | ( 1 << WGM20 ) ) ) == ( 1 << WGM21 ) ;
+					return ctc ? OCR2.value : 0xff ;
+				}
+
+			unsigned long Top1 ( )
+				{
+					bool ctc = ( TCCR1B.value & ( ( 1 << WGM13 ) | ( 1 << WGM12 ) ) ) == ( 1 << WGM12 ) ;
+					return ctc ? OCR1A.value : 0xffff ;
+				}
+
+			SimCounter timer1 ;
+			SimCounter timer2 ;
+			unsigned long long compare_a ;
+			unsigned long long compare_b ;
+	} ;
+
+static SimTimers Timers ;
+
+static void SimTimer_Timer2Changed ( SimRegister &reg , unsigned char old_value )
+	{
+		( void ) reg ;
+		( void ) old_value ;
+		Timers.timer2.Rebase ( Sim_Now ( ) , Timer2Prescalers [ TCCR2.value & 0x07 ] , Timers.Top2 ( ) ) ;
+	}
+
+static void SimTimer_Tcnt2Written ( SimRegister &reg , unsigned char old_value )
+	{
+		( void ) old_value ;
+		Timers.timer2.Load ( Sim_Now ( ) , reg.value ) ;
+	}
+
+static unsigned char SimTimer_Tcnt2Read ( SimRegister &reg )
+	{
+		( void ) reg ;
+		return ( unsigned char ) Timers.timer2.Count ( Sim_Now ( ) ) ;
+	}
+
+static void SimTimer_Timer1Changed ( SimRegister &reg , unsigned char old_value )
+	{
+		( void ) reg ;
+		( void ) old_value ;
+		Timers.timer1.Rebase ( Sim_Now ( ) , Timer1Prescalers [ TCCR1B.value & 0x07 ] , Timers.Top1 ( ) ) ;
+		Timers.ScheduleCompares ( Sim_Now ( ) ) ;
+	}
+
+static void SimTimer_Ocr1aWritten ( SimRegister16 &reg )
+	{
+		( void ) reg ;
+		Timers.timer1.Rebase ( Sim_Now ( ) , Timer1Prescalers [ TCCR1B.value & 0x07 ] , Timers.Top1 ( ) ) ;
+		Timers.ScheduleCompares ( Sim_Now ( ) ) ;
+	}
+
+static void SimTimer_Ocr1bWritten ( SimRegister16 &reg )
+	{
+		( void ) reg ;
+		Timers.ScheduleCompares ( Sim_Now ( ) ) ;
+	}
+
+static void SimTimer_Tcnt1Written ( SimRegister16 &reg )
+	{
+		Timers.timer1.Load ( Sim_Now ( ) , reg.value ) ;
+		Timers.ScheduleCompares ( Sim_Now ( ) ) ;
+	}
+
+static unsigned int SimTimer_Tcnt1Read ( SimRegister16 &reg )
+	{
+		( void ) reg ;
+		return ( unsigned int ) Timers.timer1.Count ( Sim_Now ( ) ) ;
+	}
+
+/* TIFR flags are cleared by writing one */
+static void SimTimer_TifrWritten ( SimRegister &reg , unsigned char old_value )
+	{
+		reg.value = old_value & ~ reg.value ;
+	}
+
+void SimTimer_Install ( )
+	{
+		Sim_AddModel ( &Timers ) ;
+		TCCR2.OnWrite ( SimTimer_Timer2Changed ) ;
+		OCR2.OnWrite ( SimTimer_Timer2Changed ) ;
+		TCNT2.OnWrite ( SimTimer_Tcnt2Written ) ;
+		TCNT2.OnRead ( SimTimer_Tcnt2Read ) ;
+		TCCR1A.OnWrite ( SimTimer_Timer1Changed ) ;
+		TCCR1B.OnWrite ( SimTimer_Timer1Changed ) ;
+		OCR1A.OnWrite ( SimTimer_Ocr1aWritten ) ;
+		OCR1B.OnWrite ( SimTimer_Ocr1bWritten ) ;
+		TCNT1.OnWrite ( SimTimer_Tcnt1Written ) ;
+		TCNT1.OnRead ( SimTimer_Tcnt1Read ) ;
+		TIFR.OnWrite ( SimTimer_TifrWritten ) ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\SimTimer.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
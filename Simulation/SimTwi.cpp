@@ -0,0 +1,622 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\SimTwi.cpp
+//
+// summary:	Simulated TWI and DS1307 class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * SimTwi.cpp
+ *
+ *
+ * |_______Host simulation of the TWI master and a DS1307_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 16:02:18
+ *
+ * Filename: SimTwi.cpp
+ * Host: Linux g++(the drivers are compiled as C++)
+ * Author: Mohammad Sadr
+ * Reference:Atmega32, DS1307 and AT24C32/AT24C256 dataSheets
+ *
+ * Note:
+ *
+ *		Writing TWCR with TWINT set starts a Start, Stop or byte transfer, which ends after its bus time
+ *		(SCL period = 16 + 2*TWBR*4^TWPS cycles, 9 periods per byte). TWINT and the TWSR status code are set
+ *		at the end, like the hardware does in master mode. A Start written while a Stop is still on the bus
+ *		is sent after the Stop.
+ *		The DS1307(address 0x68) has its 64 byte register file with the address pointer, and its clock
+ *		counts the seconds in BCD from the simulated time while CH(bit7 of the seconds) is cleared.
+ *		Its SQW/OUT drives PD6: the 1Hz square wave when the control register is 0x10, else the OUT level
+ *		(the 4096Hz to 32768Hz rates are not simulated). A second lasts Sim_CyclesPerSecond() cycles, each half
+ *		period of the square wave is worked out with the CPU clock of the edge which starts it.
+ *		A 24Cxx EEPROM(address 0x50) can be attached: two address bytes, the data bytes of a write are latched
+ *		in the page(wrapping at its end) and written at the Stop, then the EEPROM does not acknowledge its
+ *		address during the 5ms write cycle. A read counts on over the pages and wraps at the end of the memory.
+ *		The PCF8574 of an LCD backpack(address 0x27) answers when SimLcd_Attach(SimLcdI2c) was called.
+ *		The SimTwiMaster functions are an other master on the bus(100kHz) which addresses the AVR in slave mode:
+ *		each step sets the slave status code and TWINT, then holds SCL low till the interrupt writes TWCR.
+ *
+ */
+
+#include <stdio.h>
+#include <vector>
+#include "Sim.h"
+
+#define Ds1307Address			0x68
+#define Ds1307Size				64
+#define EepromAddress			0x50
+#define Pcf8574Address			0x27
+#define EepromWriteUs			5000		// Write cycle of a page
+
+/* TWSR status codes of the master mode */
+#define TwiStart				0x08
+#define TwiRepeatedStart		0x10
+#define TwiSlaWAck				0x18
+#define TwiSlaWNack				0x20
+#define TwiDataWAck				0x28
+#define TwiDataWNack			0x30
+#define TwiSlaRAck				0x40
+#define TwiSlaRNack				0x48
+#define TwiDataRAck				0x50
+#define TwiDataRNack			0x58
+#define TwiNoState				0xf8
+
+#define OpNone					0
+#define OpStart					1
+#define OpStop					2
+#define OpByte					3
+
+#define StateIdle				0
+#define StateAddress			1		// Start sent, the next byte is SLA+R/W
+#define StateWrite				2
+#define StateRead				3
+#define StateNack				4
+
+/* TWSR status codes of the slave modes */
+#define TwiSlaveSlaW			0x60
+#define TwiSlaveGeneral			0x70
+#define TwiSlaveDataAck			0x80
+#define TwiSlaveDataNack		0x88
+#define TwiSlaveGeneralAck		0x90
+#define TwiSlaveGeneralNack		0x98
+#define TwiSlaveStop			0xa0
+#define TwiSlaveSlaR			0xa8
+#define TwiSlaveTxAck			0xb8
+#define TwiSlaveTxNack			0xc0
+#define TwiSlaveTxLastAck		0xc8
+
+#define ExtNone					0		// The AVR is not addressed by the other master
+#define ExtWrite				1
+#define ExtRead					2
+
+#define ExtBitUs				10		// 100kHz
+#define ExtTimeoutUs			100000	// SCL held low longer: the slave interrupt does not run
+
+#define DeviceDs1307			0
+#define DeviceEeprom			1
+#define DevicePcf8574			2
+
+static const unsigned char DaysInMonth [ 12 ] = { 0x31 , 0x28 , 0x31 , 0x30 , 0x31 , 0x30 , 0x31 , 0x31 , 0x30 , 0x31 , 0x30 , 0x31 } ;
+
+/*
+ *
+ * Description  :This function increments a BCD value and wraps it from last to first.
+ * I/P Arguments: unsigned char-->BCD value, unsigned char-->first value, unsigned char-->last value(BCD).
+ * Return value : bool-->true if it wrapped(carry to the next register).
+ *
+ */
+static bool SimTwi_BcdIncrement ( unsigned char &value , unsigned char first , unsigned char last )
+	{
+		if ( value >= last )
+			{
+				value = first ;
+				return true ;
+			}
+		value++ ;
+		if ( ( value & 0x0f ) > 9 )
+			value = ( value & 0xf0 ) + 0x10 ;
+		return false ;
+	}
+
+class SimTwi : public SimModel
+	{
+		public :
+			void Reset ( )
+				{
+					unsigned char i ;
+
+					TWSR.value = TwiNoState ;
+					TWDR.value = 0xff ;
+					TWAR.value = 0xfe ;
+					op = OpNone ;
+					done = SimNever ;
+					state = StateIdle ;
+					bus_owned = false ;
+					for ( i = 0 ; i < Ds1307Size ; i++ )
+						ram [ i ] = 0 ;
+					ram [ 3 ] = 0x01 ;		// Day, date and month start from 1
+					ram [ 4 ] = 0x01 ;
+					ram [ 5 ] = 0x01 ;
+					pointer = 0 ;
+					first_write = false ;
+					next_second = Sim_CyclesPerSecond ( ) ;
+					next_sqw = SimNever ;
+					bytes = 0 ;
+					starts = 0 ;
+					repeated_starts = 0 ;
+					stops = 0 ;
+					nacks = 0 ;
+					ee_memory.clear ( ) ;			// Detached
+					ee_page = 0 ;
+					ee_busy = 0 ;
+					ee_latched = 0 ;
+					ee_write_cycles = 0 ;
+					ee_busy_nacks = 0 ;
+					ext_state = ExtNone ;
+					ext_general = false ;
+					slave_reply = false ;
+					ext_stretch = 0 ;
+				}
+
+			unsigned long long NextEvent ( )
+				{
+					unsigned long long next = done < next_second ? done : next_second ;
+
+					return next_sqw < next ? next_sqw : next ;
+				}
+
+			void Update ( unsigned long long now )
+				{
+					while ( next_second <= now )
+						{
+							if ( ! ( ram [ 0 ] & 0x80 ) )
+								Tick ( ) ;
+							next_second += Sim_CyclesPerSecond ( ) ;
+						}
+					if ( op != OpNone && done <= now )
+						Complete ( ) ;
+					Sqw ( now ) ;
+				}
+
+			/* SQW/OUT on PD6, driven from the control register(address 7) */
+			void Sqw ( unsigned long long now )
+				{
+					if ( ( ram [ 7 ] & 0x13 ) != 0x10 )
+						{
+							if ( next_sqw != SimNever )
+								{
+									next_sqw = SimNever ;
+									SqwLevel ( ram [ 7 ] & 0x80 ) ;
+								}
+							return ;
+						}
+					if ( next_sqw == SimNever )
+						next_sqw = now + Sim_CyclesPerSecond ( ) / 2 ;
+					while ( next_sqw <= now )
+						{
+							SqwLevel ( ! ( PIND.value & ( 1 << PD6 ) ) ) ;
+							next_sqw += Sim_CyclesPerSecond ( ) / 2 ;
+						}
+				}
+
+			void SqwLevel ( bool high )
+				{
+					if ( high )
+						PIND.value |= ( 1 << PD6 ) ;
+					else
+						PIND.value &= ~ ( 1 << PD6 ) ;
+				}
+
+			unsigned long SclCycles ( )
+				{
+					static const unsigned char Prescaler [ 4 ] = { 1 , 4 , 16 , 64 } ;
+					return 16 + 2UL * TWBR.value * Prescaler [ TWSR.value & 0x03 ] ;
+				}
+
+			void Begin ( unsigned char new_op , unsigned long long now )
+				{
+					unsigned long long start = now ;
+
+					if ( op == OpStop && new_op == OpStart )
+						{
+							start = done ;		// Bus is busy with the Stop
+							Complete ( ) ;
+						}
+					op = new_op ;
+					if ( new_op == OpByte )
+						done = start + 9 * SclCycles ( ) ;
+					else
+						done = start + SclCycles ( ) ;
+				}
+
+			void Complete ( )
+				{
+					unsigned char status = TwiNoState , sla ;
+
+					switch ( op )
+						{
+							case OpStart :
+								status = bus_owned ? TwiRepeatedStart : TwiStart ;
+								if ( bus_owned )
+									repeated_starts++ ;
+								bus_owned = true ;
+								state = StateAddress ;
+								starts++ ;
+								break ;
+
+							case OpStop :
+								if ( ee_latched )
+									EepromCommit ( ) ;
+								bus_owned = false ;
+								state = StateIdle ;
+								TWCR.value &= ~ ( 1 << TWSTO ) ;
+								stops++ ;
+								break ;
+
+							case OpByte :
+								bytes++ ;
+								if ( state == StateAddress )
+									{
+										sla = TWDR.value ;
+										if ( ( sla >> 1 ) == EepromAddress && ! ee_memory.empty ( ) && done < ee_busy )
+											ee_busy_nacks++ ;		// Write cycle, the address is not acknowledged
+										if ( ( sla >> 1 ) == Ds1307Address
+											|| ( ( sla >> 1 ) == EepromAddress && ! ee_memory.empty ( ) && done >= ee_busy )
+											|| ( ( sla >> 1 ) == Pcf8574Address && SimLcd_OnTwi ( ) ) )
+											{
+												if ( ( sla >> 1 ) == Pcf8574Address )
+													device = DevicePcf8574 ;
+												else
+													device = ( ( sla >> 1 ) == Ds1307Address ) ? DeviceDs1307 : DeviceEeprom ;
+												state = ( sla & 0x01 ) ? StateRead : StateWrite ;
+												status = ( sla & 0x01 ) ? TwiSlaRAck : TwiSlaWAck ;
+												first_write = true ;
+												ee_address_bytes = 0 ;
+											}
+										else
+											{
+												state = StateNack ;
+												status = ( sla & 0x01 ) ? TwiSlaRNack : TwiSlaWNack ;
+												nacks++ ;
+											}
+									}
+								else if ( state == StateWrite && device == DevicePcf8574 )
+									{
+										SimLcd_ExpanderWritten ( TWDR.value ) ;
+										status = TwiDataWAck ;
+									}
+								else if ( state == StateRead && device == DevicePcf8574 )
+									{
+										TWDR.value = SimLcd_Expander ( ) ;
+										status = ( TWCR.value & ( 1 << TWEA ) ) ? TwiDataRAck : TwiDataRNack ;
+									}
+								else if ( state == StateWrite && device == DeviceEeprom )
+									{
+										EepromWrite ( TWDR.value ) ;
+										status = TwiDataWAck ;
+									}
+								else if ( state == StateRead && device == DeviceEeprom )
+									{
+										TWDR.value = ee_memory [ ee_pointer ] ;
+										ee_pointer = ( ee_pointer + 1 ) & ( ee_memory.size ( ) - 1 ) ;
+										status = ( TWCR.value & ( 1 << TWEA ) ) ? TwiDataRAck : TwiDataRNack ;
+									}
+								else if ( state == StateWrite )
+									{
+										if ( first_write )
+											pointer = TWDR.value & ( Ds1307Size - 1 ) ;
+										else
+											{
+												ram [ pointer ] = TWDR.value ;
+												pointer = ( pointer + 1 ) & ( Ds1307Size - 1 ) ;
+											}
+										first_write = false ;
+										status = TwiDataWAck ;
+									}
+								else if ( state == StateRead )
+									{
+										TWDR.value = ram [ pointer ] ;
+										pointer = ( pointer + 1 ) & ( Ds1307Size - 1 ) ;
+										status = ( TWCR.value & ( 1 << TWEA ) ) ? TwiDataRAck : TwiDataRNack ;
+									}
+								else
+									{
+										status = TwiDataWNack ;
+										nacks++ ;
+									}
+								break ;
+						}
+
+					TWSR.value = status | ( TWSR.value & 0x03 ) ;
+					if ( op != OpStop )
+						TWCR.value |= ( 1 << TWINT ) ;
+					op = OpNone ;
+					done = SimNever ;
+				}
+
+			/* Address bytes(high first), then the data bytes latched in the page */
+			void EepromWrite ( unsigned char data )
+				{
+					unsigned long base ;
+
+					if ( ee_address_bytes < 2 )
+						{
+							ee_pointer = ( ( ee_pointer << 8 ) | data ) & ( ee_memory.size ( ) - 1 ) ;
+							ee_address_bytes++ ;
+							return ;
+						}
+					base = ee_pointer & ~ ( unsigned long ) ( ee_page - 1 ) ;
+					if ( ee_latched == 0 )
+						ee_latch.assign ( ee_page , -1 ) ;
+					ee_latch [ ee_pointer - base ] = data ;
+					ee_latch_base = base ;
+					ee_latched++ ;
+					ee_pointer = base | ( ( ee_pointer + 1 ) & ( ee_page - 1 ) ) ;
+				}
+
+			/* Stop after data bytes: the page is written and the write cycle starts */
+			void EepromCommit ( )
+				{
+					unsigned int i ;
+
+					for ( i = 0 ; i < ee_page ; i++ )
+						if ( ee_latch [ i ] >= 0 )
+							ee_memory [ ee_latch_base + i ] = ee_latch [ i ] ;
+					ee_latched = 0 ;
+					ee_busy = done + Sim_UsToCycles ( EepromWriteUs ) ;
+					ee_write_cycles++ ;
+				}
+
+			/* One second of the DS1307 clock, 24 hour mode */
+			void Tick ( )
+				{
+					unsigned char seconds = ram [ 0 ] & 0x7f , days = DaysInMonth [ 0 ] ;
+					unsigned char month = ram [ 5 ] ;
+
+					if ( ! SimTwi_BcdIncrement ( seconds , 0x00 , 0x59 ) )
+						{
+							ram [ 0 ] = seconds ;
+							return ;
+						}
+					ram [ 0 ] = seconds ;
+					if ( ! SimTwi_BcdIncrement ( ram [ 1 ] , 0x00 , 0x59 ) )
+						return ;
+					if ( ! SimTwi_BcdIncrement ( ram [ 2 ] , 0x00 , 0x23 ) )
+						return ;
+					SimTwi_BcdIncrement ( ram [ 3 ] , 0x01 , 0x07 ) ;
+
+					if ( month >= 0x01 && month <= 0x12 )
+						days = DaysInMonth [ ( month >> 4 ) * 10 + ( month & 0x0f ) - 1 ] ;
+					if ( month == 0x02 && ( ( ( ram [ 6 ] >> 4 ) * 10 + ( ram [ 6 ] & 0x0f ) ) % 4 ) == 0 )
+						days = 0x29 ;
+					if ( ! SimTwi_BcdIncrement ( ram [ 4 ] , 0x01 , days ) )
+						return ;
+					if ( ! SimTwi_BcdIncrement ( ram [ 5 ] , 0x01 , 0x12 ) )
+						return ;
+					SimTwi_BcdIncrement ( ram [ 6 ] , 0x00 , 0x99 ) ;
+				}
+
+			unsigned char op , state , pointer ;
+			unsigned long long done , next_second , next_sqw ;
+			bool bus_owned , first_write ;
+			unsigned char ram [ Ds1307Size ] ;
+			unsigned long bytes , starts , repeated_starts , stops , nacks ;
+			unsigned char device , ee_address_bytes ;
+			std::vector < unsigned char > ee_memory ;		// Empty if no EEPROM is attached
+			std::vector < int > ee_latch ;					// Data of the page write, -1 if not written
+			unsigned int ee_page ;
+			unsigned long ee_pointer , ee_latch_base , ee_latched ;
+			unsigned long long ee_busy ;					// End of the write cycle
+			unsigned long ee_write_cycles , ee_busy_nacks ;
+			unsigned char ext_state ;
+			bool ext_general ;
+			bool slave_reply ;								// Slave status given, TWINT not cleared yet
+			unsigned long long ext_stretch ;
+	} ;
+
+static SimTwi Twi ;
+
+static void SimTwi_TwcrWritten ( SimRegister &reg , unsigned char old_value )
+	{
+		unsigned char written = reg.value ;
+
+		/* TWINT is cleared by writing one, it can not be set by software */
+		reg.value = ( written & ~ ( 1 << TWINT ) ) | ( ( written & ( 1 << TWINT ) ) ? 0 : ( old_value & ( 1 << TWINT ) ) ) ;
+
+		/* Reply of the slave interrupt: the other master goes on, TWSTO only releases the bus */
+		if ( Twi.slave_reply )
+			{
+				reg.value &= ~ ( 1 << TWSTO ) ;
+				if ( written & ( 1 << TWINT ) )
+					Twi.slave_reply = false ;
+				return ;
+			}
+
+		if ( ! ( written & ( 1 << TWEN ) ) )
+			{
+				Twi.op = OpNone ;
+				Twi.done = SimNever ;
+				Twi.state = StateIdle ;
+				Twi.bus_owned = false ;
+				return ;
+			}
+		if ( ! ( written & ( 1 << TWINT ) ) )
+			return ;
+
+		if ( written & ( 1 << TWSTO ) )
+			Twi.Begin ( OpStop , Sim_Now ( ) ) ;
+		else if ( written & ( 1 << TWSTA ) )
+			Twi.Begin ( OpStart , Sim_Now ( ) ) ;
+		else
+			Twi.Begin ( OpByte , Sim_Now ( ) ) ;
+	}
+
+/* Only the prescaler bits of TWSR can be written */
+static void SimTwi_TwsrWritten ( SimRegister &reg , unsigned char old_value )
+	{
+		reg.value = ( old_value & 0xf8 ) | ( reg.value & 0x03 ) ;
+	}
+
+void SimTwi_Install ( )
+	{
+		Sim_AddModel ( &Twi ) ;
+		TWCR.OnWrite ( SimTwi_TwcrWritten ) ;
+		TWSR.OnWrite ( SimTwi_TwsrWritten ) ;
+	}
+
+/* Gives the AVR a slave status and holds SCL low till its interrupt clears TWINT */
+static void SimTwiMaster_Status ( unsigned char status )
+	{
+		unsigned long long start = Sim_Now ( ) ;
+
+		TWSR.value = status | ( TWSR.value & 0x03 ) ;
+		TWCR.value |= ( 1 << TWINT ) ;
+		Twi.slave_reply = true ;
+		while ( TWCR.value & ( 1 << TWINT ) )
+			{
+				if ( Sim_Now ( ) - start > Sim_UsToCycles ( ExtTimeoutUs ) )
+					{
+						fprintf ( stderr , "SimTwi: the slave did not answer status 0x%02x\n" , status ) ;
+						break ;
+					}
+				Sim_AdvanceUs ( 1 ) ;
+			}
+		Twi.ext_stretch += Sim_Now ( ) - start ;
+	}
+
+bool SimTwiMaster_Start ( unsigned char sla )
+	{
+		bool general = ( sla == 0x00 ) ;
+
+		if ( Twi.ext_state == ExtWrite )
+			SimTwiMaster_Status ( TwiSlaveStop ) ;		// Repeated Start
+		Twi.ext_state = ExtNone ;
+		Sim_AdvanceUs ( 10 * ExtBitUs ) ;				// Start and the address byte
+		if ( ! ( TWCR.value & ( 1 << TWEN ) ) || ! ( TWCR.value & ( 1 << TWEA ) ) )
+			return false ;
+		if ( general ? ! ( TWAR.value & ( 1 << TWGCE ) ) : ( sla >> 1 ) != ( TWAR.value >> 1 ) )
+			return false ;
+
+		Twi.ext_general = general ;
+		Twi.ext_state = ( sla & 0x01 ) ? ExtRead : ExtWrite ;
+		SimTwiMaster_Status ( ( sla & 0x01 ) ? TwiSlaveSlaR : ( general ? TwiSlaveGeneral : TwiSlaveSlaW ) ) ;
+		return true ;
+	}
+
+bool SimTwiMaster_Write ( unsigned char data )
+	{
+		bool ack = ( TWCR.value & ( 1 << TWEA ) ) != 0 ;
+
+		if ( Twi.ext_state != ExtWrite )
+			return false ;
+		Sim_AdvanceUs ( 9 * ExtBitUs ) ;
+		TWDR.value = data ;
+		if ( Twi.ext_general )
+			SimTwiMaster_Status ( ack ? TwiSlaveGeneralAck : TwiSlaveGeneralNack ) ;
+		else
+			SimTwiMaster_Status ( ack ? TwiSlaveDataAck : TwiSlaveDataNack ) ;
+		if ( ! ack )
+			Twi.ext_state = ExtNone ;
+		return ack ;
+	}
+
+unsigned char SimTwiMaster_Read ( bool ack )
+	{
+		bool more = ( TWCR.value & ( 1 << TWEA ) ) != 0 ;		// Cleared by the slave for its last byte
+		unsigned char data ;
+
+		if ( Twi.ext_state != ExtRead )
+			return 0xff ;
+		Sim_AdvanceUs ( 9 * ExtBitUs ) ;
+		data = TWDR.value ;
+		if ( ! ack )
+			SimTwiMaster_Status ( TwiSlaveTxNack ) ;
+		else
+			SimTwiMaster_Status ( more ? TwiSlaveTxAck : TwiSlaveTxLastAck ) ;
+		if ( ! ack || ! more )
+			Twi.ext_state = ExtNone ;
+		return data ;
+	}
+
+void SimTwiMaster_Stop ( )
+	{
+		Sim_AdvanceUs ( ExtBitUs ) ;
+		if ( Twi.ext_state == ExtWrite )
+			SimTwiMaster_Status ( TwiSlaveStop ) ;
+		Twi.ext_state = ExtNone ;
+	}
+
+unsigned long SimTwiMaster_StretchCycles ( )
+	{
+		return Twi.ext_stretch ;
+	}
+
+void SimDs1307_SetRegister ( unsigned char address , unsigned char data )
+	{
+		Twi.ram [ address & ( Ds1307Size - 1 ) ] = data ;
+	}
+
+unsigned char SimDs1307_GetRegister ( unsigned char address )
+	{
+		return Twi.ram [ address & ( Ds1307Size - 1 ) ] ;
+	}
+
+void Sim24Cxx_Attach ( unsigned long size , unsigned int page_size )
+	{
+		Twi.ee_memory.assign ( size , 0xff ) ;
+		Twi.ee_page = page_size ;
+		Twi.ee_pointer = 0 ;
+	}
+
+void Sim24Cxx_Set ( unsigned long address , unsigned char data )
+	{
+		Twi.ee_memory [ address & ( Twi.ee_memory.size ( ) - 1 ) ] = data ;
+	}
+
+unsigned char Sim24Cxx_Get ( unsigned long address )
+	{
+		return Twi.ee_memory [ address & ( Twi.ee_memory.size ( ) - 1 ) ] ;
+	}
+
+unsigned long Sim24Cxx_WriteCycles ( )
+	{
+		return Twi.ee_write_cycles ;
+	}
+
+unsigned long Sim24Cxx_BusyNacks ( )
+	{
+		return Twi.ee_busy_nacks ;
+	}
+
+unsigned long SimTwi_Bytes ( )
+	{
+		return Twi.bytes ;
+	}
+
+unsigned long SimTwi_Starts ( )
+	{
+		return Twi.starts ;
+	}
+
+unsigned long SimTwi_RepeatedStarts ( )
+	{
+		return Twi.repeated_starts ;
+	}
+
+unsigned long SimTwi_Stops ( )
+	{
+		return Twi.stops ;
+	}
+
+void SimTwi_Print ( )
+	{
+		printf ( "  twi: starts=%lu repeated=%lu stops=%lu bytes=%lu nacks=%lu twcr_reads=%lu twcr_writes=%lu scl=%lu cycles\n" ,
+			Twi.starts , Twi.repeated_starts , Twi.stops , Twi.bytes , Twi.nacks , TWCR.reads , TWCR.writes , Twi.SclCycles ( ) ) ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\SimTwi.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
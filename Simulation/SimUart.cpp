@@ -0,0 +1,399 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\SimUart.cpp
+//
+// summary:	Simulated UART class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * SimUart.cpp
+ *
+ *
+ * |_______Host simulation of the USART_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 16:02:18
+ *
+ * Filename: SimUart.cpp
+ * Host: Linux g++(the drivers are compiled as C++)
+ * Author: Mohammad Sadr
+ * Reference:Atmega32 dataSheet
+ *
+ * Note:
+ *
+ *		Transmitter: UDR buffer and shift register. UDRE is cleared while both are full,
+ *		TXC is set when the last frame is out. The frame time comes from UBRR, U2X and the frame format.
+ *		Receiver: 2 byte FIFO, DOR is set when a byte arrives while the FIFO is full(the byte is lost).
+ *		UBRRH and UCSRC share their address: a write with URSEL cleared goes to UBRRH, set goes to UCSRC.
+ *		9-bit frames: TXB8 is taken with UDR, RXB8 shows the ninth bit of the oldest received byte.
+ *		With MPCM set the receiver drops the frames which have the ninth bit cleared.
+ *		Two models: Uart on the USART of the Atmega32(port 0) and Uart1 on the second USART of the
+ *		Atmega128/1284(UDR1, UCSR1A, ...), the register hooks find their model with SimUart_Of().
+ *
+ */
+
+#include <deque>
+#include <stdio.h>
+#include "Sim.h"
+
+#define RxFifoSize				2
+
+class SimUart : public SimModel
+	{
+		public :
+			SimUart ( SimRegister &udr_reg , SimRegister &ucsra_reg , SimRegister &ucsrb_reg , SimRegister &ucsrc_reg ,
+					SimRegister &ubrrh_reg , SimRegister &ubrrl_reg ) :
+				udr ( udr_reg ) , ucsra ( ucsra_reg ) , ucsrb ( ucsrb_reg ) , ucsrc ( ucsrc_reg ) , ubrrh ( ubrrh_reg ) , ubrrl ( ubrrl_reg )
+				{
+				}
+
+			void Reset ( )
+				{
+					ucsra.value = ( 1 << UDRE ) ;
+					ucsrc.value = ( 1 << URSEL ) | ( 1 << UCSZ1 ) | ( 1 << UCSZ0 ) ;
+					tx_full = false ;
+					tx_busy = false ;
+					rx_count = 0 ;
+					rx_line.clear ( ) ;
+					rx_next = SimNever ;
+					loopback = false ;
+					output.clear ( ) ;
+					tx_bytes = 0 ;
+					tx_lost = 0 ;
+					tx_addresses = 0 ;
+					rx_bytes = 0 ;
+					overruns = 0 ;
+					mpcm_dropped = 0 ;
+				}
+
+			unsigned long long NextEvent ( )
+				{
+					unsigned long long next = tx_busy ? tx_done : SimNever ;
+
+					if ( ! rx_line.empty ( ) && rx_next < next )
+						next = rx_next ;
+					return next ;
+				}
+
+			void Update ( unsigned long long now )
+				{
+					while ( tx_busy && tx_done <= now )
+						{
+							output += ( char ) tx_shift ;
+							if ( loopback )
+								Receive ( tx_shift | ( tx_shift9 << 8 ) ) ;
+							if ( tx_full )
+								{
+									tx_shift = tx_buffer ;
+									tx_shift9 = tx_buffer9 ;
+									tx_full = false ;
+									tx_done += FrameCycles ( ) ;
+									ucsra.value |= ( 1 << UDRE ) ;
+								}
+							else
+								{
+									tx_busy = false ;
+									ucsra.value |= ( 1 << TXC ) ;
+								}
+						}
+
+					while ( ! rx_line.empty ( ) && rx_next <= now )
+						{
+							Receive ( rx_line.front ( ) ) ;
+							rx_line.pop_front ( ) ;
+							rx_next += FrameCycles ( ) ;
+						}
+				}
+
+			bool NineBits ( )
+				{
+					return ( ucsrb.value & ( 1 << UCSZ2 ) ) && ( ucsrc.value & ( 3 << UCSZ0 ) ) == ( 3 << UCSZ0 ) ;
+				}
+
+			unsigned long FrameCycles ( )
+				{
+					unsigned int ubrr = ( ( ubrrh.value & 0x0f ) << 8 ) | ubrrl.value ;
+					unsigned char size = ( ( ucsrb.value & ( 1 << UCSZ2 ) ) ? 4 : 0 ) | ( ( ucsrc.value >> UCSZ0 ) & 0x03 ) ;
+					unsigned char bits = 1 + ( size == 7 ? 9 : size + 5 ) + 1 ;
+
+					if ( ucsrc.value & ( 1 << UPM1 ) )
+						bits++ ;							// Parity
+					if ( ucsrc.value & ( 1 << USBS ) )
+						bits++ ;							// Second stop bit
+					return ( unsigned long ) bits * ( ( ucsra.value & ( 1 << U2X ) ) ? 8 : 16 ) * ( ubrr + 1 ) ;
+				}
+
+			void Transmit ( unsigned char data )
+				{
+					bool bit9 ;
+
+					if ( ! ( ucsrb.value & ( 1 << TXEN ) ) || ! ( ucsra.value & ( 1 << UDRE ) ) )
+						{
+							tx_lost++ ;						// Ignored by the transmitter
+							return ;
+						}
+					tx_bytes++ ;
+					bit9 = NineBits ( ) && ( ucsrb.value & ( 1 << TXB8 ) ) ;
+					if ( bit9 )
+						tx_addresses++ ;
+					if ( ! tx_busy )
+						{
+							tx_shift = data ;
+							tx_shift9 = bit9 ;
+							tx_busy = true ;
+							tx_done = Sim_Now ( ) + FrameCycles ( ) ;
+						}
+					else
+						{
+							tx_buffer = data ;
+							tx_buffer9 = bit9 ;
+							tx_full = true ;
+							ucsra.value &= ~ ( 1 << UDRE ) ;
+						}
+				}
+
+			void Receive ( unsigned int data )
+				{
+					if ( ! ( ucsrb.value & ( 1 << RXEN ) ) )
+						return ;
+					if ( ! NineBits ( ) )
+						data &= 0xff ;
+					else if ( ( ucsra.value & ( 1 << MPCM ) ) && ! ( data & 0x100 ) )
+						{
+							mpcm_dropped++ ;
+							return ;
+						}
+					if ( rx_count == RxFifoSize )
+						{
+							ucsra.value |= ( 1 << DOR ) ;
+							overruns++ ;
+							return ;
+						}
+					rx_fifo [ rx_count++ ] = data ;
+					rx_bytes++ ;
+					ucsra.value |= ( 1 << RXC ) ;
+					ShowRxb8 ( ) ;
+				}
+
+			void ShowRxb8 ( )
+				{
+					if ( rx_count && ( rx_fifo [ 0 ] & 0x100 ) )
+						ucsrb.value |= ( 1 << RXB8 ) ;
+					else
+						ucsrb.value &= ~ ( 1 << RXB8 ) ;
+				}
+
+			unsigned char Read ( unsigned char last )
+				{
+					unsigned char data ;
+
+					if ( rx_count == 0 )
+						return last ;
+					data = rx_fifo [ 0 ] ;
+					rx_fifo [ 0 ] = rx_fifo [ 1 ] ;
+					rx_count-- ;
+					ShowRxb8 ( ) ;
+					ucsra.value &= ~ ( 1 << DOR ) ;
+					if ( rx_count == 0 )
+						ucsra.value &= ~ ( 1 << RXC ) ;
+					return data ;
+				}
+
+			bool Owns ( SimRegister &reg )
+				{
+					return &reg == &udr || &reg == &ucsra || &reg == &ucsrb || &reg == &ucsrc || &reg == &ubrrh || &reg == &ubrrl ;
+				}
+
+			SimRegister &udr , &ucsra , &ucsrb , &ucsrc , &ubrrh , &ubrrl ;
+			bool tx_full , tx_busy , loopback , tx_buffer9 , tx_shift9 ;
+			unsigned char tx_buffer , tx_shift ;
+			unsigned long long tx_done ;
+			unsigned int rx_fifo [ RxFifoSize ] ;			// Bit 8 is the ninth bit
+			unsigned char rx_count ;
+			std::deque < unsigned int > rx_line ;
+			unsigned long long rx_next ;
+			std::string output ;
+			unsigned long tx_bytes , tx_lost , tx_addresses , rx_bytes , overruns , mpcm_dropped ;
+	} ;
+
+static SimUart Uart ( UDR , UCSRA , UCSRB , UCSRC , UBRRH , UBRRL ) ;
+static SimUart Uart1 ( UDR1 , UCSR1A , UCSR1B , UCSR1C , UBRR1H , UBRR1L ) ;
+
+/* The model of the USART the register belongs to */
+static SimUart &SimUart_Of ( SimRegister &reg )
+	{
+		return Uart1.Owns ( reg ) ? Uart1 : Uart ;
+	}
+
+static void SimUart_UdrWritten ( SimRegister &reg , unsigned char old_value )
+	{
+		( void ) old_value ;
+		SimUart_Of ( reg ).Transmit ( reg.value ) ;
+	}
+
+static unsigned char SimUart_UdrRead ( SimRegister &reg )
+	{
+		return SimUart_Of ( reg ).Read ( reg.value ) ;
+	}
+
+/* Only U2X and MPCM can be written, TXC is cleared by writing one */
+static void SimUart_UcsraWritten ( SimRegister &reg , unsigned char old_value )
+	{
+		unsigned char writable = ( 1 << U2X ) | ( 1 << MPCM ) ;
+		unsigned char written = reg.value ;
+
+		reg.value = ( old_value & ~ writable ) | ( written & writable ) ;
+		if ( written & ( 1 << TXC ) )
+			reg.value &= ~ ( 1 << TXC ) ;
+	}
+
+static void SimUart_UcsrcWritten ( SimRegister &reg , unsigned char old_value )
+	{
+		if ( ! ( reg.value & ( 1 << URSEL ) ) )
+			{
+				SimUart_Of ( reg ).ubrrh.value = reg.value ;
+				reg.value = old_value ;
+			}
+	}
+
+static void SimUart_UbrrhWritten ( SimRegister &reg , unsigned char old_value )
+	{
+		if ( reg.value & ( 1 << URSEL ) )
+			{
+				SimUart_Of ( reg ).ucsrc.value = reg.value ;
+				reg.value = old_value ;
+			}
+	}
+
+/* RXB8 is read only */
+static void SimUart_UcsrbWritten ( SimRegister &reg , unsigned char old_value )
+	{
+		SimUart &uart = SimUart_Of ( reg ) ;
+
+		reg.value = ( reg.value & ~ ( 1 << RXB8 ) ) | ( old_value & ( 1 << RXB8 ) ) ;
+		if ( ! ( reg.value & ( 1 << RXEN ) ) )
+			{
+				uart.rx_count = 0 ;				// Disabling the receiver flushes the FIFO
+				uart.ucsra.value &= ~ ( ( 1 << RXC ) | ( 1 << DOR ) ) ;
+				reg.value &= ~ ( 1 << RXB8 ) ;
+			}
+	}
+
+void SimUart_Install ( )
+	{
+		SimUart *ports [ 2 ] = { &Uart , &Uart1 } ;
+		unsigned char i ;
+
+		for ( i = 0 ; i < 2 ; i++ )
+			{
+				Sim_AddModel ( ports [ i ] ) ;
+				ports [ i ]->udr.OnWrite ( SimUart_UdrWritten ) ;
+				ports [ i ]->udr.OnRead ( SimUart_UdrRead ) ;
+				ports [ i ]->ucsra.OnWrite ( SimUart_UcsraWritten ) ;
+				ports [ i ]->ucsrb.OnWrite ( SimUart_UcsrbWritten ) ;
+				ports [ i ]->ucsrc.OnWrite ( SimUart_UcsrcWritten ) ;
+				ports [ i ]->ubrrh.OnWrite ( SimUart_UbrrhWritten ) ;
+			}
+	}
+
+void SimUart_Loopback ( bool on )
+	{
+		Uart.loopback = on ;
+	}
+
+void SimUart_Inject ( const std::string &data )
+	{
+		unsigned int i ;
+
+		if ( Uart.rx_line.empty ( ) )
+			Uart.rx_next = Sim_Now ( ) + Uart.FrameCycles ( ) ;
+		for ( i = 0 ; i < data.size ( ) ; i++ )
+			Uart.rx_line.push_back ( ( unsigned char ) data [ i ] ) ;
+	}
+
+void SimUart_InjectFrame ( unsigned int frame )
+	{
+		if ( Uart.rx_line.empty ( ) )
+			Uart.rx_next = Sim_Now ( ) + Uart.FrameCycles ( ) ;
+		Uart.rx_line.push_back ( frame & 0x1ff ) ;
+	}
+
+unsigned long SimUart_TxAddressFrames ( )
+	{
+		return Uart.tx_addresses ;
+	}
+
+unsigned long SimUart_MpcmDropped ( )
+	{
+		return Uart.mpcm_dropped ;
+	}
+
+std::string SimUart_Output ( )
+	{
+		return Uart.output ;
+	}
+
+unsigned long SimUart_FrameCycles ( )
+	{
+		return Uart.FrameCycles ( ) ;
+	}
+
+unsigned long SimUart_Overruns ( )
+	{
+		return Uart.overruns ;
+	}
+
+void SimUart_Print ( )
+	{
+		printf ( "  uart: tx=%lu rx=%lu lost=%lu overruns=%lu ucsra_reads=%lu udr_writes=%lu frame=%lu cycles\n" ,
+			Uart.tx_bytes , Uart.rx_bytes , Uart.tx_lost , Uart.overruns , UCSRA.reads , UDR.writes , Uart.FrameCycles ( ) ) ;
+	}
+
+void SimUart1_Inject ( const std::string &data )
+	{
+		unsigned int i ;
+
+		if ( Uart1.rx_line.empty ( ) )
+			Uart1.rx_next = Sim_Now ( ) + Uart1.FrameCycles ( ) ;
+		for ( i = 0 ; i < data.size ( ) ; i++ )
+			Uart1.rx_line.push_back ( ( unsigned char ) data [ i ] ) ;
+	}
+
+void SimUart1_InjectFrame ( unsigned int frame )
+	{
+		if ( Uart1.rx_line.empty ( ) )
+			Uart1.rx_next = Sim_Now ( ) + Uart1.FrameCycles ( ) ;
+		Uart1.rx_line.push_back ( frame & 0x1ff ) ;
+	}
+
+std::string SimUart1_Output ( )
+	{
+		return Uart1.output ;
+	}
+
+unsigned long SimUart1_FrameCycles ( )
+	{
+		return Uart1.FrameCycles ( ) ;
+	}
+
+unsigned long SimUart1_Overruns ( )
+	{
+		return Uart1.overruns ;
+	}
+
+unsigned long SimUart1_MpcmDropped ( )
+	{
+		return Uart1.mpcm_dropped ;
+	}
+
+void SimUart1_Print ( )
+	{
+		printf ( "  uart1: tx=%lu rx=%lu lost=%lu overruns=%lu ucsr1a_reads=%lu udr1_writes=%lu frame=%lu cycles\n" ,
+			Uart1.tx_bytes , Uart1.rx_bytes , Uart1.tx_lost , Uart1.overruns , UCSR1A.reads , UDR1.writes , Uart1.FrameCycles ( ) ) ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\SimUart.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
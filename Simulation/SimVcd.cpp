@@ -0,0 +1,198 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\SimVcd.cpp
+//
+// summary:	Simulated logic analyzer class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * SimVcd.cpp
+ *
+ *
+ * |_______Host logic analyzer on the port pins with VCD export_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 18:31:47
+ *
+ * Filename: SimVcd.cpp
+ * Host: Linux g++(the drivers are compiled as C++)
+ * Author: Mohammad Sadr
+ * Reference:IEEE 1364 value change dump format
+ *
+ * Note:
+ *
+ *		A test watches port bits with SimVcd_Watch() after Sim_Reset(), each change of a watched bit
+ *		written by the drivers is recorded with its cycle. The pulse counters give the high times in cycles,
+ *		SimVcd_Write() saves the changes as a VCD file(1ns time scale) for GTKWave or PulseView,
+ *		the same view a logic analyzer on the trace pins(see Trace.h) gives on the board.
+ *		The PORT register is recorded, the DDR bit is not checked.
+ *
+ */
+
+#include <stdio.h>
+#include <vector>
+#include "Sim.h"
+
+#define VcdMaxSignals			8
+
+typedef struct
+	{
+		const char *name ;
+		SimRegister *port ;
+		unsigned char bit ;
+		bool start ;						// Level when the watch started
+		bool level ;
+		unsigned long long rise ;			// Cycle of the last rising edge
+		unsigned long pulses ;
+		unsigned long long min_high ;
+		unsigned long long max_high ;
+	} VcdSignal ;
+
+typedef struct
+	{
+		unsigned long long cycle ;
+		unsigned char signal ;
+		bool level ;
+	} VcdChange ;
+
+class SimVcd : public SimModel
+	{
+		public :
+			void Reset ( )
+				{
+					count = 0 ;
+					changes.clear ( ) ;
+				}
+
+			VcdSignal signals [ VcdMaxSignals ] ;
+			unsigned char count ;
+			std::vector < VcdChange > changes ;
+	} ;
+
+static SimVcd Vcd ;
+
+static void SimVcd_PortWritten ( SimRegister &reg , unsigned char old_value )
+	{
+		unsigned char i ;
+		VcdSignal *signal ;
+		VcdChange change ;
+		unsigned long long high ;
+
+		for ( i = 0 ; i < Vcd.count ; i++ )
+			{
+				signal = &Vcd.signals [ i ] ;
+				if ( signal->port != &reg || ! ( ( reg.value ^ old_value ) & ( 1 << signal->bit ) ) )
+					continue ;
+				signal->level = ( reg.value >> signal->bit ) & 1 ;
+				if ( signal->level )
+					signal->rise = Sim_Now ( ) ;
+				else
+					{
+						high = Sim_Now ( ) - signal->rise ;
+						signal->pulses++ ;
+						if ( high < signal->min_high )
+							signal->min_high = high ;
+						if ( high > signal->max_high )
+							signal->max_high = high ;
+					}
+				change.cycle = Sim_Now ( ) ;
+				change.signal = i ;
+				change.level = signal->level ;
+				Vcd.changes.push_back ( change ) ;
+			}
+	}
+
+void SimVcd_Install ( )
+	{
+		Sim_AddModel ( &Vcd ) ;
+		PORTA.OnWrite ( SimVcd_PortWritten ) ;
+		PORTB.OnWrite ( SimVcd_PortWritten ) ;
+		PORTC.OnWrite ( SimVcd_PortWritten ) ;
+		PORTD.OnWrite ( SimVcd_PortWritten ) ;
+	}
+
+unsigned char SimVcd_Watch ( const char *name , SimRegister &port , unsigned char bit )
+	{
+		VcdSignal *signal ;
+
+		if ( Vcd.count >= VcdMaxSignals )
+			{
+				fprintf ( stderr , "Sim: too many VCD signals(%s)\n" , name ) ;
+				return VcdMaxSignals - 1 ;
+			}
+		signal = &Vcd.signals [ Vcd.count ] ;
+		signal->name = name ;
+		signal->port = &port ;
+		signal->bit = bit & 0x07 ;
+		signal->level = ( port.value >> signal->bit ) & 1 ;
+		signal->start = signal->level ;
+		signal->rise = Sim_Now ( ) ;
+		signal->pulses = 0 ;
+		signal->min_high = SimNever ;
+		signal->max_high = 0 ;
+		return Vcd.count++ ;
+	}
+
+unsigned long SimVcd_Pulses ( unsigned char signal )
+	{
+		return ( signal < Vcd.count ) ? Vcd.signals [ signal ].pulses : 0 ;
+	}
+
+unsigned long long SimVcd_MinHigh ( unsigned char signal )
+	{
+		return ( signal < Vcd.count && Vcd.signals [ signal ].pulses ) ? Vcd.signals [ signal ].min_high : 0 ;
+	}
+
+unsigned long long SimVcd_MaxHigh ( unsigned char signal )
+	{
+		return ( signal < Vcd.count ) ? Vcd.signals [ signal ].max_high : 0 ;
+	}
+
+bool SimVcd_Write ( const char *file )
+	{
+		FILE *vcd ;
+		unsigned char i ;
+		std::vector < VcdChange >::const_iterator change ;
+		unsigned long long last = SimNever ;
+
+		vcd = fopen ( file , "w" ) ;
+		if ( vcd == 0 )
+			return false ;
+
+		fprintf ( vcd , "$timescale 1ns $end\n$scope module trace $end\n" ) ;
+		for ( i = 0 ; i < Vcd.count ; i++ )
+			fprintf ( vcd , "$var wire 1 %c %s $end\n" , '!' + i , Vcd.signals [ i ].name ) ;
+		fprintf ( vcd , "$upscope $end\n$enddefinitions $end\n#0\n$dumpvars\n" ) ;
+		for ( i = 0 ; i < Vcd.count ; i++ )
+			fprintf ( vcd , "%d%c\n" , Vcd.signals [ i ].start ? 1 : 0 , '!' + i ) ;
+		fprintf ( vcd , "$end\n" ) ;
+
+		for ( change = Vcd.changes.begin ( ) ; change != Vcd.changes.end ( ) ; ++change )
+			{
+				if ( change->cycle != last )
+					fprintf ( vcd , "#%llu\n" , change->cycle * 1000000000ULL / F_CPU ) ;
+				last = change->cycle ;
+				fprintf ( vcd , "%d%c\n" , change->level ? 1 : 0 , '!' + change->signal ) ;
+			}
+		fprintf ( vcd , "#%llu\n" , Sim_Now ( ) * 1000000000ULL / F_CPU ) ;
+		return fclose ( vcd ) == 0 ;
+	}
+
+void SimVcd_Print ( )
+	{
+		unsigned char i ;
+		VcdSignal *signal ;
+
+		for ( i = 0 ; i < Vcd.count ; i++ )
+			{
+				signal = &Vcd.signals [ i ] ;
+				printf ( "  vcd: %s pulses=%lu min_high=%llu max_high=%llu cycles\n" , signal->name , signal->pulses ,
+						 signal->pulses ? signal->min_high : 0ULL , signal->max_high ) ;
+			}
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\SimVcd.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,66 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Tests\TestAdc.cpp
+//
+// summary:	ADC test on the simulated ADC
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * TestAdc.cpp
+ *
+ *
+ * |_______ADC.c on the simulated ADC_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 16:02:18
+ *
+ * Filename: TestAdc.cpp
+ * Host: Linux g++(the drivers are compiled as C++)
+ * Author: Mohammad Sadr
+ *
+ */
+
+#include <stdio.h>
+#include "Sim.h"
+#include "Scheduler.h"
+#include "ADC.h"
+
+int main ( )
+	{
+		unsigned char channel ;
+
+		Sim_Reset ( ) ;
+		for ( channel = 0 ; channel < 8 ; channel++ )
+			SimAdc_SetInput ( channel , 100 * channel + 1 ) ;
+
+		/* Blocking conversions of different channels, one after the other */
+		ADC_Init ( ) ;
+		SIM_Check ( ADC_StartConversion ( 2 ) == 201 ) ;
+		SIM_Check ( ADC_StartConversion ( 5 ) == 501 ) ;
+		SIM_Check ( ADC_StartConversion ( 0 ) == 1 ) ;
+		SIM_Check ( SimAdc_Conversions ( ) == 3 ) ;
+
+		/* Background sampling of channels 1, 3 and 7 by the scheduler */
+		SimAdc_SetInput ( 3 , 1023 ) ;
+		SCHED_Init ( ) ;
+		ADC_SampleStart ( 0x8a , 1 ) ;
+		while ( SCHED_Millis ( ) < 20 )
+			{
+				SCHED_Run ( ) ;
+				Sim_AdvanceUs ( 100 ) ;
+			}
+		ADC_SampleStop ( ) ;
+		SIM_Check ( ADC_GetSample ( 1 ) == 101 ) ;
+		SIM_Check ( ADC_GetSample ( 3 ) == 1023 ) ;
+		SIM_Check ( ADC_GetSample ( 7 ) == 701 ) ;
+		SIM_Check ( ADC_GetSample ( 2 ) == 0 ) ;
+
+		SimAdc_Print ( ) ;
+		return Sim_Summary ( "TestAdc" ) ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Tests\TestAdc.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
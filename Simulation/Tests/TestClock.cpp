@@ -0,0 +1,99 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Tests\TestClock.cpp
+//
+// summary:	OSCCAL calibration test against the simulated DS1307 SQW/OUT
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * TestClock.cpp
+ *
+ *
+ * |_______Clock.c with an internal RC oscillator following OSCCAL_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 23:41:37
+ *
+ * Filename: TestClock.cpp
+ * Host: Linux g++(the drivers are compiled as C++)
+ * Author: Mohammad Sadr
+ *
+ */
+
+#include <stdio.h>
+#include "Sim.h"
+#include "Clock.h"
+#include "RTC_DS1307.h"
+
+#define FactoryOsccal			0xa0		// The 1 MHz calibration byte loaded at reset
+
+/* Error of the CPU clock in 1/10000 */
+static long ClockError ( )
+	{
+		return ( ( long ) Sim_CyclesPerSecond ( ) - ( long ) F_CPU ) / ( long ) ( F_CPU / 10000 ) ;
+	}
+
+int main ( )
+	{
+		unsigned long long start ;
+		unsigned long bytes , writes ;
+		unsigned int counts ;
+		unsigned char osccal ;
+
+		/* 4 to 12 MHz over the OSCCAL range, 12.7% fast with the factory byte */
+		Sim_Reset ( ) ;
+		Sim_RcOscillator ( 4000000UL , 12000000UL ) ;
+		OSCCAL.value = FactoryOsccal ;
+		SIM_Check ( ClockError ( ) > 1000 ) ;
+
+		/* No SQW/OUT: time out after 4 half seconds, OSCCAL not changed */
+		start = Sim_Now ( ) ;
+		SIM_Check ( CLOCK_Measure ( ) == 0 ) ;
+		SIM_Check ( Sim_Now ( ) - start >= 4 * CLOCK_HalfSecond * CLOCK_Divider ) ;
+		SIM_Check ( OSCCAL.value == FactoryOsccal ) ;
+
+		/* First start: the EEPROM is erased, OSCCAL is tuned and stored */
+		TCCR1B = ( 1 << CS10 ) ;					// Timer1 of an other driver
+		start = Sim_Now ( ) ;
+		SIM_Check ( CLOCK_Init ( ) == CLOCK_Calibrated ) ;
+		osccal = OSCCAL.value ;
+		Sim_AdvanceUs ( 10000 ) ;					// Second EEPROM write
+		SIM_Check ( ClockError ( ) >= -50 && ClockError ( ) <= 50 ) ;
+		SIM_Check ( SimEeprom_Get ( CLOCK_EepromAddress ) == osccal ) ;
+		SIM_Check ( SimEeprom_Get ( CLOCK_EepromAddress + 1 ) == ( unsigned char ) ~ osccal ) ;
+		SIM_Check ( SimDs1307_GetRegister ( 7 ) == DS1307_SqwOff ) ;
+		SIM_Check ( TCCR1B.value == ( 1 << CS10 ) && TCCR1A.value == 0 ) ;
+		SIM_Check ( Sim_Now ( ) - start < 10ULL * Sim_CyclesPerSecond ( ) ) ;
+		printf ( "  CLOCK_Calibrate: OSCCAL 0x%02x, %lu Hz, %.1f s\n" ,
+			osccal , Sim_CyclesPerSecond ( ) , ( double ) ( Sim_Now ( ) - start ) / Sim_CyclesPerSecond ( ) ) ;
+
+		/* The tuned clock measured again */
+		DS1307_SetControl ( DS1307_Sqw1Hz ) ;
+		counts = CLOCK_Measure ( ) ;
+		DS1307_SetControl ( DS1307_SqwOff ) ;
+		SIM_Check ( counts + CLOCK_Tolerance >= CLOCK_HalfSecond && counts <= CLOCK_HalfSecond + CLOCK_Tolerance ) ;
+
+		/* Next reset: OSCCAL from EEPROM, the DS1307 is not used */
+		OSCCAL.value = FactoryOsccal ;
+		bytes = SimTwi_Bytes ( ) ;
+		writes = SimEeprom_Writes ( ) ;
+		start = Sim_Now ( ) ;
+		SIM_Check ( CLOCK_Init ( ) == CLOCK_Loaded && OSCCAL.value == osccal ) ;
+		SIM_Check ( SimTwi_Bytes ( ) == bytes && SimEeprom_Writes ( ) == writes ) ;
+		SIM_Check ( Sim_Now ( ) - start < Sim_UsToCycles ( 5000 ) ) ;
+
+		/* Out of the OSCCAL range: the fastest is kept, nothing stored */
+		Sim_RcOscillator ( 2000000UL , 6000000UL ) ;
+		SIM_Check ( CLOCK_Calibrate ( ) == CLOCK_Failed ) ;
+		SIM_Check ( OSCCAL.value == 0xff ) ;
+		SIM_Check ( SimEeprom_Writes ( ) == writes && SimEeprom_Get ( CLOCK_EepromAddress ) == osccal ) ;
+
+		SimTwi_Print ( ) ;
+		return Sim_Summary ( "TestClock" ) ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Tests\TestClock.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
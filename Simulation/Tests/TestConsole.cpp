@@ -0,0 +1,148 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Tests\TestConsole.cpp
+//
+// summary:	Console test on the simulated USART
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * TestConsole.cpp
+ *
+ *
+ * |_______Console.c on the UART receive ring_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 19:41:12
+ *
+ * Filename: TestConsole.cpp
+ * Host: Linux g++(the drivers are compiled as C++)
+ * Author: Mohammad Sadr
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <avr/pgmspace.h>
+#include "Sim.h"
+#include "UART.h"
+#include "Console.h"
+
+static unsigned int SetCalls , SetValue ;
+static unsigned char LastArgc ;
+static std::string LastArgs ;
+
+static void Set ( unsigned char argc , char **argv )
+	{
+		unsigned char i ;
+
+		SetCalls++ ;
+		LastArgc = argc ;
+		LastArgs = "" ;
+		for ( i = 0 ; i < argc ; i++ )
+			LastArgs += std::string ( argv [ i ] ) + "|" ;
+		if ( argc != 2 || ! CONSOLE_ArgNumber ( argv [ 1 ] , &SetValue ) )
+			SetValue = 0xffff ;
+	}
+
+static void Ping ( unsigned char argc , char **argv )
+	{
+		( void ) argc ;
+		( void ) argv ;
+		UART_TxChar ( 'P' ) ;
+	}
+
+static const ConsoleCommand Commands [ ] PROGMEM =
+	{
+		{ "set" , Set } ,
+		{ "ping" , Ping } ,
+		{ "" , 0 }
+	} ;
+
+/* Sends the text to RXD, the console is polled every 4 frames till it is received */
+static void Type ( const std::string &text )
+	{
+		unsigned int i ;
+
+		SimUart_Inject ( text ) ;
+		for ( i = 0 ; i <= text.size ( ) ; i += 4 )
+			{
+				Sim_AdvanceTo ( Sim_Now ( ) + 4 * SimUart_FrameCycles ( ) ) ;
+				CONSOLE_Poll ( ) ;
+			}
+	}
+
+/* Output since the last call, after the last frame is out */
+static std::string Output ( )
+	{
+		static unsigned int seen ;
+		std::string out ;
+
+		Sim_AdvanceTo ( Sim_Now ( ) + 2 * SimUart_FrameCycles ( ) ) ;
+		out = SimUart_Output ( ).substr ( seen ) ;
+		seen = SimUart_Output ( ).size ( ) ;
+		return out ;
+	}
+
+int main ( )
+	{
+		unsigned int value ;
+
+		SIM_Check ( CONSOLE_ArgNumber ( "65535" , &value ) && value == 65535 ) ;
+		SIM_Check ( CONSOLE_ArgNumber ( "0x1aF" , &value ) && value == 0x1af ) ;
+		SIM_Check ( ! CONSOLE_ArgNumber ( "65536" , &value ) && ! CONSOLE_ArgNumber ( "12a" , &value ) ) ;
+		SIM_Check ( ! CONSOLE_ArgNumber ( "" , &value ) && ! CONSOLE_ArgNumber ( "0x" , &value ) ) ;
+
+		Sim_Reset ( ) ;
+		UART_Init ( ) ;
+		UART_RxStart ( ) ;
+		CONSOLE_Init ( Commands , 0 ) ;
+
+		/* Words split at the spaces, CR LF is one line, nothing is echoed */
+		Type ( "  set   0x20 \r\n" ) ;
+		SIM_Check ( SetCalls == 1 && SetValue == 0x20 && LastArgs == "set|0x20|" ) ;
+		SIM_Check ( Output ( ) == "" ) ;
+
+		/* A line typed in parts, the console does not wait for the rest */
+		Type ( "se" ) ;
+		SIM_Check ( SetCalls == 1 ) ;
+		Type ( "t 7\n" ) ;
+		SIM_Check ( SetCalls == 2 && SetValue == 7 ) ;
+
+		/* Backspace and DEL */
+		Type ( "sex\bt 12\x7f" "3\r" ) ;
+		SIM_Check ( SetCalls == 3 && SetValue == 13 ) ;
+
+		/* Unknown command, empty lines and too many words */
+		Type ( "reset\r\r\n   \r" ) ;
+		SIM_Check ( Output ( ) == "?" ) ;
+		Type ( "set 1 2 3 4 5 6\r" ) ;
+		SIM_Check ( SetCalls == 3 && Output ( ) == "?" ) ;
+		Type ( "set 1 2 3 4 5\r" ) ;
+		SIM_Check ( SetCalls == 4 && LastArgc == 6 ) ;
+
+		/* A line longer than the buffer is dropped, the next one is read */
+		Type ( "set " + std::string ( CONSOLE_LineSize , '1' ) + "\rping\r" ) ;
+		SIM_Check ( SetCalls == 4 && Output ( ) == "!P" ) ;
+
+		/* Echo: the chars, backspace as "\b \b" and the end of line as CR LF */
+		CONSOLE_Init ( Commands , 1 ) ;
+		Type ( "pinx\bg\r" ) ;
+		SIM_Check ( Output ( ) == "pinx\b \bg\r\nP" ) ;
+
+		/* A whole line arrives while the main loop is busy: the ring holds it */
+		SimUart_Inject ( "set 99\r" ) ;
+		Sim_AdvanceUs ( 100000 ) ;
+		SIM_Check ( UART_RxAvailable ( ) == 7 && SetCalls == 4 ) ;
+		CONSOLE_Poll ( ) ;
+		SIM_Check ( SetCalls == 5 && SetValue == 99 && UART_RxLost ( ) == 0 ) ;
+
+		SimUart_Print ( ) ;
+		return Sim_Summary ( "TestConsole" ) ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Tests\TestConsole.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
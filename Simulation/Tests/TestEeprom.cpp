@@ -0,0 +1,77 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Tests\TestEeprom.cpp
+//
+// summary:	EEPROM test on the simulated EEPROM
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * TestEeprom.cpp
+ *
+ *
+ * |_______EEPROM.c on the simulated EEPROM_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 16:02:18
+ *
+ * Filename: TestEeprom.cpp
+ * Host: Linux g++(the drivers are compiled as C++)
+ * Author: Mohammad Sadr
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "Sim.h"
+#include "EEPROM.h"
+
+int main ( )
+	{
+		unsigned char data [ 4 ] = { 0x11 , 0x22 , 0x33 , 0x44 } , read [ 4 ] ;
+		unsigned long long start ;
+		unsigned long polls ;
+		unsigned int calls = 0 ;
+		Coroutine co ;
+
+		Sim_Reset ( ) ;
+
+		EEPROM_WriteByte ( 0x10 , 0xa5 ) ;
+		SIM_Check ( SimEeprom_Writes ( ) == 1 ) ;
+		SIM_Check ( EEPROM_ReadByte ( 0x10 ) == 0xa5 ) ;		// Waits for the write
+		SIM_Check ( SimEeprom_Get ( 0x10 ) == 0xa5 ) ;
+		SIM_Check ( SimEeprom_Get ( 0x11 ) == 0xff ) ;
+
+		/* Blocking N bytes: each byte waits for the one before, 8.5ms each */
+		start = Sim_Now ( ) ;
+		polls = SimEeprom_BusyPolls ( ) ;
+		EEPROM_WriteNBytes ( 0x20 , data , 4 ) ;
+		SIM_Check ( Sim_Now ( ) - start >= Sim_UsToCycles ( 3 * 8500 ) ) ;
+		EEPROM_ReadNBytes ( 0x20 , read , 4 ) ;
+		SIM_Check ( memcmp ( data , read , 4 ) == 0 ) ;
+		printf ( "  EEPROM_WriteNBytes: %lu busy polls\n" , SimEeprom_BusyPolls ( ) - polls ) ;
+
+		/* Coroutine: yields instead of polling, the main loop runs meanwhile */
+		SCHED_Init ( ) ;
+		polls = SimEeprom_BusyPolls ( ) ;
+		CO_Init ( &co ) ;
+		while ( EEPROM_WriteNBytesCo ( &co , 0x30 , data , 4 ) == CO_Waiting )
+			{
+				calls++ ;
+				Sim_AdvanceUs ( 1000 ) ;
+			}
+		Sim_AdvanceUs ( 9000 ) ;
+		SIM_Check ( SimEeprom_Get ( 0x30 ) == 0x11 && SimEeprom_Get ( 0x33 ) == 0x44 ) ;
+		SIM_Check ( SimEeprom_BusyPolls ( ) - polls <= calls ) ;
+		printf ( "  EEPROM_WriteNBytesCo: %u calls, %lu busy polls\n" , calls , SimEeprom_BusyPolls ( ) - polls ) ;
+
+		SIM_Check ( SimEeprom_Writes ( ) == 9 ) ;
+		SIM_Check ( SimEeprom_Errors ( ) == 0 ) ;
+		SimEeprom_Print ( ) ;
+		return Sim_Summary ( "TestEeprom" ) ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Tests\TestEeprom.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,85 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Tests\TestEeprom24.cpp
+//
+// summary:	24Cxx EEPROM test on the simulated TWI
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * TestEeprom24.cpp
+ *
+ *
+ * |_______EEPROM_24Cxx.c on the simulated TWI_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 21:05:13
+ *
+ * Filename: TestEeprom24.cpp
+ * Host: Linux g++(the drivers are compiled as C++)
+ * Author: Mohammad Sadr
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "Sim.h"
+#include "I2C.h"
+#include "EEPROM_24Cxx.h"
+
+int main ( )
+	{
+		unsigned char data [ 100 ] , read [ 100 ] ;
+		unsigned long long start ;
+		unsigned long starts , cycles ;
+		unsigned char i ;
+
+		for ( i = 0 ; i < sizeof ( data ) ; i++ )
+			data [ i ] = i * 7 + 1 ;
+
+		Sim_Reset ( ) ;
+		Sim24Cxx_Attach ( AT24C_MemorySize , AT24C_PageSize ) ;
+		I2C_Init ( ) ;
+
+		/* 100 bytes from 0x0010: 16 + 32 + 32 + 20 bytes, one write cycle per page */
+		start = Sim_Now ( ) ;
+		SIM_Check ( AT24C_WriteNBytes ( 0x0010 , data , sizeof ( data ) ) ) ;
+		cycles = Sim_Now ( ) - start ;
+		Sim_AdvanceUs ( 1000 ) ;							// The last Stop is still on the bus
+		SIM_Check ( Sim24Cxx_WriteCycles ( ) == 4 ) ;
+		SIM_Check ( Sim24Cxx_BusyNacks ( ) > 0 ) ;			// The next page waited with ACK polling
+		SIM_Check ( Sim24Cxx_Get ( 0x000f ) == 0xff && Sim24Cxx_Get ( 0x0010 ) == data [ 0 ] ) ;
+		SIM_Check ( Sim24Cxx_Get ( 0x0073 ) == data [ 99 ] && Sim24Cxx_Get ( 0x0074 ) == 0xff ) ;
+
+		/* Far less than the 8.5ms per byte of the internal EEPROM */
+		SIM_Check ( cycles < sizeof ( data ) * Sim_UsToCycles ( 8500 ) / 4 ) ;
+		printf ( "  AT24C_WriteNBytes: %lu us per byte\n" , ( unsigned long ) ( cycles / sizeof ( data ) / ( F_CPU / 1000000UL ) ) ) ;
+
+		/* The whole block in one transfer: Start, repeated Start, one Stop. The last write cycle is polled first */
+		starts = SimTwi_Starts ( ) ;
+		SIM_Check ( AT24C_ReadNBytes ( 0x0010 , read , sizeof ( read ) ) ) ;
+		SIM_Check ( memcmp ( data , read , sizeof ( data ) ) == 0 ) ;
+		SIM_Check ( SimTwi_Starts ( ) - starts >= 2 ) ;
+		starts = SimTwi_Starts ( ) ;
+		SIM_Check ( AT24C_ReadNBytes ( 0x0010 , read , sizeof ( read ) ) && SimTwi_Starts ( ) - starts == 2 ) ;
+
+		/* Single bytes */
+		SIM_Check ( AT24C_WriteByte ( 0x0fff , 0x5a ) ) ;
+		SIM_Check ( AT24C_ReadByte ( 0x0fff ) == 0x5a ) ;
+		SIM_Check ( Sim24Cxx_WriteCycles ( ) == 5 ) ;
+
+		/* No EEPROM on the bus: the functions give up after AT24C_PollLimit addresses */
+		Sim_Reset ( ) ;
+		I2C_Init ( ) ;
+		SIM_Check ( AT24C_ReadByte ( 0x0000 ) == 0xff ) ;
+		SIM_Check ( ! AT24C_WriteNBytes ( 0x0000 , data , 4 ) ) ;
+		SIM_Check ( SimTwi_Starts ( ) == 2 * AT24C_PollLimit ) ;
+
+		SimTwi_Print ( ) ;
+		return Sim_Summary ( "TestEeprom24" ) ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Tests\TestEeprom24.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,106 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Tests\TestI2cSlave.cpp
+//
+// summary:	I2C slave test on the simulated TWI
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * TestI2cSlave.cpp
+ *
+ *
+ * |_______I2C_Slave.c addressed by an other master_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 21:48:37
+ *
+ * Filename: TestI2cSlave.cpp
+ * Host: Linux g++(the drivers are compiled as C++)
+ * Author: Mohammad Sadr
+ *
+ */
+
+#include <stdio.h>
+#include "Sim.h"
+#include "I2C_Slave.h"
+
+#define SlaveId					0x42
+
+static unsigned char Registers [ 8 ] ;		// 0-5 results, 6-7 settings
+
+int main ( )
+	{
+		static const unsigned char results [ 6 ] = { 0x01 , 0x02 , 0x03 , 0x04 , 0x05 , 0x06 } ;
+		unsigned char settings [ 2 ] , data ;
+		unsigned long interrupts ;
+		bool ok ;
+
+		Sim_Reset ( ) ;
+		I2C_SlaveInit ( SlaveId , Registers , 8 , 6 , 1 ) ;
+		SIM_Check ( TWAR.value == ( SlaveId | ( 1 << TWGCE ) ) ) ;
+
+		/* Write: register pointer, then the settings, seen at the Stop */
+		interrupts = Sim_Interrupts ( ) ;
+		ok = SimTwiMaster_Start ( SlaveId ) && SimTwiMaster_Write ( 6 ) ;
+		ok = ok && SimTwiMaster_Write ( 0x11 ) && SimTwiMaster_Write ( 0x22 ) ;
+		SIM_Check ( ok && ! I2C_SlaveChanged ( ) ) ;
+		SimTwiMaster_Stop ( ) ;
+		SIM_Check ( Sim_Interrupts ( ) - interrupts == 5 ) ;		// Address, 3 bytes and the Stop
+		SIM_Check ( I2C_SlaveChanged ( ) && ! I2C_SlaveChanged ( ) ) ;
+		I2C_SlaveRead ( 6 , settings , 2 ) ;
+		SIM_Check ( settings [ 0 ] == 0x11 && settings [ 1 ] == 0x22 ) ;
+
+		/* The results are read only: the data byte is not acknowledged */
+		ok = SimTwiMaster_Start ( SlaveId ) && SimTwiMaster_Write ( 0 ) ;
+		SIM_Check ( ok && ! SimTwiMaster_Write ( 0x55 ) ) ;
+		SimTwiMaster_Stop ( ) ;
+		SIM_Check ( Registers [ 0 ] == 0 && ! I2C_SlaveChanged ( ) ) ;
+		ok = SimTwiMaster_Start ( SlaveId ) && SimTwiMaster_Write ( 7 ) && SimTwiMaster_Write ( 0x33 ) ;
+		SIM_Check ( ok && ! SimTwiMaster_Write ( 0x44 ) ) ;		// Past the last register
+		SimTwiMaster_Stop ( ) ;
+		SIM_Check ( Registers [ 7 ] == 0x33 && I2C_SlaveChanged ( ) ) ;
+
+		/* Read with a repeated Start, like I2C_RegRead() of the master board */
+		SIM_Check ( I2C_SlaveUpdate ( 0 , results , 6 ) ) ;
+		ok = SimTwiMaster_Start ( SlaveId ) && SimTwiMaster_Write ( 2 ) && SimTwiMaster_Start ( SlaveId | 1 ) ;
+		SIM_Check ( ok ) ;
+		SIM_Check ( SimTwiMaster_Read ( true ) == 0x03 && SimTwiMaster_Read ( true ) == 0x04 ) ;
+		SIM_Check ( SimTwiMaster_Read ( false ) == 0x05 ) ;
+		SimTwiMaster_Stop ( ) ;
+		SIM_Check ( ! I2C_SlaveChanged ( ) ) ;
+
+		/* A read past the last register gives 0xFF */
+		ok = SimTwiMaster_Start ( SlaveId ) && SimTwiMaster_Write ( 7 ) && SimTwiMaster_Start ( SlaveId | 1 ) ;
+		SIM_Check ( ok && SimTwiMaster_Read ( true ) == 0x33 && SimTwiMaster_Read ( false ) == 0xff ) ;
+		SimTwiMaster_Stop ( ) ;
+
+		/* No update while the master reads, so a value is never torn */
+		ok = SimTwiMaster_Start ( SlaveId ) && SimTwiMaster_Write ( 0 ) && SimTwiMaster_Start ( SlaveId | 1 ) ;
+		SIM_Check ( ok && SimTwiMaster_Read ( true ) == 0x01 ) ;
+		SIM_Check ( ! I2C_SlaveUpdate ( 0 , settings , 2 ) ) ;
+		SIM_Check ( SimTwiMaster_Read ( false ) == 0x02 ) ;
+		SimTwiMaster_Stop ( ) ;
+		SIM_Check ( I2C_SlaveUpdate ( 0 , settings , 2 ) && Registers [ 1 ] == 0x22 ) ;
+
+		/* Other addresses are not answered */
+		SIM_Check ( ! SimTwiMaster_Start ( SlaveId + 2 ) ) ;
+		SimTwiMaster_Stop ( ) ;
+
+		/* General call */
+		ok = SimTwiMaster_Start ( 0x00 ) && SimTwiMaster_Write ( 0x06 ) ;
+		SimTwiMaster_Stop ( ) ;
+		SIM_Check ( ok && I2C_SlaveGeneralCall ( &data ) && data == 0x06 ) ;
+		SIM_Check ( ! I2C_SlaveGeneralCall ( &data ) && ! I2C_SlaveChanged ( ) ) ;
+		I2C_SlaveInit ( SlaveId , Registers , 8 , 6 , 0 ) ;
+		SIM_Check ( ! SimTwiMaster_Start ( 0x00 ) ) ;
+		SimTwiMaster_Stop ( ) ;
+
+		printf ( "  i2c slave: %lu cycles SCL held low by the interrupt\n" , SimTwiMaster_StretchCycles ( ) ) ;
+		return Sim_Summary ( "TestI2cSlave" ) ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Tests\TestI2cSlave.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,93 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Tests\TestKeypad.cpp
+//
+// summary:	Keypad test on the simulated key matrix
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * TestKeypad.cpp
+ *
+ *
+ * |_______Keypad.c on the simulated 4x4 key matrix_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 16:02:18
+ *
+ * Filename: TestKeypad.cpp
+ * Host: Linux g++(the drivers are compiled as C++)
+ * Author: Mohammad Sadr
+ *
+ */
+
+#include <stdio.h>
+#include <avr/sleep.h>
+#include "Sim.h"
+#include "Keypad.h"
+
+int main ( )
+	{
+		KeypadEvent event ;
+		unsigned long reads ;
+		unsigned long long press ;
+		unsigned int ms ;
+		char keys [ 17 ] ;
+
+		Sim_Reset ( ) ;
+		SimKeypad_Attach ( ) ;
+		KEYPAD_Init ( ) ;
+		PORTC = 0x0f ;						// COL pull-ups
+
+		/* Matrix scan: one PINC read per ROW, any number of keys */
+		SIM_Check ( KEYPAD_ScanMatrix ( ) == 0 ) ;
+		SimKeypad_Press ( 6 ) ;
+		SimKeypad_Press ( 9 ) ;
+		reads = SimKeypad_Scans ( ) ;
+		SIM_Check ( KEYPAD_ScanMatrix ( ) == ( ( 1 << 6 ) | ( 1 << 9 ) ) ) ;
+		SIM_Check ( SimKeypad_Scans ( ) - reads == 4 ) ;
+		SIM_Check ( KEYPAD_KeysToString ( ( 1 << 6 ) | ( 1 << 9 ) , keys ) == 2 ) ;
+		SIM_Check ( keys [ 0 ] == '5' && keys [ 1 ] == 'A' ) ;
+		SimKeypad_Release ( 6 ) ;
+		SimKeypad_Release ( 9 ) ;
+
+		/* Blocking read: the key is pressed 2ms later and held for 20ms */
+		SimKeypad_Schedule ( Sim_Now ( ) + 2000 , 6 , true ) ;
+		SimKeypad_Schedule ( Sim_Now ( ) + 22000 , 6 , false ) ;
+		SIM_Check ( KEYPAD_GetKey ( ) == '5' ) ;
+		Sim_AdvanceUs ( 30000 ) ;
+
+		/* Tick service: 1ms ticks, press and release events after the debounce */
+		for ( ms = 0 ; ms < 20 ; ms++ )
+			{
+				if ( ms == 2 )
+					SimKeypad_Press ( 15 ) ;
+				if ( ms == 12 )
+					SimKeypad_Release ( 15 ) ;
+				KEYPAD_Tick ( ) ;
+				Sim_AdvanceUs ( 1000 ) ;
+			}
+		SIM_Check ( KEYPAD_GetEvent ( &event ) && event.type == KEYPAD_EventPress && event.key == 'C' ) ;
+		SIM_Check ( KEYPAD_GetEvent ( &event ) && event.type == KEYPAD_EventRelease && event.key == 'C' ) ;
+		SIM_Check ( ! KEYPAD_GetEvent ( &event ) ) ;
+		SIM_Check ( KEYPAD_IsIdle ( ) ) ;
+
+		/* Power down till a key pulls INT0 low, PD2 is given back as it was(output, low) */
+		DDRD |= ( 1 << PD2 ) ;
+		PORTD &= ~ ( 1 << PD2 ) ;
+		press = Sim_Now ( ) + 50000 ;
+		SimKeypad_Schedule ( press , 3 , true ) ;
+		KEYPAD_Sleep ( SLEEP_MODE_PWR_DOWN ) ;
+		SIM_Check ( Sim_Now ( ) >= press && Sim_Now ( ) < press + 100 ) ;
+		SIM_Check ( Sim_Interrupts ( ) == 1 ) ;
+		SIM_Check ( ! ( GICR.value & ( 1 << INT0 ) ) ) ;
+		SIM_Check ( ( DDRD.value & ( 1 << PD2 ) ) && ! ( PORTD.value & ( 1 << PD2 ) ) ) ;
+
+		SimKeypad_Print ( ) ;
+		return Sim_Summary ( "TestKeypad" ) ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Tests\TestKeypad.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
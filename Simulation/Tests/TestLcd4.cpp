@@ -0,0 +1,128 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Tests\TestLcd4.cpp
+//
+// summary:	4-bit LCD test on the simulated HD44780
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * TestLcd4.cpp
+ *
+ *
+ * |_______LCD_4_bit.c, LCD_Glyph.c and LCD_Marquee.c on the simulated HD44780_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 16:02:18
+ *
+ * Filename: TestLcd4.cpp
+ * Host: Linux g++(the drivers are compiled as C++)
+ * Author: Mohammad Sadr
+ *
+ */
+
+#include <stdio.h>
+#include <avr/pgmspace.h>
+#include "Sim.h"
+#include "LCD_4_bit.h"
+#include "LCD_Glyph.h"
+#include "LCD_Marquee.h"
+
+static const char Banner [ ] PROGMEM = "Flash message" ;
+
+static unsigned long MarqueeBusiest ;		// Most LCD writes of one LCD_MarqueeTick()
+
+/* Calls LCD_MarqueeTick() till line 1 shows the text, returns the calls(0 if it never does) */
+static unsigned int MarqueeTicks ( const char *text )
+	{
+		unsigned int ticks ;
+		unsigned long writes ;
+
+		for ( ticks = 1 ; ticks <= 200 ; ticks++ )
+			{
+				writes = SimLcd_Commands ( ) + SimLcd_DataWrites ( ) ;
+				LCD_MarqueeTick ( ) ;
+				writes = SimLcd_Commands ( ) + SimLcd_DataWrites ( ) - writes ;
+				if ( writes > MarqueeBusiest )
+					MarqueeBusiest = writes ;
+				if ( SimLcd_Line ( 0 ) == text )
+					return ticks ;
+			}
+		return 0 ;
+	}
+
+int main ( )
+	{
+		char message [ ] = "AVR C Library on a 16x2 LCD" ;
+		unsigned long long start ;
+		unsigned long writes ;
+		unsigned char code ;
+		Coroutine co ;
+
+		Sim_Reset ( ) ;
+		SimLcd_Attach ( SimLcd4Bit ) ;
+
+		LCD_Init ( ) ;
+		SIM_Check ( SimLcd_DisplayOn ( ) && SimLcd_CursorOn ( ) ) ;
+		SIM_Check ( SimLcd_Commands ( ) == 5 ) ;
+		SIM_Check ( SimLcd_Address ( ) == 0x00 ) ;
+
+		LCD_DataWrite ( 'O' ) ;
+		LCD_DataWrite ( 'K' ) ;
+		SIM_Check ( SimLcd_Line ( 0 ) == "OK              " ) ;
+
+		/* Bar graph: 7 full chars, 1 partly filled glyph from CGRAM(3 columns) and blanks */
+		LCD_GlyphReset ( ) ;
+		LCD_BarGraph ( 1 , 0 , 16 , 38 ) ;
+		SIM_Check ( SimLcd_Line ( 1 ).substr ( 0 , 7 ) == std::string ( 7 , ( char ) 0xff ) ) ;
+		code = SimLcd_Line ( 1 ) [ 7 ] ;
+		SIM_Check ( code < 8 ) ;
+		SIM_Check ( SimLcd_Cgram ( code * 8 ) == 0x1c && SimLcd_Cgram ( code * 8 + 7 ) == 0x1c ) ;
+		SIM_Check ( SimLcd_Line ( 1 ).substr ( 8 ) == "        " ) ;
+
+		/* The same level again: the glyph is already in CGRAM, only DDRAM is written */
+		writes = SimLcd_DataWrites ( ) ;
+		LCD_BarGraph ( 1 , 0 , 16 , 38 ) ;
+		SIM_Check ( SimLcd_DataWrites ( ) - writes == 16 ) ;
+
+		/* Marquee: the first step draws the whole line(a cursor move and 16 chars) over 6 ticks, the cursor is turned off */
+		LCD_MarqueeStart ( 0 , message , 1 ) ;
+		SIM_Check ( ! SimLcd_CursorOn ( ) ) ;
+		SIM_Check ( MarqueeTicks ( "AVR C Library on" ) == 6 ) ;
+		SIM_Check ( MarqueeTicks ( "C Library on a 1" ) != 0 ) ;
+		LCD_MarqueeStop ( 0 ) ;
+		SIM_Check ( SimLcd_CursorOn ( ) ) ;
+
+		/* Marquee from flash: the blanks after the end, the last char scrolls out, then the first char again */
+		LCD_MarqueeStart_P ( 0 , Banner , 1 ) ;
+		SIM_Check ( MarqueeTicks ( "message         " ) != 0 ) ;
+		SIM_Check ( MarqueeTicks ( "e               " ) != 0 ) ;
+		SIM_Check ( MarqueeTicks ( "                " ) != 0 ) ;
+		SIM_Check ( MarqueeTicks ( "Flash message   " ) != 0 ) ;
+		LCD_MarqueeStop ( 0 ) ;
+		SIM_Check ( MarqueeBusiest == 4 ) ;		// Never more than 4 LCD writes(about 4ms) per tick
+
+		/* The drivers do not read the busy flag, their delays must be long enough */
+		SIM_Check ( SimLcd_BusyViolations ( ) == 0 ) ;
+		SimLcd_Print ( ) ;
+
+		/* Coroutine init: same commands, the 50ms power up wait runs with the scheduler */
+		Sim_Reset ( ) ;
+		SimLcd_Attach ( SimLcd4Bit ) ;
+		SCHED_Init ( ) ;
+		start = Sim_Now ( ) ;
+		CO_Init ( &co ) ;
+		while ( LCD_InitCo ( &co ) == CO_Waiting )
+			Sim_AdvanceUs ( 100 ) ;
+		SIM_Check ( SimLcd_Commands ( ) == 5 ) ;
+		SIM_Check ( SimLcd_DisplayOn ( ) ) ;
+		SIM_Check ( SimLcd_BusyViolations ( ) == 0 ) ;
+		printf ( "  LCD_InitCo: %llu us\n" , ( Sim_Now ( ) - start ) / ( F_CPU / 1000000UL ) ) ;
+
+		return Sim_Summary ( "TestLcd4" ) ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Tests\TestLcd4.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,79 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Tests\TestLcd8.cpp
+//
+// summary:	8-bit LCD test on the simulated HD44780
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * TestLcd8.cpp
+ *
+ *
+ * |_______LCD_8_bit.c on the simulated HD44780_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 16:02:18
+ *
+ * Filename: TestLcd8.cpp
+ * Host: Linux g++(the drivers are compiled as C++)
+ * Author: Mohammad Sadr
+ *
+ */
+
+#include <stdio.h>
+#include <avr/pgmspace.h>
+#include "Sim.h"
+#include "LCD_8_bit.h"
+
+static const char Greeting [ ] PROGMEM = "Flash" ;
+static const char Message [ ] PROGMEM = "Scrolled from flash" ;
+
+int main ( )
+	{
+		char text [ ] = "Hello" , message [ ] = "Scrolled from flash" ;
+		std::string last ;
+		unsigned long writes ;
+
+		Sim_Reset ( ) ;
+		SimLcd_Attach ( SimLcd8Bit ) ;
+
+		LCD_Init ( ) ;
+		SIM_Check ( SimLcd_DisplayOn ( ) && SimLcd_CursorOn ( ) ) ;
+
+		LCD_DisplayString ( text ) ;
+		LCD_GoToLineTwo ( ) ;
+		LCD_DisplayNumber ( 42 ) ;
+		SIM_Check ( SimLcd_Line ( 0 ) == "Hello           " ) ;
+		SIM_Check ( SimLcd_Line ( 1 ) == "00042           " ) ;
+
+		LCD_GoToXY ( 1 , 8 ) ;
+		LCD_DisplayRtcTime ( 0x12 , 0x34 , 0x56 ) ;
+		SIM_Check ( SimLcd_Line ( 1 ) == "00042   12:34:56" ) ;
+
+		/* Clear, then write after the 1.52ms of the clear command */
+		writes = SimLcd_DataWrites ( ) ;
+		LCD_Clear ( ) ;
+		LCD_DataWrite ( '*' ) ;
+		SIM_Check ( SimLcd_Line ( 0 ) == "*               " ) ;
+		SIM_Check ( SimLcd_Line ( 1 ) == "                " ) ;
+		SIM_Check ( SimLcd_DataWrites ( ) - writes == 1 ) ;
+
+		/* Strings from flash give the same chars as the ones in SRAM */
+		LCD_DisplayString_P ( Greeting ) ;
+		SIM_Check ( SimLcd_Line ( 0 ) == "*Flash          " ) ;
+		LCD_ScrollMessage ( message ) ;
+		last = SimLcd_Line ( 0 ) ;
+		LCD_ScrollMessage_P ( Message ) ;
+		SIM_Check ( last == "h               " && SimLcd_Line ( 0 ) == last ) ;
+		SIM_Check ( SimLcd_CursorOn ( ) ) ;
+
+		SIM_Check ( SimLcd_BusyViolations ( ) == 0 ) ;
+		SimLcd_Print ( ) ;
+		return Sim_Summary ( "TestLcd8" ) ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Tests\TestLcd8.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,144 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Tests\TestLcdI2c.cpp
+//
+// summary:	LCD I2C test on the simulated TWI and HD44780
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * TestLcdI2c.cpp
+ *
+ *
+ * |_______LCD_I2C.c through the simulated PCF8574_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 22:17:05
+ *
+ * Filename: TestLcdI2c.cpp
+ * Host: Linux g++(the drivers are compiled as C++)
+ * Author: Mohammad Sadr
+ *
+ */
+
+#include <stdio.h>
+#include <string>
+#include "Sim.h"
+#include "Scheduler.h"
+#include "I2C.h"
+#include "LCD_I2C.h"
+
+/* One I2C write for each pin change, the port sequence of LCD_4_bit.c on the expander */
+static void NaivePort ( unsigned char value )
+	{
+		I2C_Start ( ) ;
+		I2C_Write ( LCD_I2CId ) ;
+		I2C_Write ( value ) ;
+		I2C_Stop ( ) ;
+	}
+
+static void NaiveDataWrite ( char dat )
+	{
+		unsigned char nibble , port , i ;
+
+		for ( i = 0 ; i < 2 ; i++ )
+			{
+				nibble = i ? ( dat << 4 ) : ( dat & 0xf0 ) ;
+				port = nibble | ( 1 << LCD_I2CBacklight ) ;
+				NaivePort ( port ) ;							// Data bus
+				NaivePort ( port |= ( 1 << LCD_I2CRs ) ) ;		// RS high
+				NaivePort ( port &= ~ ( 1 << LCD_I2CRw ) ) ;	// RW low
+				NaivePort ( port | ( 1 << LCD_I2CEn ) ) ;		// EN pulse
+				NaivePort ( port ) ;
+			}
+	}
+
+int main ( )
+	{
+		const std::string screen = "Full screen over" "two wires, burst" ;
+		unsigned long long start , naive , single , burst ;
+		unsigned long bytes , starts ;
+		unsigned char i ;
+		Coroutine co ;
+
+		Sim_Reset ( ) ;
+		SimLcd_Attach ( SimLcdI2c ) ;
+
+		/* 0x3 three times and 0x2 make two commands of the 4-bit model */
+		LCD_Init ( ) ;
+		SIM_Check ( SimLcd_DisplayOn ( ) && SimLcd_CursorOn ( ) ) ;
+		SIM_Check ( SimLcd_Commands ( ) == 6 && SimLcd_Address ( ) == 0x00 ) ;
+		SIM_Check ( TWBR.value == ( F_CPU / LCD_I2CScl - 16 ) / 2 ) ;	// 100kHz
+
+		/* A char is one write: address and 4 bytes */
+		bytes = SimTwi_Bytes ( ) ;
+		LCD_DataWrite ( 'O' ) ;
+		LCD_DataWrite ( 'K' ) ;
+		SIM_Check ( SimLcd_Line ( 0 ) == "OK              " ) ;
+		SIM_Check ( SimTwi_Bytes ( ) - bytes == 2 * 5 ) ;
+		SIM_Check ( SimLcd_Expander ( ) & ( 1 << LCD_I2CBacklight ) ) ;
+
+		/* Full screen: pin by pin, one write per char and one write per line */
+		LCD_CmdWrite ( 0x80 ) ;
+		start = Sim_Now ( ) ;
+		for ( i = 0 ; i < 16 ; i++ )
+			NaiveDataWrite ( screen [ i ] ) ;
+		LCD_CmdWrite ( 0xc0 ) ;
+		for ( i = 16 ; i < 32 ; i++ )
+			NaiveDataWrite ( screen [ i ] ) ;
+		naive = Sim_Now ( ) - start ;
+		SIM_Check ( SimLcd_Line ( 0 ) + SimLcd_Line ( 1 ) == screen ) ;
+
+		LCD_CmdWrite ( 0x01 ) ;
+		start = Sim_Now ( ) ;
+		for ( i = 0 ; i < 32 ; i++ )
+			{
+				if ( i == 16 )
+					LCD_CmdWrite ( 0xc0 ) ;
+				LCD_DataWrite ( screen [ i ] ) ;
+			}
+		single = Sim_Now ( ) - start ;
+		SIM_Check ( SimLcd_Line ( 0 ) + SimLcd_Line ( 1 ) == screen ) ;
+
+		LCD_CmdWrite ( 0x01 ) ;
+		bytes = SimTwi_Bytes ( ) ;
+		starts = SimTwi_Starts ( ) ;
+		start = Sim_Now ( ) ;
+		LCD_DataBurst ( screen.c_str ( ) , 16 ) ;
+		LCD_CmdWrite ( 0xc0 ) ;
+		LCD_DataBurst ( screen.c_str ( ) + 16 , 16 ) ;
+		burst = Sim_Now ( ) - start ;
+		SIM_Check ( SimLcd_Line ( 0 ) + SimLcd_Line ( 1 ) == screen ) ;
+		SIM_Check ( SimTwi_Starts ( ) - starts == 3 && SimTwi_Bytes ( ) - bytes == 3 + 32 * 4 + 4 ) ;
+		SIM_Check ( burst * 4 < naive && single < naive ) ;
+		printf ( "  full screen: pin by pin %llu us, LCD_DataWrite %llu us, LCD_DataBurst %llu us\n" ,
+			naive * 1000000 / F_CPU , single * 1000000 / F_CPU , burst * 1000000 / F_CPU ) ;
+
+		/* The HD44780 executed each char before the next one */
+		SIM_Check ( SimLcd_BusyViolations ( ) == 0 ) ;
+
+		LCD_Backlight ( 0 ) ;
+		SIM_Check ( ! ( SimLcd_Expander ( ) & ( 1 << LCD_I2CBacklight ) ) ) ;
+		LCD_DataWrite ( '!' ) ;
+		SIM_Check ( ! ( SimLcd_Expander ( ) & ( 1 << LCD_I2CBacklight ) ) ) ;
+		LCD_Backlight ( 1 ) ;
+
+		/* Coroutine initialization, the scheduler tick runs meanwhile */
+		Sim_Reset ( ) ;
+		SimLcd_Attach ( SimLcdI2c ) ;
+		SCHED_Init ( ) ;
+		CO_Init ( &co ) ;
+		while ( LCD_InitCo ( &co ) == CO_Waiting )
+			Sim_AdvanceUs ( 100 ) ;
+		SIM_Check ( SimLcd_Commands ( ) == 6 && SimLcd_DisplayOn ( ) ) ;
+		SIM_Check ( SimLcd_BusyViolations ( ) == 0 ) ;
+
+		SimLcd_Print ( ) ;
+		SimTwi_Print ( ) ;
+		return Sim_Summary ( "TestLcdI2c" ) ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Tests\TestLcdI2c.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,103 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Tests\TestProfile.cpp
+//
+// summary:	Profile test on the simulated Timer1 and UART
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * TestProfile.cpp
+ *
+ *
+ * |_______Profile.c with the instrumented drivers_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 17:52:06
+ *
+ * Filename: TestProfile.cpp
+ * Host: Linux g++(the drivers are compiled as C++)
+ * Author: Mohammad Sadr
+ *
+ */
+
+#include <stdio.h>
+#include <string>
+#include "Sim.h"
+#include "Profile.h"
+#include "UART.h"
+#include "ADC.h"
+#include "EEPROM.h"
+#include "LCD_4_bit.h"
+
+/* Little endian field of the dump */
+static unsigned long Field ( const std::string &frame , unsigned int offset , unsigned char bytes )
+	{
+		unsigned long value = 0 ;
+
+		while ( bytes-- )
+			value = ( value << 8 ) | ( unsigned char ) frame [ offset + bytes ] ;
+		return value ;
+	}
+
+int main ( )
+	{
+		ProfileStats stats ;
+		std::string frame ;
+		unsigned char sum = 0 ;
+		unsigned int i ;
+
+		Sim_Reset ( ) ;
+		SimLcd_Attach ( SimLcd4Bit ) ;
+		UART_Init ( ) ;
+		ADC_Init ( ) ;
+		PROFILE_Init ( ) ;
+
+		UART_TxChar ( 'a' ) ;
+		UART_TxChar ( 'b' ) ;
+		UART_TxChar ( 'c' ) ;					// UDR and the shift register are full, waits for the frame of 'a'
+		ADC_StartConversion ( 1 ) ;
+		EEPROM_WriteByte ( 0 , 1 ) ;
+		EEPROM_WriteByte ( 1 , 2 ) ;			// Waits 8.5ms for the first write
+		LCD_Init ( ) ;
+		LCD_DataWrite ( 'x' ) ;
+
+		PROFILE_GetStats ( PROFILE_UartTx , &stats ) ;
+		SIM_Check ( stats.calls == 3 ) ;
+		SIM_Check ( stats.max >= SimUart_FrameCycles ( ) - 100 && stats.min < 100 ) ;
+		PROFILE_GetStats ( PROFILE_Adc , &stats ) ;
+		SIM_Check ( stats.calls == 1 && stats.max >= Sim_UsToCycles ( 5000 ) ) ;
+		PROFILE_GetStats ( PROFILE_EepromWrite , &stats ) ;
+		SIM_Check ( stats.calls == 2 && stats.max >= Sim_UsToCycles ( 8000 ) ) ;
+		SIM_Check ( stats.total == stats.min + stats.max ) ;
+		PROFILE_GetStats ( PROFILE_LcdWrite , &stats ) ;
+		SIM_Check ( stats.calls == 6 ) ;			// 5 init commands and the data write
+		PROFILE_GetStats ( PROFILE_I2C , &stats ) ;
+		SIM_Check ( stats.calls == 0 && stats.min == 0xffffffff ) ;
+
+		/* Binary dump: the UART calls of the dump are not counted */
+		PROFILE_Dump ( ) ;
+		Sim_AdvanceTo ( Sim_Now ( ) + 2 * SimUart_FrameCycles ( ) ) ;		// Last frame out
+		frame = SimUart_Output ( ).substr ( 3 ) ;
+		SIM_Check ( frame.size ( ) == 3 + 14 * PROFILE_Sites ) ;
+		SIM_Check ( frame [ 0 ] == 'P' && frame [ 1 ] == PROFILE_Sites ) ;
+		for ( i = 1 ; i < frame.size ( ) ; i++ )
+			sum += ( unsigned char ) frame [ i ] ;
+		SIM_Check ( sum == 0 ) ;
+		SIM_Check ( Field ( frame , 2 + 14 * PROFILE_UartTx , 2 ) == 3 ) ;
+		SIM_Check ( Field ( frame , 2 + 14 * PROFILE_EepromWrite , 2 ) == 2 ) ;
+		SIM_Check ( Field ( frame , 2 + 14 * PROFILE_Adc + 6 , 4 ) >= Sim_UsToCycles ( 5000 ) ) ;
+		PROFILE_GetStats ( PROFILE_UartTx , &stats ) ;
+		SIM_Check ( stats.calls == 3 ) ;
+
+		PROFILE_Reset ( ) ;
+		PROFILE_GetStats ( PROFILE_LcdWrite , &stats ) ;
+		SIM_Check ( stats.calls == 0 && stats.total == 0 ) ;
+
+		return Sim_Summary ( "TestProfile" ) ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Tests\TestProfile.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,199 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Tests\TestQueue.cpp
+//
+// summary:	Queue.h stress test with a simulated ISR on both ends
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * TestQueue.cpp
+ *
+ *
+ * |_______Queue.h between the Timer2 interrupt and the main loop_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-20 00:12:51
+ *
+ * Filename: TestQueue.cpp
+ * Host: Linux g++(the drivers are compiled as C++)
+ * Author: Mohammad Sadr
+ *
+ * Note:
+ *
+ *		QUEUE_Barrier() lets the simulated time run one cycle, so the Timer2 interrupt can come in
+ *		between writing an item and moving the index over it, the window a wrong ring gets caught in.
+ *		The interrupt period and the work of the main loop are varied pseudo randomly.
+ *
+ */
+
+#include <stdio.h>
+#include <avr/interrupt.h>
+#include "Sim.h"
+
+#define QUEUE_Barrier( )		Sim_Advance ( 1 )
+#include "Queue.h"
+
+#define Samples					20000		// Items through the ISR to main queue
+
+typedef struct
+	{
+		unsigned int sequence ;
+		unsigned int check ;		// ~sequence, a half written item does not match
+	} Sample ;
+
+QUEUE_Define ( SampleQueue , Sample , 16 ) ;	// ISR -> main(like a receive ring)
+QUEUE_Define ( ByteQueue , unsigned char , 8 ) ;	// main -> ISR(like a transmit ring)
+
+static SampleQueue RxQueue ;
+static ByteQueue TxQueue ;
+
+static unsigned long Random = 1 ;
+static unsigned int IsrSequence ;			// Next sample pushed by the ISR
+static unsigned long IsrFull ;				// Samples not pushed, the queue was full
+static unsigned char IsrExpected ;			// Next byte the ISR must pop
+static unsigned long IsrPopped ;
+static unsigned long IsrEmpty ;
+static unsigned long IsrErrors ;
+static bool InMain ;						// The main loop is in a queue function
+static unsigned long Preempted ;			// Interrupts which came in a queue function of the main loop
+
+static unsigned int Next ( unsigned int range )
+	{
+		Random = Random * 1103515245UL + 12345UL ;
+		return ( unsigned int ) ( ( Random >> 16 ) % range ) ;
+	}
+
+ISR ( TIMER2_COMP_vect )
+	{
+		Sample samples [ 4 ] ;
+		unsigned char byte , count , i ;
+
+		if ( InMain )
+			Preempted++ ;
+		OCR2 = 24 + Next ( 40 ) ;
+
+		/* Producer of RxQueue: one sample or a few at once */
+		if ( IsrSequence < Samples )
+			{
+				count = 1 + Next ( 4 ) ;
+				if ( count > Samples - IsrSequence )
+					count = Samples - IsrSequence ;
+				for ( i = 0 ; i < count ; i++ )
+					{
+						samples [ i ].sequence = IsrSequence + i ;
+						samples [ i ].check = ~ ( IsrSequence + i ) ;
+					}
+				if ( count == 1 )
+					count = SampleQueue_Push ( &RxQueue , samples [ 0 ] ) ;
+				else
+					count = SampleQueue_PushN ( &RxQueue , samples , count ) ;
+				if ( count == 0 )
+					IsrFull++ ;
+				IsrSequence += count ;
+			}
+
+		/* Consumer of TxQueue: one byte per interrupt like UDRE */
+		if ( ByteQueue_Pop ( &TxQueue , &byte ) )
+			{
+				if ( byte != IsrExpected )
+					IsrErrors++ ;
+				IsrExpected = byte + 1 ;
+				IsrPopped++ ;
+			}
+		else
+			IsrEmpty++ ;
+	}
+
+int main ( )
+	{
+		Sample sample , samples [ 6 ] ;
+		unsigned char bytes [ 5 ] , count , i , tx_next = 0 ;
+		unsigned int expected = 0 ;
+		unsigned long errors = 0 , tx_pushed = 0 , tx_full = 0 , loops ;
+
+		Sim_Reset ( ) ;
+
+		/* All the places are used, the indexes run over 255 */
+		SampleQueue_Init ( &RxQueue ) ;
+		for ( i = 0 ; i < 16 ; i++ )
+			{
+				sample.sequence = i ;
+				sample.check = ~ i ;
+				SampleQueue_Push ( &RxQueue , sample ) ;
+			}
+		SIM_Check ( SampleQueue_Count ( &RxQueue ) == 16 && SampleQueue_Free ( &RxQueue ) == 0 ) ;
+		SIM_Check ( ! SampleQueue_Push ( &RxQueue , sample ) ) ;
+		SIM_Check ( SampleQueue_PopN ( &RxQueue , samples , 6 ) == 6 && samples [ 5 ].sequence == 5 ) ;
+		SIM_Check ( SampleQueue_PushN ( &RxQueue , samples , 6 ) == 6 && SampleQueue_PushN ( &RxQueue , samples , 1 ) == 0 ) ;
+		SampleQueue_Init ( &RxQueue ) ;
+		for ( i = 0 ; i < 200 ; i++ )
+			{
+				bytes [ 0 ] = i ;
+				ByteQueue_PushN ( &TxQueue , bytes , 3 ) ;
+				count = ByteQueue_PopN ( &TxQueue , bytes , 5 ) ;
+				errors += ( count != 3 || bytes [ 0 ] != i ) ;
+			}
+		SIM_Check ( errors == 0 && TxQueue.head == ( unsigned char ) ( 3 * 200 ) && ByteQueue_Count ( &TxQueue ) == 0 ) ;
+		ByteQueue_Init ( &TxQueue ) ;
+
+		/* Stress: Timer2 CTC at F_CPU/1, the ISR pushes samples and pops bytes while the main loop does the reverse */
+		OCR2 = 40 ;
+		TCCR2 = ( 1 << WGM21 ) | ( 1 << CS20 ) ;
+		TIMSK |= ( 1 << OCIE2 ) ;
+		sei ( ) ;
+		for ( loops = 0 ; expected < Samples ; loops++ )
+			{
+				/* Samples taken and bytes sent in bursts, between them the queues run full or empty */
+				count = 0 ;
+				if ( ( loops >> 7 ) & 1 )
+					{
+						InMain = true ;
+						if ( Next ( 2 ) )
+							count = SampleQueue_Pop ( &RxQueue , &samples [ 0 ] ) ;
+						else
+							count = SampleQueue_PopN ( &RxQueue , samples , 1 + Next ( 6 ) ) ;
+						InMain = false ;
+					}
+				for ( i = 0 ; i < count ; i++ )
+					{
+						if ( samples [ i ].sequence != expected || samples [ i ].check != ( unsigned int ) ~ expected )
+							errors++ ;
+						expected = samples [ i ].sequence + 1 ;
+					}
+
+				if ( ( loops >> 6 ) & 1 )
+					{
+						for ( i = 0 ; i < 5 ; i++ )
+							bytes [ i ] = tx_next + i ;
+						InMain = true ;
+						if ( Next ( 2 ) )
+							count = ByteQueue_Push ( &TxQueue , bytes [ 0 ] ) ;
+						else
+							count = ByteQueue_PushN ( &TxQueue , bytes , 1 + Next ( 5 ) ) ;
+						InMain = false ;
+						tx_next += count ;
+						tx_pushed += count ;
+						if ( count == 0 )
+							tx_full++ ;
+					}
+
+				Sim_Advance ( Next ( 20 ) ) ;
+			}
+		TIMSK &= ~ ( 1 << OCIE2 ) ;
+
+		SIM_Check ( errors == 0 && IsrErrors == 0 ) ;
+		SIM_Check ( expected == Samples && SampleQueue_Count ( &RxQueue ) == 0 ) ;
+		SIM_Check ( IsrPopped + ByteQueue_Count ( &TxQueue ) == tx_pushed ) ;
+		SIM_Check ( IsrFull > 0 && tx_full > 0 && IsrEmpty > 0 ) ;		// Both queues ran full and empty
+		SIM_Check ( Preempted > 500 ) ;								// No interrupt masking in the queue functions
+		printf ( "  queue: %u samples, %lu bytes, %lu interrupts(%lu in a queue function), full %lu/%lu, empty %lu\n" ,
+			expected , tx_pushed , Sim_Interrupts ( ) , Preempted , IsrFull , tx_full , IsrEmpty ) ;
+
+		return Sim_Summary ( "TestQueue" ) ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Tests\TestQueue.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
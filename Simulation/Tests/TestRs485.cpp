@@ -0,0 +1,134 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Tests\TestRs485.cpp
+//
+// summary:	RS-485 multi-drop test on the simulated USART
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * TestRs485.cpp
+ *
+ *
+ * |_______UART.c in multi-processor communication mode_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 22:46:51
+ *
+ * Filename: TestRs485.cpp
+ * Host: Linux g++(the drivers are compiled as C++)
+ * Author: Mohammad Sadr
+ *
+ */
+
+#include <stdio.h>
+#include <string>
+#include "Sim.h"
+#include "UART.h"
+#include "LCD_4_bit.h"
+
+#define Node					0x12
+
+/* A message of an other node on the bus: address frame, then the data frames */
+static void Bus ( unsigned char address , const std::string &data )
+	{
+		unsigned int i ;
+
+		SimUart_InjectFrame ( 0x100 | address ) ;
+		for ( i = 0 ; i < data.size ( ) ; i++ )
+			SimUart_InjectFrame ( ( unsigned char ) data [ i ] ) ;
+	}
+
+static std::string Received ( )
+	{
+		std::string text ;
+		char ch ;
+
+		while ( UART_RxGet ( &ch ) )
+			text += ch ;
+		return text ;
+	}
+
+int main ( )
+	{
+		static const unsigned char reply [ 3 ] = { 'A' , 'C' , 'K' } ;
+		unsigned long long start ;
+		unsigned long frame , interrupts , pulses , writes , errors ;
+		unsigned char de ;
+
+		Sim_Reset ( ) ;
+		de = SimVcd_Watch ( "de" , UART_DePort , UART_DePin ) ;
+		UART_Init ( ) ;
+		UART_Rs485Start ( Node ) ;
+		frame = SimUart_FrameCycles ( ) ;
+		SIM_Check ( frame == 11UL * 16 * ( UART_Ubrr ( 9600 ) + 1 ) ) ;		// Start, 8 data bits, ninth bit, stop
+		SIM_Check ( ( DDRB.value & ( 1 << UART_DePin ) ) && ! ( PORTB.value & ( 1 << UART_DePin ) ) ) ;
+
+		/* 4 messages on the bus, one for this node: one interrupt per address frame and per own data byte */
+		interrupts = Sim_Interrupts ( ) ;
+		Bus ( 0x20 , "abcd" ) ;
+		Bus ( 0x13 , "efgh" ) ;
+		Bus ( Node , "OK!\n" ) ;
+		Bus ( 0x21 , "ijkl" ) ;
+		Sim_AdvanceTo ( Sim_Now ( ) + 21 * frame ) ;
+		SIM_Check ( Received ( ) == "OK!\n" ) ;
+		SIM_Check ( Sim_Interrupts ( ) - interrupts == 4 + 4 ) ;
+		SIM_Check ( SimUart_MpcmDropped ( ) == 12 && UART_RxLost ( ) == 0 ) ;
+		printf ( "  rs485: %lu interrupts for 20 frames on the bus\n" , Sim_Interrupts ( ) - interrupts ) ;
+
+		/* Broadcast */
+		Bus ( UART_Rs485Broadcast , "all" ) ;
+		Sim_AdvanceTo ( Sim_Now ( ) + 5 * frame ) ;
+		SIM_Check ( Received ( ) == "all" ) ;
+
+		/* Send: DE high from the address frame till the stop bit of the last frame */
+		start = Sim_Now ( ) ;
+		UART_Rs485Send ( 0x01 , reply , 3 ) ;
+		SIM_Check ( UART_Rs485Busy ( ) && ( PORTB.value & ( 1 << UART_DePin ) ) ) ;
+		Sim_AdvanceTo ( start + 5 * frame ) ;
+		SIM_Check ( ! UART_Rs485Busy ( ) && ! ( PORTB.value & ( 1 << UART_DePin ) ) ) ;
+		SIM_Check ( SimUart_Output ( ) == "\x01" "ACK" && SimUart_TxAddressFrames ( ) == 1 ) ;
+		SIM_Check ( SimVcd_Pulses ( de ) == 1 ) ;
+		SIM_Check ( SimVcd_MaxHigh ( de ) >= 4 * frame && SimVcd_MaxHigh ( de ) < 4 * frame + 100 ) ;
+		printf ( "  rs485: DE high %llu cycles for 4 frames of %lu\n" , SimVcd_MaxHigh ( de ) , frame ) ;
+
+		/* A second message waits for the first one to leave the bus */
+		UART_Rs485Send ( 0x01 , reply , 1 ) ;
+		UART_Rs485Send ( 0x02 , reply , 1 ) ;
+		Sim_AdvanceTo ( Sim_Now ( ) + 3 * frame ) ;
+		SIM_Check ( SimVcd_Pulses ( de ) == 3 && SimUart_TxAddressFrames ( ) == 3 ) ;
+
+		/* LCD_4_bit.c writes PORTB while the frames go out, DE(PB3) stays high till TXC */
+		SimLcd_Attach ( SimLcd4Bit ) ;
+		LCD_Init ( ) ;
+		pulses = SimVcd_Pulses ( de ) ;
+		writes = 0 ;
+		errors = 0 ;
+		UART_Rs485Send ( 0x01 , reply , 3 ) ;
+		while ( UART_Rs485Busy ( ) )
+			{
+				LCD_DataWrite ( 'x' ) ;
+				writes++ ;
+				if ( UART_Rs485Busy ( ) && ! ( PORTB.value & ( 1 << UART_DePin ) ) )
+					errors++ ;
+			}
+		SIM_Check ( writes >= 2 && errors == 0 ) ;
+		SIM_Check ( SimVcd_Pulses ( de ) == pulses + 1 && ! ( PORTB.value & ( 1 << UART_DePin ) ) ) ;
+		SIM_Check ( SimLcd_Line ( 0 ).substr ( 0 , writes ) == std::string ( writes , 'x' ) ) ;
+		printf ( "  rs485: %lu LCD writes while DE was high\n" , writes ) ;
+
+		/* UART_Init() goes back to 8-bit frames without MPCM */
+		UART_Init ( ) ;
+		UART_RxStart ( ) ;
+		SimUart_Inject ( "8N1" ) ;
+		Sim_AdvanceTo ( Sim_Now ( ) + 4 * SimUart_FrameCycles ( ) ) ;
+		SIM_Check ( Received ( ) == "8N1" ) ;
+
+		SimUart_Print ( ) ;
+		return Sim_Summary ( "TestRs485" ) ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Tests\TestRs485.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
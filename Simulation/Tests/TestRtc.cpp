@@ -0,0 +1,138 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Tests\TestRtc.cpp
+//
+// summary:	DS1307 test on the simulated TWI
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * TestRtc.cpp
+ *
+ *
+ * |_______I2C.c and RTC_DS1307.c on the simulated TWI and DS1307_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 16:02:18
+ *
+ * Filename: TestRtc.cpp
+ * Host: Linux g++(the drivers are compiled as C++)
+ * Author: Mohammad Sadr
+ *
+ */
+
+#include <stdio.h>
+#include "Sim.h"
+#include "Scheduler.h"
+#include "RTC_DS1307.h"
+#include "I2C.h"
+
+int main ( )
+	{
+		unsigned char hour , min , sec , day , month , year ;
+		unsigned long bytes , polls ;
+		unsigned int calls = 0 ;
+		Coroutine co ;
+		I2CRegCache cache ;
+
+		Sim_Reset ( ) ;
+		SimDs1307_SetRegister ( 7 , 0x13 ) ;		// SQW on, cleared by DS1307_Init()
+		DS1307_Init ( ) ;
+		SIM_Check ( SimDs1307_GetRegister ( 7 ) == 0x00 ) ;
+		SIM_Check ( SimTwi_Starts ( ) == 1 && SimTwi_Bytes ( ) == 3 ) ;
+		SIM_Check ( SimTwi_Stops ( ) == 0 ) ;			// I2C_Stop() returns before the Stop is on the bus
+		Sim_AdvanceUs ( 200 ) ;
+		SIM_Check ( SimTwi_Stops ( ) == 1 ) ;
+
+		DS1307_SetTime ( 0x23 , 0x59 , 0x58 ) ;
+		DS1307_SetDate ( 0x28 , 0x02 , 0x24 ) ;
+		SIM_Check ( SimDs1307_GetRegister ( 0 ) == 0x58 ) ;
+		SIM_Check ( SimDs1307_GetRegister ( 2 ) == 0x23 ) ;
+		SIM_Check ( SimDs1307_GetRegister ( 4 ) == 0x28 ) ;
+		SIM_Check ( SimDs1307_GetRegister ( 6 ) == 0x24 ) ;
+
+		/* Read back: SLA+W, pointer, SLA+R and 3 data bytes */
+		bytes = SimTwi_Bytes ( ) ;
+		polls = TWCR.reads ;
+		DS1307_GetTime ( &hour , &min , &sec ) ;
+		SIM_Check ( hour == 0x23 && min == 0x59 && sec == 0x58 ) ;
+		SIM_Check ( SimTwi_Bytes ( ) - bytes == 6 ) ;
+		printf ( "  DS1307_GetTime: %lu TWCR polls\n" , TWCR.reads - polls ) ;
+
+		/* The clock runs from the simulated time: 2 seconds later it is 29th of February 2024 */
+		Sim_AdvanceTo ( Sim_Now ( ) + 2 * F_CPU ) ;
+		DS1307_GetTime ( &hour , &min , &sec ) ;
+		DS1307_GetDate ( &day , &month , &year ) ;
+		SIM_Check ( hour == 0x00 && min == 0x00 && sec <= 0x01 ) ;
+		SIM_Check ( day == 0x29 && month == 0x02 && year == 0x24 ) ;
+
+		/* Coroutine version, the scheduler tick runs meanwhile */
+		SCHED_Init ( ) ;
+		SimDs1307_SetRegister ( 0 , 0x30 ) ;
+		SimDs1307_SetRegister ( 1 , 0x15 ) ;
+		SimDs1307_SetRegister ( 2 , 0x12 ) ;
+		bytes = SimTwi_Bytes ( ) ;
+		polls = TWCR.reads ;
+		CO_Init ( &co ) ;
+		while ( DS1307_GetTimeCo ( &co , &hour , &min , &sec ) == CO_Waiting )
+			{
+				calls++ ;
+				Sim_AdvanceUs ( 50 ) ;			// Other work of the main loop
+			}
+		SIM_Check ( hour == 0x12 && min == 0x15 && sec == 0x30 ) ;
+		SIM_Check ( SimTwi_Bytes ( ) - bytes == 6 ) ;
+		printf ( "  DS1307_GetTimeCo: %u calls, %lu TWCR polls\n" , calls , TWCR.reads - polls ) ;
+
+		/* Control register: a write of the same value is dropped */
+		Sim_AdvanceUs ( 200 ) ;
+		bytes = SimTwi_Bytes ( ) ;
+		DS1307_SetControl ( DS1307_Sqw1Hz ) ;
+		SIM_Check ( SimDs1307_GetRegister ( 7 ) == 0x10 && SimTwi_Bytes ( ) - bytes == 3 ) ;
+		DS1307_SetControl ( DS1307_Sqw1Hz ) ;
+		SIM_Check ( SimTwi_Bytes ( ) - bytes == 3 ) ;
+
+		/* Register cache on the NV RAM(08H-0FH): the dirty registers are written in bursts */
+		I2C_CacheInit ( &cache , 0xD0 , 0x08 , 8 ) ;
+		I2C_CacheWrite ( &cache , 0x08 , 0x11 ) ;
+		I2C_CacheWrite ( &cache , 0x09 , 0x22 ) ;
+		I2C_CacheWrite ( &cache , 0x0B , 0x44 ) ;
+		Sim_AdvanceUs ( 200 ) ;
+		bytes = SimTwi_Bytes ( ) ;
+		polls = SimTwi_Starts ( ) ;
+		SIM_Check ( I2C_CacheFlush ( &cache ) ) ;
+		SIM_Check ( SimTwi_Starts ( ) - polls == 2 && SimTwi_Bytes ( ) - bytes == 4 + 3 ) ;	// 0AH is not known
+		SIM_Check ( SimDs1307_GetRegister ( 0x09 ) == 0x22 && SimDs1307_GetRegister ( 0x0B ) == 0x44 ) ;
+
+		/* Once 0AH is known the burst writes it again and one transfer is enough */
+		SimDs1307_SetRegister ( 0x0A , 0x33 ) ;
+		SIM_Check ( I2C_CacheRead ( &cache , 0x0A ) == 0x33 ) ;
+		bytes = SimTwi_Bytes ( ) ;
+		SIM_Check ( I2C_CacheRead ( &cache , 0x09 ) == 0x22 && SimTwi_Bytes ( ) == bytes ) ;	// From the cache
+		I2C_CacheWrite ( &cache , 0x08 , 0x55 ) ;
+		I2C_CacheWrite ( &cache , 0x0B , 0x66 ) ;
+		I2C_CacheWrite ( &cache , 0x0B , 0x77 ) ;			// Combined with the previous write
+		Sim_AdvanceUs ( 200 ) ;
+		bytes = SimTwi_Bytes ( ) ;
+		polls = SimTwi_Starts ( ) ;
+		SIM_Check ( I2C_CacheFlush ( &cache ) ) ;
+		SIM_Check ( SimTwi_Starts ( ) - polls == 1 && SimTwi_Bytes ( ) - bytes == 2 + 4 ) ;
+		SIM_Check ( SimDs1307_GetRegister ( 0x08 ) == 0x55 && SimDs1307_GetRegister ( 0x0B ) == 0x77 ) ;
+
+		/* Nothing to write: no transfer */
+		I2C_CacheWrite ( &cache , 0x0A , 0x33 ) ;
+		bytes = SimTwi_Bytes ( ) ;
+		SIM_Check ( I2C_CacheFlush ( &cache ) && SimTwi_Bytes ( ) == bytes ) ;
+
+		/* Every transfer was ended with a Stop, the reads use a repeated Start */
+		Sim_AdvanceUs ( 200 ) ;
+		SIM_Check ( SimTwi_RepeatedStarts ( ) > 0 ) ;
+		SIM_Check ( SimTwi_Starts ( ) - SimTwi_RepeatedStarts ( ) == SimTwi_Stops ( ) ) ;
+
+		SimTwi_Print ( ) ;
+		return Sim_Summary ( "TestRtc" ) ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Tests\TestRtc.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,120 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Tests\TestScheduler.cpp
+//
+// summary:	Scheduler test on the simulated Timer2
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * TestScheduler.cpp
+ *
+ *
+ * |_______Scheduler.c on the simulated Timer2_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 16:02:18
+ *
+ * Filename: TestScheduler.cpp
+ * Host: Linux g++(the drivers are compiled as C++)
+ * Author: Mohammad Sadr
+ *
+ */
+
+#include <stdio.h>
+#include "Sim.h"
+#include "Scheduler.h"
+
+static unsigned int FastRuns ;
+static unsigned int SlowRuns ;
+static unsigned int DeadlineRuns ;
+static unsigned int LateRuns ;
+static unsigned int DeadlineTime ;
+
+static void FastTask ( )
+	{
+		FastRuns++ ;
+	}
+
+static void SlowTask ( )
+	{
+		SlowRuns++ ;
+		Sim_AdvanceUs ( 3000 ) ;		// 3ms of work
+	}
+
+static void LateTask ( )
+	{
+		LateRuns++ ;
+		if ( LateRuns == 3 )
+			Sim_AdvanceUs ( 35000 ) ;	// Blocks over the next 3 release times
+	}
+
+static void DeadlineTask ( )
+	{
+		DeadlineRuns++ ;
+		DeadlineTime = SCHED_Millis ( ) ;
+	}
+
+int main ( )
+	{
+		SchedStats stats ;
+		unsigned char fast , slow , late ;
+		unsigned int start ;
+		unsigned long last = 0 , counts ;
+		bool monotonic = true ;
+
+		Sim_Reset ( ) ;
+		SCHED_Init ( ) ;
+		SIM_Check ( SCHED_CountsPerMs ( ) == 125 ) ;
+
+		fast = SCHED_AddPeriodic ( FastTask , 10 , 0 ) ;
+		slow = SCHED_AddPeriodic ( SlowTask , 50 , 5 ) ;
+		SCHED_AddDeadline ( DeadlineTask , 25 ) ;
+
+		while ( SCHED_Millis ( ) < 1000 )
+			{
+				SCHED_Run ( ) ;
+				counts = SCHED_Counts ( ) ;
+				if ( counts < last )
+					monotonic = false ;
+				last = counts ;
+			}
+
+		SIM_Check ( FastRuns >= 99 && FastRuns <= 101 ) ;
+		SIM_Check ( SlowRuns == 20 ) ;
+		SIM_Check ( DeadlineRuns == 1 ) ;
+		SIM_Check ( DeadlineTime >= 25 && DeadlineTime <= 26 ) ;
+		SIM_Check ( monotonic ) ;
+
+		/* The tick interrupt runs once per ms, F_CPU/1000 cycles */
+		SIM_Check ( Sim_Interrupts ( ) >= 999 && Sim_Interrupts ( ) <= 1001 ) ;
+		SIM_Check ( Sim_Now ( ) >= F_CPU && Sim_Now ( ) < F_CPU + F_CPU / 1000 ) ;
+
+		SCHED_GetStats ( slow , &stats ) ;
+		SIM_Check ( stats.runs == 20 ) ;
+		SIM_Check ( stats.overruns == 0 ) ;
+		SIM_Check ( stats.max_time >= 3 * 125 && stats.max_time <= 3 * 125 + 10 ) ;
+
+		/* A 35ms run at t=20 releases the t=30 call late and misses the t=40 and t=50 ones */
+		SCHED_Remove ( fast ) ;
+		SCHED_Remove ( slow ) ;
+		late = SCHED_AddPeriodic ( LateTask , 10 , 0 ) ;
+		start = SCHED_Millis ( ) ;
+		while ( ! SCHED_Elapsed ( start , 100 ) )
+			{
+				SCHED_Run ( ) ;
+				Sim_AdvanceUs ( 100 ) ;
+			}
+		SCHED_GetStats ( late , &stats ) ;
+		SIM_Check ( stats.overruns == 2 ) ;
+		SIM_Check ( stats.runs == LateRuns && LateRuns >= 7 && LateRuns <= 8 ) ;
+
+		printf ( "TestScheduler: fast=%u slow=%u interrupts=%lu slow_max=%u counts\n" ,
+			FastRuns , SlowRuns , Sim_Interrupts ( ) , ( unsigned int ) stats.max_time ) ;
+		return Sim_Summary ( "TestScheduler" ) ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Tests\TestScheduler.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,140 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Tests\TestStream.cpp
+//
+// summary:	Stream test on the simulated USART and LCD
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * TestStream.cpp
+ *
+ *
+ * |_______Stream.c and the UART transmit ring_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 20:31:54
+ *
+ * Filename: TestStream.cpp
+ * Host: Linux g++(the drivers are compiled as C++)
+ * Author: Mohammad Sadr
+ *
+ * Note:
+ *
+ *		The printf() of the host runs the put functions of Stream.c through fopencookie(),
+ *		the FILEs of Stream.c are empty on the host(see stdio.h).
+ *
+ */
+
+#include <stdio.h>
+#include <string>
+#include <avr/interrupt.h>
+#include "Sim.h"
+#include "UART.h"
+#include "LCD_4_bit.h"
+#include "Stream.h"
+
+typedef int ( *PutFunction ) ( char ch , FILE *stream ) ;
+
+static ssize_t Write ( void *cookie , const char *data , size_t size )
+	{
+		size_t i ;
+
+		for ( i = 0 ; i < size ; i++ )
+			( ( PutFunction ) cookie ) ( data [ i ] , 0 ) ;
+		return size ;
+	}
+
+/* Host FILE which sends each char to the put function, unbuffered like the avr-libc streams */
+static FILE *Open ( PutFunction put )
+	{
+		cookie_io_functions_t functions = { 0 , Write , 0 , 0 } ;
+		FILE *stream = fopencookie ( ( void * ) put , "w" , functions ) ;
+
+		setvbuf ( stream , 0 , _IONBF , 0 ) ;
+		return stream ;
+	}
+
+int main ( )
+	{
+		FILE *uart , *lcd ;
+		unsigned long long start ;
+		unsigned long frame , writes ;
+		std::string text ( 100 , 0 ) ;
+		unsigned int i ;
+
+		uart = Open ( STREAM_UartPut ) ;
+		lcd = Open ( STREAM_LcdPut ) ;
+
+		Sim_Reset ( ) ;
+		SimLcd_Attach ( SimLcd4Bit ) ;
+		UART_Init ( ) ;
+		LCD_Init ( ) ;
+		STREAM_Init ( ) ;
+		frame = SimUart_FrameCycles ( ) ;
+
+		/* printf() returns once the text is in the ring, '\n' is sent as CR LF */
+		start = Sim_Now ( ) ;
+		fprintf ( uart , "adc=%u\n" , 1023 ) ;
+		SIM_Check ( Sim_Now ( ) - start < frame ) ;
+		SIM_Check ( UART_TxPending ( ) == 8 ) ;			// 2 chars are in the USART already
+		Sim_AdvanceTo ( Sim_Now ( ) + 11 * frame ) ;
+		SIM_Check ( SimUart_Output ( ) == "adc=1023\r\n" && UART_TxPending ( ) == 0 ) ;
+
+		/* More than the ring: UART_TxChar() waits for free places, nothing is lost */
+		for ( i = 0 ; i < text.size ( ) ; i++ )
+			text [ i ] = 'a' + i % 26 ;
+		fputs ( text.c_str ( ) , uart ) ;
+		UART_TxFlush ( ) ;
+		Sim_AdvanceTo ( Sim_Now ( ) + 2 * frame ) ;
+		SIM_Check ( SimUart_Output ( ) == "adc=1023\r\n" + text ) ;
+
+		/* With the interrupts disabled the full ring is sent by UART_TxChar() itself */
+		cli ( ) ;
+		fputs ( text.c_str ( ) , uart ) ;
+		UART_TxFlush ( ) ;
+		sei ( ) ;
+		Sim_AdvanceTo ( Sim_Now ( ) + 2 * frame ) ;
+		SIM_Check ( SimUart_Output ( ) == "adc=1023\r\n" + text + text ) ;
+		SIM_Check ( SimUart_Overruns ( ) == 0 ) ;
+
+		/* Input: CR is read as '\n' */
+		SimUart_Inject ( "ok\r" ) ;
+		Sim_AdvanceTo ( Sim_Now ( ) + 4 * frame ) ;
+		SIM_Check ( STREAM_UartGet ( 0 ) == 'o' && STREAM_UartGet ( 0 ) == 'k' && STREAM_UartGet ( 0 ) == '\n' ) ;
+
+		/* LCD: printf() only writes the copy, the update writes the whole display the first time */
+		writes = SimLcd_DataWrites ( ) ;
+		fprintf ( lcd , "\fT=%2d\nline two is too long" , 5 ) ;
+		SIM_Check ( SimLcd_DataWrites ( ) == writes ) ;
+		SIM_Check ( STREAM_LcdUpdate ( ) == 32 ) ;
+		SIM_Check ( SimLcd_Line ( 0 ) == "T= 5            " ) ;
+		SIM_Check ( SimLcd_Line ( 1 ) == "line two is too " ) ;
+
+		/* The whole display printed again, only the changed char is written */
+		fprintf ( lcd , "\fT=%2d\nline two is too long" , 7 ) ;
+		SIM_Check ( STREAM_LcdUpdate ( ) == 1 && SimLcd_Line ( 0 ) == "T= 7            " ) ;
+
+		/* '\r' goes back to the start of the current line(line two) */
+		fprintf ( lcd , "\rLINE" ) ;
+		SIM_Check ( STREAM_LcdUpdate ( ) == 4 && SimLcd_Line ( 1 ) == "LINE two is too " ) ;
+		SIM_Check ( STREAM_LcdUpdate ( ) == 0 ) ;
+
+		/* '\n' blanks the rest of its line and goes on with the other line */
+		fprintf ( lcd , "\fabc\ndef\nxy" ) ;
+		STREAM_LcdUpdate ( ) ;
+		SIM_Check ( SimLcd_Line ( 0 ) == "xyc             " ) ;
+		SIM_Check ( SimLcd_Line ( 1 ) == "def             " ) ;
+
+		SIM_Check ( SimLcd_BusyViolations ( ) == 0 ) ;
+		fclose ( uart ) ;
+		fclose ( lcd ) ;
+		SimUart_Print ( ) ;
+		SimLcd_Print ( ) ;
+		return Sim_Summary ( "TestStream" ) ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Tests\TestStream.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,125 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Tests\TestTelemetry.cpp
+//
+// summary:	Telemetry test on the simulated UART
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * TestTelemetry.cpp
+ *
+ *
+ * |_______Telemetry.c frames on the simulated UART_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 19:04:26
+ *
+ * Filename: TestTelemetry.cpp
+ * Host: Linux g++(the drivers are compiled as C++)
+ * Author: Mohammad Sadr
+ *
+ * Note:
+ *
+ *		The frames are saved in build/TestTelemetry.bin for Tools/TelemetryDecode.py.
+ *
+ */
+
+#include <stdio.h>
+#include <string>
+#include "Sim.h"
+#include "UART.h"
+#include "Telemetry.h"
+
+/* COBS block without its zero byte, empty if the codes do not fit */
+static std::string Decode ( const std::string &block )
+	{
+		std::string frame ;
+		unsigned int i = 0 , code ;
+
+		while ( i < block.size ( ) )
+			{
+				code = ( unsigned char ) block [ i ] ;
+				if ( code == 0 || i + code > block.size ( ) )
+					return "" ;
+				frame += block.substr ( i + 1 , code - 1 ) ;
+				i += code ;
+				if ( code < 0xff && i < block.size ( ) )
+					frame += '\0' ;
+			}
+		return frame ;
+	}
+
+static bool CrcOk ( const std::string &frame )
+	{
+		unsigned int crc ;
+
+		if ( frame.size ( ) < 3 )
+			return false ;
+		crc = TELEMETRY_Crc16 ( ( const unsigned char * ) frame.data ( ) , frame.size ( ) - 2 ) ;
+		return ( unsigned char ) frame [ frame.size ( ) - 2 ] == ( crc & 0xff ) && ( unsigned char ) frame [ frame.size ( ) - 1 ] == ( crc >> 8 ) ;
+	}
+
+int main ( )
+	{
+		std::string wire , frame ;
+		unsigned char channel , sent ;
+		FILE *file ;
+
+		SIM_Check ( TELEMETRY_Crc16 ( ( const unsigned char * ) "123456789" , 9 ) == 0x6f91 ) ;
+
+		Sim_Reset ( ) ;
+		UART_Init ( ) ;
+
+		/* All field types, with zero bytes in the values for COBS */
+		TELEMETRY_Begin ( ) ;
+		SIM_Check ( TELEMETRY_AddAdc ( 2 , 0x0100 ) ) ;
+		SIM_Check ( TELEMETRY_AddRtc ( 0x12 , 0x34 , 0x56 , 0x19 , 0x10 , 0x26 ) ) ;
+		SIM_Check ( TELEMETRY_AddCounter ( 1 , 70000 ) ) ;
+		SIM_Check ( TELEMETRY_AddValue ( 15 , -5 ) ) ;
+		sent = TELEMETRY_Send ( ) ;
+		Sim_AdvanceTo ( Sim_Now ( ) + 2 * SimUart_FrameCycles ( ) ) ;
+		wire = SimUart_Output ( ) ;
+		SIM_Check ( sent == wire.size ( ) && wire [ wire.size ( ) - 1 ] == 0 ) ;
+		SIM_Check ( wire.find ( '\0' ) == wire.size ( ) - 1 ) ;
+		frame = Decode ( wire.substr ( 0 , wire.size ( ) - 1 ) ) ;
+		SIM_Check ( frame.size ( ) == 1 + 3 + 7 + 5 + 3 + 2 && CrcOk ( frame ) ) ;
+		SIM_Check ( frame.compare ( 0 , 4 , std::string ( "\x00\x12\x00\x01" , 4 ) ) == 0 ) ;
+		SIM_Check ( frame.compare ( 4 , 7 , "\x20\x12\x34\x56\x19\x10\x26" ) == 0 ) ;
+		SIM_Check ( frame.compare ( 11 , 5 , std::string ( "\x31\x70\x11\x01\x00" , 5 ) ) == 0 ) ;
+		SIM_Check ( frame.compare ( 16 , 3 , "\x4f\xfb\xff" ) == 0 ) ;
+
+		/* Full frame: 3 bytes for each ADC sample, 5 for the frame */
+		TELEMETRY_Begin ( ) ;
+		for ( channel = 0 ; channel < 8 ; channel++ )
+			SIM_Check ( TELEMETRY_AddAdc ( channel , 1023 - channel ) ) ;
+		SIM_Check ( TELEMETRY_AddCounter ( 0 , 1 ) ) ;
+		SIM_Check ( ! TELEMETRY_AddRtc ( 0 , 0 , 0 , 1 , 1 , 0 ) ) ;		// 29 of 32 bytes used
+		SIM_Check ( TELEMETRY_AddValue ( 0 , 0 ) ) ;
+		SIM_Check ( TELEMETRY_AddValue ( 1 , 0 ) == 0 ) ;
+		sent = TELEMETRY_Send ( ) ;
+		SIM_Check ( sent == 1 + ( 1 + TELEMETRY_MaxFields + 2 ) + 1 ) ;		// COBS code, frame, zero byte
+		SIM_Check ( TELEMETRY_AddAdc ( 0 , 0 ) == 0 ) ;						// Begin is needed first
+		Sim_AdvanceTo ( Sim_Now ( ) + 2 * SimUart_FrameCycles ( ) ) ;
+		frame = Decode ( SimUart_Output ( ).substr ( wire.size ( ) , sent - 1 ) ) ;
+		SIM_Check ( frame [ 0 ] == 1 && CrcOk ( frame ) ) ;
+
+		/* A damaged byte is found by the CRC */
+		frame [ 5 ] ^= 0x04 ;
+		SIM_Check ( ! CrcOk ( frame ) ) ;
+
+		file = fopen ( "build/TestTelemetry.bin" , "wb" ) ;
+		if ( file )
+			{
+				wire = SimUart_Output ( ) ;
+				fwrite ( wire.data ( ) , 1 , wire.size ( ) , file ) ;
+				fclose ( file ) ;
+			}
+		SimUart_Print ( ) ;
+		return Sim_Summary ( "TestTelemetry" ) ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Tests\TestTelemetry.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
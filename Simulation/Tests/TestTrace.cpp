@@ -0,0 +1,80 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Tests\TestTrace.cpp
+//
+// summary:	Trace pin test on the simulated logic analyzer
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * TestTrace.cpp
+ *
+ *
+ * |_______Trace.h pins of the instrumented drivers_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 18:31:47
+ *
+ * Filename: TestTrace.cpp
+ * Host: Linux g++(the drivers are compiled as C++)
+ * Author: Mohammad Sadr
+ *
+ */
+
+#include <stdio.h>
+#include "Sim.h"
+#include "Trace.h"
+#include "Scheduler.h"
+#include "RTC_DS1307.h"
+#include "LCD_4_bit.h"
+#include "ADC.h"
+
+int main ( )
+	{
+		unsigned char i2c , lcd , adc ;
+
+		Sim_Reset ( ) ;
+		SimLcd_Attach ( SimLcd4Bit ) ;
+		i2c = SimVcd_Watch ( "i2c_write" , TRACE_PORT , TRACE_PinI2cWrite ) ;
+		lcd = SimVcd_Watch ( "lcd_write" , TRACE_PORT , TRACE_PinLcdWrite ) ;
+		adc = SimVcd_Watch ( "adc" , TRACE_PORT , TRACE_PinAdc ) ;
+		TRACE_Init ( ) ;
+		SIM_Check ( ( DDRD.value & TRACE_Pins ) == TRACE_Pins && ( PORTD.value & TRACE_Pins ) == 0 ) ;
+
+		/* Address, register and data byte: one pulse per byte, as long as the 9 SCL clocks */
+		DS1307_Init ( ) ;
+		SIM_Check ( SimVcd_Pulses ( i2c ) == 3 ) ;
+		SIM_Check ( SimVcd_MinHigh ( i2c ) >= 9 * ( 16 + 2 * 0x46 ) ) ;
+
+		/* The commands of LCD_Init() are not traced, the data write holds the pin for its 1ms delay */
+		LCD_Init ( ) ;
+		LCD_DataWrite ( 'A' ) ;
+		SIM_Check ( SimLcd_Line ( 0 ) [ 0 ] == 'A' ) ;
+		SIM_Check ( SimVcd_Pulses ( lcd ) == 1 ) ;
+		SIM_Check ( SimVcd_MinHigh ( lcd ) >= Sim_UsToCycles ( 1000 ) ) ;
+
+		/* Blocking conversion and one of the sampling task: 13 ADC clocks at F_CPU/2 */
+		ADC_Init ( ) ;
+		ADC_StartConversion ( 0 ) ;
+		SIM_Check ( SimVcd_Pulses ( adc ) == 1 ) ;
+		SIM_Check ( SimVcd_MinHigh ( adc ) >= 13 * 2 ) ;
+		SCHED_Init ( ) ;
+		ADC_SampleStart ( 0x01 , 1 ) ;
+		while ( SCHED_Millis ( ) < 5 )
+			{
+				SCHED_Run ( ) ;
+				Sim_AdvanceUs ( 100 ) ;
+			}
+		ADC_SampleStop ( ) ;
+		SIM_Check ( SimVcd_Pulses ( adc ) > 2 && ! ( PORTD.value & ( 1 << TRACE_PinAdc ) ) ) ;
+		SIM_Check ( SimVcd_Pulses ( i2c ) == 3 && SimVcd_Pulses ( lcd ) == 1 ) ;
+
+		SIM_Check ( SimVcd_Write ( "build/TestTrace.vcd" ) ) ;
+		SimVcd_Print ( ) ;
+		return Sim_Summary ( "TestTrace" ) ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Tests\TestTrace.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
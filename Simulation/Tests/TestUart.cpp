@@ -0,0 +1,121 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Tests\TestUart.cpp
+//
+// summary:	UART test on the simulated USART
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * TestUart.cpp
+ *
+ *
+ * |_______UART.c on the simulated USART_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 16:02:18
+ *
+ * Filename: TestUart.cpp
+ * Host: Linux g++(the drivers are compiled as C++)
+ * Author: Mohammad Sadr
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <avr/pgmspace.h>
+#include "Sim.h"
+#include "UART.h"
+
+static const char Ready [ ] PROGMEM = "Ready" ;
+
+int main ( )
+	{
+		char text [ ] = "Hello" , line [ 16 ] ;
+		unsigned long long start ;
+		unsigned long frame ;
+		char ch ;
+		bool echo = true ;
+
+		Sim_Reset ( ) ;
+		UART_Init ( ) ;
+		frame = SimUart_FrameCycles ( ) ;
+		SIM_Check ( frame == 10UL * 16 * ( UART_Ubrr ( 9600 ) + 1 ) ) ;		// 8N1
+
+		/* Transmit: the driver waits for UDRE, so the string takes one frame per char after the first */
+		start = Sim_Now ( ) ;
+		UART_TxString ( text ) ;
+		SIM_Check ( Sim_Now ( ) - start >= 3 * frame ) ;
+		SIM_Check ( Sim_Now ( ) - start < 5 * frame ) ;
+		Sim_AdvanceTo ( Sim_Now ( ) + 2 * frame ) ;
+		SIM_Check ( SimUart_Output ( ) == "Hello" ) ;
+
+		UART_TxNumber ( 1234 ) ;				// 5 digits, zero padded
+		Sim_AdvanceTo ( Sim_Now ( ) + 6 * frame ) ;
+		SIM_Check ( SimUart_Output ( ) == "Hello01234" ) ;
+
+		UART_TxString_P ( Ready ) ;				// From flash
+		Sim_AdvanceTo ( Sim_Now ( ) + 2 * frame ) ;
+		SIM_Check ( SimUart_Output ( ) == "Hello01234Ready" ) ;
+
+		/* Loopback: each char sent is received again */
+		SimUart_Loopback ( true ) ;
+		for ( ch = 'a' ; ch <= 'z' ; ch++ )
+			{
+				UART_TxChar ( ch ) ;
+				if ( UART_RxChar ( ) != ch )
+					echo = false ;
+			}
+		SIM_Check ( echo ) ;
+		SIM_Check ( SimUart_Overruns ( ) == 0 ) ;
+
+		/* Receive a line typed on the terminal, the driver echoes it */
+		SimUart_Loopback ( false ) ;
+		SimUart_Inject ( "AT+1\r" ) ;
+		UART_RxString ( line ) ;
+		SIM_Check ( strcmp ( line , "AT+1" ) == 0 ) ;
+		Sim_AdvanceTo ( Sim_Now ( ) + 3 * frame ) ;
+		SIM_Check ( SimUart_Output ( ).substr ( SimUart_Output ( ).size ( ) - 5 ) == "AT+1\r" ) ;
+
+		/* Nobody reads UDR: the 2 byte FIFO overflows */
+		SimUart_Inject ( "12345" ) ;
+		Sim_AdvanceTo ( Sim_Now ( ) + 6 * frame ) ;
+		SIM_Check ( SimUart_Overruns ( ) == 3 ) ;
+		SIM_Check ( UCSRA.value & ( 1 << DOR ) ) ;
+		UART_RxChar ( ) ;
+		UART_RxChar ( ) ;
+
+		/* Interrupt driven reception: the ring keeps the chars while nobody reads */
+		UART_RxStart ( ) ;
+		SimUart_Inject ( "abcdefghijklmnopqrst" ) ;
+		Sim_AdvanceTo ( Sim_Now ( ) + 21 * frame ) ;
+		SIM_Check ( UART_RxAvailable ( ) == 20 && UART_RxLost ( ) == 0 ) ;
+		SIM_Check ( UART_RxGet ( &ch ) && ch == 'a' ) ;
+		SIM_Check ( UART_RxChar ( ) == 'b' ) ;
+		while ( UART_RxGet ( &ch ) )
+			;
+		SIM_Check ( ch == 't' && UART_RxAvailable ( ) == 0 ) ;
+		SimUart_Inject ( std::string ( 40 , 'x' ) ) ;
+		Sim_AdvanceTo ( Sim_Now ( ) + 41 * frame ) ;
+		SIM_Check ( UART_RxAvailable ( ) == UART_RxBufferSize - 1 ) ;
+		SIM_Check ( UART_RxLost ( ) == 40 - ( UART_RxBufferSize - 1 ) ) ;
+		SIM_Check ( SimUart_Overruns ( ) == 3 ) ;
+
+		/* 38400 baud with U2X: 8 samples per bit, UBRR 25 at 8 MHz */
+		UART_PortInit ( UART_Port0 , UART_UbrrU2x ( 38400 ) ) ;
+		SIM_Check ( ( UCSRA.value & ( 1 << U2X ) ) && UBRRH.value == 0 ) ;
+		SIM_Check ( SimUart_FrameCycles ( ) == 10UL * 8 * ( ( UART_UbrrU2x ( 38400 ) & ~ UART_U2x ) + 1 ) ) ;
+		SimUart_Loopback ( true ) ;
+		UART_TxString ( ( char * ) "fast" ) ;
+		SIM_Check ( UART_RxChar ( ) == 'f' ) ;
+		SimUart_Loopback ( false ) ;
+
+		SimUart_Print ( ) ;
+		return Sim_Summary ( "TestUart" ) ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Tests\TestUart.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
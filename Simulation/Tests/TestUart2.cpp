@@ -0,0 +1,133 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Tests\TestUart2.cpp
+//
+// summary:	Two port UART test on the simulated USART0 and USART1
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * TestUart2.cpp
+ *
+ *
+ * |_______UART.c on the two USARTs of the Atmega128/1284_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 23:08:14
+ *
+ * Filename: TestUart2.cpp
+ * Host: Linux g++(the drivers are compiled as C++ with SIM_USART1)
+ * Author: Mohammad Sadr
+ *
+ */
+
+#include <stdio.h>
+#include <string>
+#include "Sim.h"
+#include "UART.h"
+
+static std::string Received ( unsigned char port )
+	{
+		std::string text ;
+		char ch ;
+
+		while ( UART_PortRxGet ( port , &ch ) )
+			text += ch ;
+		return text ;
+	}
+
+int main ( )
+	{
+		const std::string host = "host link at 4800 baud\r\n" , bus = "field bus at 2400 baud\r\n" ;
+		const std::string forward = "0123456789abcdefghijklmnopqrst" ;
+		static const unsigned char reply [ 3 ] = { 'A' , 'C' , 'K' } ;
+		unsigned long long start , elapsed ;
+		unsigned long frame0 , frame1 ;
+		std::string copied ;
+		unsigned char de0 , de1 ;
+		char ch ;
+
+		Sim_Reset ( ) ;
+		SIM_Check ( UART_Ports == 2 ) ;
+
+		/* Each port has its own baud rate */
+		UART_PortInit ( UART_Port0 , UART_Ubrr ( 4800 ) ) ;
+		UART_PortInit ( UART_Port1 , UART_Ubrr ( 2400 ) ) ;
+		frame0 = SimUart_FrameCycles ( ) ;
+		frame1 = SimUart1_FrameCycles ( ) ;
+		SIM_Check ( frame0 == 10UL * 16 * ( UART_Ubrr ( 4800 ) + 1 ) && frame1 == 10UL * 16 * ( UART_Ubrr ( 2400 ) + 1 ) ) ;
+
+		/* Both transmit rings at once: the time of the slower port, not the sum of both */
+		UART_PortTxStart ( UART_Port0 ) ;
+		UART_PortTxStart ( UART_Port1 ) ;
+		start = Sim_Now ( ) ;
+		UART_PortTxString ( UART_Port0 , host.c_str ( ) ) ;
+		UART_PortTxString ( UART_Port1 , bus.c_str ( ) ) ;
+		while ( SimUart_Output ( ).size ( ) < host.size ( ) || SimUart1_Output ( ).size ( ) < bus.size ( ) )
+			Sim_AdvanceUs ( 100 ) ;
+		elapsed = Sim_Now ( ) - start ;
+		SIM_Check ( SimUart_Output ( ) == host && SimUart1_Output ( ) == bus ) ;
+		SIM_Check ( elapsed >= bus.size ( ) * frame1 && elapsed < ( bus.size ( ) + 1 ) * frame1 ) ;
+		printf ( "  uart2: %u + %u chars in %llu cycles, %lu cycles one after the other\n" ,
+			( unsigned int ) host.size ( ) , ( unsigned int ) bus.size ( ) , elapsed , host.size ( ) * frame0 + bus.size ( ) * frame1 ) ;
+
+		/* Both receive rings at once, each port keeps its own chars */
+		UART_PortRxStart ( UART_Port0 ) ;
+		UART_PortRxStart ( UART_Port1 ) ;
+		SimUart_Inject ( "abcdefghijklmnopqrst" ) ;
+		SimUart1_Inject ( "ABCDEFGHIJKLMNOPQRST" ) ;
+		Sim_AdvanceTo ( Sim_Now ( ) + 21 * frame1 ) ;
+		SIM_Check ( UART_PortRxAvailable ( UART_Port0 ) == 20 && UART_PortRxAvailable ( UART_Port1 ) == 20 ) ;
+		SIM_Check ( Received ( UART_Port0 ) == "abcdefghijklmnopqrst" ) ;
+		SIM_Check ( Received ( UART_Port1 ) == "ABCDEFGHIJKLMNOPQRST" ) ;
+		SIM_Check ( UART_PortRxLost ( UART_Port0 ) == 0 && UART_PortRxLost ( UART_Port1 ) == 0 ) ;
+
+		/* Field bus to host link while both interrupts run */
+		SimUart1_Inject ( forward ) ;
+		start = Sim_Now ( ) ;
+		while ( copied.size ( ) < forward.size ( ) && Sim_Now ( ) - start < 2 * forward.size ( ) * frame1 )
+			{
+				if ( UART_PortRxGet ( UART_Port1 , &ch ) )
+					{
+						UART_PortTxChar ( UART_Port0 , ch ) ;
+						copied += ch ;
+					}
+				Sim_AdvanceUs ( 100 ) ;
+			}
+		UART_PortTxFlush ( UART_Port0 ) ;
+		Sim_AdvanceTo ( Sim_Now ( ) + 2 * frame0 ) ;
+		SIM_Check ( SimUart_Output ( ) == host + forward ) ;
+		SIM_Check ( SimUart_Overruns ( ) == 0 && SimUart1_Overruns ( ) == 0 ) ;
+
+		/* RS-485 on port 1 with its own DE pin, port 0 goes on with the UART_...() functions */
+		de0 = SimVcd_Watch ( "de0" , UART_DePort , UART_DePin ) ;
+		de1 = SimVcd_Watch ( "de1" , UART_De1Port , UART_De1Pin ) ;
+		UART_PortRs485Start ( UART_Port1 , 0x12 ) ;
+		frame1 = SimUart1_FrameCycles ( ) ;
+		SimUart1_InjectFrame ( 0x100 | 0x20 ) ;
+		SimUart1_Inject ( "other" ) ;
+		SimUart1_InjectFrame ( 0x100 | 0x12 ) ;
+		SimUart1_Inject ( "mine" ) ;
+		Sim_AdvanceTo ( Sim_Now ( ) + 12 * frame1 ) ;
+		SIM_Check ( Received ( UART_Port1 ) == "mine" && SimUart1_MpcmDropped ( ) == 5 ) ;
+
+		start = Sim_Now ( ) ;
+		UART_PortRs485Send ( UART_Port1 , 0x01 , reply , 3 ) ;
+		UART_TxString ( ( char * ) "ok" ) ;
+		SIM_Check ( UART_PortRs485Busy ( UART_Port1 ) && ! UART_Rs485Busy ( ) ) ;
+		Sim_AdvanceTo ( start + 5 * frame1 ) ;
+		SIM_Check ( ! UART_PortRs485Busy ( UART_Port1 ) ) ;
+		SIM_Check ( SimVcd_Pulses ( de1 ) == 1 && SimVcd_Pulses ( de0 ) == 0 ) ;
+		SIM_Check ( SimVcd_MaxHigh ( de1 ) >= 4 * frame1 && SimVcd_MaxHigh ( de1 ) < 4 * frame1 + 100 ) ;
+		SIM_Check ( SimUart1_Output ( ).substr ( SimUart1_Output ( ).size ( ) - 4 ) == "\x01" "ACK" ) ;
+		SIM_Check ( SimUart_Output ( ) == host + forward + "ok" ) ;
+
+		SimUart_Print ( ) ;
+		SimUart1_Print ( ) ;
+		return Sim_Summary ( "TestUart2" ) ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\Tests\TestUart2.cpp
+////////////////////////////////////////////////////////////////////////////////////////////////////
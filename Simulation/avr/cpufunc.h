@@ -0,0 +1,41 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\avr\cpufunc.h
+//
+// summary:	Declares the simulated CPU functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * cpufunc.h
+ *
+ *
+ * |_______Host simulation of avr/cpufunc.h_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 16:02:18
+ *
+ * Filename: cpufunc.h
+ * Host: Linux g++(the drivers are compiled as C++)
+ * Author: Mohammad Sadr
+ *
+ * Note:
+ *
+ *		_NOP() costs one simulated cycle.
+ *
+ */
+
+#ifndef SIM_AVR_CPUFUNC_H_
+#define SIM_AVR_CPUFUNC_H_
+
+#include <avr/io.h>
+
+#define _NOP( )					Sim_Advance ( 1 )
+#define _MemoryBarrier( )
+
+#endif /* SIM_AVR_CPUFUNC_H_ */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\avr\cpufunc.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
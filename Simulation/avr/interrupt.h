@@ -0,0 +1,44 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\avr\interrupt.h
+//
+// summary:	Declares the simulated interrupt macros
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * interrupt.h
+ *
+ *
+ * |_______Host simulation of avr/interrupt.h_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 16:02:18
+ *
+ * Filename: interrupt.h
+ * Host: Linux g++(the drivers are compiled as C++)
+ * Author: Mohammad Sadr
+ *
+ * Note:
+ *
+ *		ISR() defines the vector with C linkage, the simulator calls it when the interrupt is enabled,
+ *		its flag is set and SREG I bit is set. The I bit is cleared while the ISR runs, like the hardware does.
+ *
+ */
+
+#ifndef SIM_AVR_INTERRUPT_H_
+#define SIM_AVR_INTERRUPT_H_
+
+#include <avr/io.h>
+
+#define ISR( vector , ... )		extern "C" void vector ( void ) ; extern "C" void vector ( void )
+
+#define sei( )					Sim_Sei ( )
+#define cli( )					Sim_Cli ( )
+
+#endif /* SIM_AVR_INTERRUPT_H_ */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\avr\interrupt.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
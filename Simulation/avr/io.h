@@ -0,0 +1,393 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\avr\io.h
+//
+// summary:	Declares the simulated Atmega32 registers
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * io.h
+ *
+ *
+ * |_______Host simulation of the Atmega32 I/O registers_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 16:02:18
+ *
+ * Filename: io.h
+ * Host: Linux g++(the drivers are compiled as C++)
+ * Author: Mohammad Sadr
+ * Reference:Atmega32 dataSheet
+ *
+ * Note:
+ *
+ *		Replaces <avr/io.h> in the host build. Every register is a SimRegister object, so the
+ *		peripheral models(Simulation/Sim*.cpp) see each read and write of the drivers, with its side effects:
+ *			ex: UDR = ch ;       -> starts the UART transmission
+ *			    ch = UDR ;       -> takes the byte out of the UART receive buffer
+ *			    PORTB |= 0x04 ;  -> a read and a write, like the real read-modify-write
+ *		Each access costs one simulated CPU cycle, code between the accesses costs nothing.
+ *		The second USART of the Atmega128/1284(UDR1, UCSR1A, ...) is simulated as well, the drivers only
+ *		see it when built with SIM_USART1. Its UCSR1C shares the address of UBRR1H like on port 0.
+ *
+ */
+
+#ifndef SIM_AVR_IO_H_
+#define SIM_AVR_IO_H_
+
+#ifndef __cplusplus
+	#error "The simulated registers need C++, compile the drivers with g++ -x c++"
+#endif
+
+#define SimMaxWriteHooks		4
+
+class SimRegister
+	{
+		public :
+			typedef unsigned char ( *ReadHook ) ( SimRegister &reg ) ;
+			typedef void ( *WriteHook ) ( SimRegister &reg , unsigned char old_value ) ;
+
+			explicit SimRegister ( const char *reg_name ) ;
+
+			operator unsigned char ( ) ;							// Driver read
+			SimRegister &operator= ( unsigned int data ) ;			// Driver write
+			SimRegister &operator= ( SimRegister &reg ) ;
+			SimRegister &operator|= ( unsigned int data ) ;
+			SimRegister &operator&= ( unsigned int data ) ;
+			SimRegister &operator^= ( unsigned int data ) ;
+
+			void OnRead ( ReadHook hook ) ;			// One model computes the value read(ex: PINC)
+			void OnWrite ( WriteHook hook ) ;		// Several models may watch the writes(ex: PORTB)
+			void Reset ( ) ;
+
+			const char *name ;
+			unsigned char value ;					// Register contents, changed directly by the models
+			unsigned long reads ;
+			unsigned long writes ;
+
+		private :
+			ReadHook read_hook ;
+			WriteHook write_hooks [ SimMaxWriteHooks ] ;
+	} ;
+
+class SimRegister16
+	{
+		public :
+			typedef unsigned int ( *ReadHook ) ( SimRegister16 &reg ) ;
+			typedef void ( *WriteHook ) ( SimRegister16 &reg ) ;
+
+			explicit SimRegister16 ( const char *reg_name ) ;
+
+			operator unsigned int ( ) ;
+			SimRegister16 &operator= ( unsigned int data ) ;
+
+			void OnRead ( ReadHook hook ) ;
+			void OnWrite ( WriteHook hook ) ;
+			void Reset ( ) ;
+
+			const char *name ;
+			unsigned int value ;
+			unsigned long reads ;
+			unsigned long writes ;
+
+		private :
+			ReadHook read_hook ;
+			WriteHook write_hook ;
+	} ;
+
+/* Used by the other simulated avr-libc headers */
+void Sim_Advance ( unsigned long cycles ) ;
+void Sim_Sei ( ) ;
+void Sim_Cli ( ) ;
+void Sim_Sleep ( ) ;
+
+/* Ports */
+extern SimRegister PORTA , DDRA , PINA ;
+extern SimRegister PORTB , DDRB , PINB ;
+extern SimRegister PORTC , DDRC , PINC ;
+extern SimRegister PORTD , DDRD , PIND ;
+
+/* USART */
+extern SimRegister UDR , UCSRA , UCSRB , UCSRC , UBRRH , UBRRL ;
+
+/* Second USART of the Atmega128/1284, seen by the drivers built with SIM_USART1(USART0 is the one above) */
+extern SimRegister UDR1 , UCSR1A , UCSR1B , UCSR1C , UBRR1H , UBRR1L ;
+#ifdef SIM_USART1
+#define UDR0				UDR
+#define UCSR0A				UCSRA
+#define UCSR0B				UCSRB
+#define UCSR0C				UCSRC
+#define UBRR0H				UBRRH
+#define UBRR0L				UBRRL
+#define UDR1				UDR1		// Defined like in avr-libc, the drivers test it
+#define USART0_RX_vect		USART_RXC_vect
+#define USART0_UDRE_vect	USART_UDRE_vect
+#define USART0_TX_vect		USART_TXC_vect
+#endif
+
+/* TWI */
+extern SimRegister TWBR , TWSR , TWAR , TWDR , TWCR ;
+
+/* ADC */
+extern SimRegister ADMUX , ADCSRA , ADCL , ADCH , SFIOR ;
+extern SimRegister16 ADCW ;
+#define ADC		ADCW
+
+/* EEPROM */
+extern SimRegister EEDR , EECR ;
+extern SimRegister16 EEAR ;
+#define E2END				0x3FF		// Last EEPROM address of the Atmega32
+
+/* Timers */
+extern SimRegister TCCR0 , TCNT0 , OCR0 ;
+extern SimRegister TCCR1A , TCCR1B ;
+extern SimRegister16 TCNT1 , OCR1A , OCR1B , ICR1 ;
+extern SimRegister TCCR2 , TCNT2 , OCR2 , ASSR ;
+extern SimRegister TIMSK , TIFR ;
+
+/* SPI */
+extern SimRegister SPCR , SPSR , SPDR ;
+
+/* System */
+extern SimRegister SREG , MCUCR , MCUCSR , GICR , GIFR , OSCCAL , WDTCR ;
+#define GICR				GICR		// Defined like in avr-libc, the drivers test it
+
+/* Port pins */
+#define PA0 0
+#define PA1 1
+#define PA2 2
+#define PA3 3
+#define PA4 4
+#define PA5 5
+#define PA6 6
+#define PA7 7
+#define PB0 0
+#define PB1 1
+#define PB2 2
+#define PB3 3
+#define PB4 4
+#define PB5 5
+#define PB6 6
+#define PB7 7
+#define PC0 0
+#define PC1 1
+#define PC2 2
+#define PC3 3
+#define PC4 4
+#define PC5 5
+#define PC6 6
+#define PC7 7
+#define PD0 0
+#define PD1 1
+#define PD2 2
+#define PD3 3
+#define PD4 4
+#define PD5 5
+#define PD6 6
+#define PD7 7
+
+/* UCSRA */
+#define RXC		7
+#define TXC		6
+#define UDRE	5
+#define FE		4
+#define DOR		3
+#define PE		2
+#define U2X		1
+#define MPCM	0
+
+/* UCSRB */
+#define RXCIE	7
+#define TXCIE	6
+#define UDRIE	5
+#define RXEN	4
+#define TXEN	3
+#define UCSZ2	2
+#define RXB8	1
+#define TXB8	0
+
+/* UCSRC */
+#define URSEL	7
+#define UMSEL	6
+#define UPM1	5
+#define UPM0	4
+#define USBS	3
+#define UCSZ1	2
+#define UCSZ0	1
+#define UCPOL	0
+
+/* TWCR */
+#define TWINT	7
+#define TWEA	6
+#define TWSTA	5
+#define TWSTO	4
+#define TWWC	3
+#define TWEN	2
+#define TWIE	0
+
+/* TWSR */
+#define TWS7	7
+#define TWS6	6
+#define TWS5	5
+#define TWS4	4
+#define TWS3	3
+#define TWPS1	1
+#define TWPS0	0
+
+/* TWAR */
+#define TWGCE	0
+
+/* ADMUX */
+#define REFS1	7
+#define REFS0	6
+#define ADLAR	5
+#define MUX4	4
+#define MUX3	3
+#define MUX2	2
+#define MUX1	1
+#define MUX0	0
+
+/* ADCSRA */
+#define ADEN	7
+#define ADSC	6
+#define ADATE	5
+#define ADIF	4
+#define ADIE	3
+#define ADPS2	2
+#define ADPS1	1
+#define ADPS0	0
+
+/* EECR */
+#define EERIE	3
+#define EEMWE	2
+#define EEWE	1
+#define EERE	0
+
+/* TCCR0 */
+#define FOC0	7
+#define WGM00	6
+#define COM01	5
+#define COM00	4
+#define WGM01	3
+#define CS02	2
+#define CS01	1
+#define CS00	0
+
+/* TCCR1A */
+#define COM1A1	7
+#define COM1A0	6
+#define COM1B1	5
+#define COM1B0	4
+#define FOC1A	3
+#define FOC1B	2
+#define WGM11	1
+#define WGM10	0
+
+/* TCCR1B */
+#define ICNC1	7
+#define ICES1	6
+#define WGM13	4
+#define WGM12	3
+#define CS12	2
+#define CS11	1
+#define CS10	0
+
+/* TCCR2 */
+#define FOC2	7
+#define WGM20	6
+#define COM21	5
+#define COM20	4
+#define WGM21	3
+#define CS22	2
+#define CS21	1
+#define CS20	0
+
+/* ASSR */
+#define AS2		3
+#define TCN2UB	2
+#define OCR2UB	1
+#define TCR2UB	0
+
+/* TIMSK */
+#define OCIE2	7
+#define TOIE2	6
+#define TICIE1	5
+#define OCIE1A	4
+#define OCIE1B	3
+#define TOIE1	2
+#define OCIE0	1
+#define TOIE0	0
+
+/* TIFR */
+#define OCF2	7
+#define TOV2	6
+#define ICF1	5
+#define OCF1A	4
+#define OCF1B	3
+#define TOV1	2
+#define OCF0	1
+#define TOV0	0
+
+/* SPCR/SPSR */
+#define SPIE	7
+#define SPE		6
+#define DORD	5
+#define MSTR	4
+#define CPOL	3
+#define CPHA	2
+#define SPR1	1
+#define SPR0	0
+#define SPIF	7
+#define WCOL	6
+#define SPI2X	0
+
+/* SREG */
+#define SREG_I	7
+
+/* MCUCR */
+#define SM2		7
+#define SE		6
+#define SM1		5
+#define SM0		4
+#define ISC11	3
+#define ISC10	2
+#define ISC01	1
+#define ISC00	0
+
+/* MCUCSR */
+#define JTD		7
+#define ISC2	6
+#define JTRF	4
+#define WDRF	3
+#define BORF	2
+#define EXTRF	1
+#define PORF	0
+
+/* GICR */
+#define INT1	7
+#define INT0	6
+#define INT2	5
+#define IVSEL	1
+#define IVCE	0
+
+/* GIFR */
+#define INTF1	7
+#define INTF0	6
+#define INTF2	5
+
+/* WDTCR */
+#define WDTOE	4
+#define WDE		3
+#define WDP2	2
+#define WDP1	1
+#define WDP0	0
+
+#define _BV( bit )		( 1 << ( bit ) )
+
+#endif /* SIM_AVR_IO_H_ */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\avr\io.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,56 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\avr\pgmspace.h
+//
+// summary:	Declares the simulated program memory access
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * pgmspace.h
+ *
+ *
+ * |_______Host simulation of avr/pgmspace.h_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 16:02:18
+ *
+ * Filename: pgmspace.h
+ * Host: Linux g++(the drivers are compiled as C++)
+ * Author: Mohammad Sadr
+ *
+ * Note:
+ *
+ *		The host has a single address space, so PROGMEM is empty and the pgm_read_*() macros read RAM.
+ *		pgm_read_word/pgm_read_dword read 16/32 bits like the AVR, so tables of unsigned int(32-bit on the host)
+ *		still give the right value on a little endian host.
+ *
+ */
+
+#ifndef SIM_AVR_PGMSPACE_H_
+#define SIM_AVR_PGMSPACE_H_
+
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM
+#define PGM_P						const char *
+#define PSTR( s )					( s )
+
+#define pgm_read_byte( address )	( *( const uint8_t * ) ( address ) )
+#define pgm_read_word( address )	( *( const uint16_t * ) ( address ) )
+#define pgm_read_dword( address )	( *( const uint32_t * ) ( address ) )
+#define pgm_read_ptr( address )		( *( void * const * ) ( address ) )
+
+#define strlen_P					strlen
+#define strcpy_P					strcpy
+#define strcmp_P					strcmp
+#define strncmp_P					strncmp
+#define memcpy_P					memcpy
+
+#endif /* SIM_AVR_PGMSPACE_H_ */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\avr\pgmspace.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
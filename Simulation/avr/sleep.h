@@ -0,0 +1,50 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\avr\sleep.h
+//
+// summary:	Declares the simulated sleep macros
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * sleep.h
+ *
+ *
+ * |_______Host simulation of avr/sleep.h_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 16:02:18
+ *
+ * Filename: sleep.h
+ * Host: Linux g++(the drivers are compiled as C++)
+ * Author: Mohammad Sadr
+ *
+ * Note:
+ *
+ *		sleep_cpu() lets the simulated time run till an interrupt is called(see Sim_Sleep()).
+ *		In SLEEP_MODE_PWR_DOWN the timers stop, only an external interrupt can wake up.
+ *
+ */
+
+#ifndef SIM_AVR_SLEEP_H_
+#define SIM_AVR_SLEEP_H_
+
+#include <avr/io.h>
+
+#define SLEEP_MODE_IDLE			0
+#define SLEEP_MODE_ADC			( 1 << SM0 )
+#define SLEEP_MODE_PWR_DOWN		( 1 << SM1 )
+#define SLEEP_MODE_PWR_SAVE		( ( 1 << SM1 ) | ( 1 << SM0 ) )
+#define SLEEP_MODE_STANDBY		( ( 1 << SM2 ) | ( 1 << SM1 ) )
+
+#define set_sleep_mode( mode )	do { MCUCR = ( MCUCR & ~ ( ( 1 << SM2 ) | ( 1 << SM1 ) | ( 1 << SM0 ) ) ) | ( mode ) ; } while ( 0 )
+#define sleep_enable( )			do { MCUCR |= ( 1 << SE ) ; } while ( 0 )
+#define sleep_disable( )		do { MCUCR &= ~ ( 1 << SE ) ; } while ( 0 )
+#define sleep_cpu( )			Sim_Sleep ( )
+
+#endif /* SIM_AVR_SLEEP_H_ */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\avr\sleep.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,49 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\stdio.h
+//
+// summary:	Declares the simulated avr-libc stdio additions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * stdio.h
+ *
+ *
+ * |_______Host simulation of the avr-libc part of stdio.h_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 20:31:54
+ *
+ * Filename: stdio.h
+ * Host: Linux g++(the drivers are compiled as C++)
+ * Author: Mohammad Sadr
+ *
+ * Note:
+ *
+ *		The host stdio.h is used as it is. Its FILE can not be set up with put and get functions
+ *		at compile time, so FDEV_SETUP_STREAM gives an empty FILE which must not be used.
+ *		The tests call the put and get functions of the drivers directly or through a FILE of
+ *		fopencookie(), which runs them under the printf() of the host.
+ *
+ */
+
+#ifndef SIM_STDIO_H_
+#define SIM_STDIO_H_
+
+#include_next <stdio.h>
+
+#define _FDEV_SETUP_READ			0x01
+#define _FDEV_SETUP_WRITE			0x02
+#define _FDEV_SETUP_RW				( _FDEV_SETUP_READ | _FDEV_SETUP_WRITE )
+#define _FDEV_ERR					( -1 )
+#define _FDEV_EOF					( -2 )
+
+#define FDEV_SETUP_STREAM( put , get , rwflag )		{ }
+
+#endif /* SIM_STDIO_H_ */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\stdio.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
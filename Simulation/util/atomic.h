@@ -0,0 +1,63 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\util\atomic.h
+//
+// summary:	Declares the simulated atomic block
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * atomic.h
+ *
+ *
+ * |_______Host simulation of util/atomic.h_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 16:02:18
+ *
+ * Filename: atomic.h
+ * Host: Linux g++(the drivers are compiled as C++)
+ * Author: Mohammad Sadr
+ *
+ * Note:
+ *
+ *		ATOMIC_BLOCK() clears the I bit for the block and restores it when the block is left,
+ *		also with return or break, like the avr-libc cleanup attribute does.
+ *
+ */
+
+#ifndef SIM_UTIL_ATOMIC_H_
+#define SIM_UTIL_ATOMIC_H_
+
+#include <avr/io.h>
+
+#define ATOMIC_RESTORESTATE		0
+#define ATOMIC_FORCEON			1
+#define NONATOMIC_RESTORESTATE	2
+#define NONATOMIC_FORCEOFF		3
+
+unsigned char SimAtomic_Begin ( unsigned char type ) ;		// Returns SREG before the block
+
+/* Inline, so the compiler sees that the block is run once */
+class SimAtomic
+	{
+		public :
+			explicit SimAtomic ( unsigned char block_type ) : type ( block_type ) , sreg ( SimAtomic_Begin ( block_type ) ) , done ( false ) { }
+			~SimAtomic ( ) ;
+			bool Once ( ) { return done ? false : ( done = true ) ; }
+
+		private :
+			unsigned char type ;
+			unsigned char sreg ;
+			bool done ;
+	} ;
+
+#define ATOMIC_BLOCK( type )		for ( SimAtomic sim_atomic ( ( type ) ) ; sim_atomic.Once ( ) ; )
+#define NONATOMIC_BLOCK( type )		for ( SimAtomic sim_atomic ( ( type ) ) ; sim_atomic.Once ( ) ; )
+
+#endif /* SIM_UTIL_ATOMIC_H_ */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\util\atomic.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
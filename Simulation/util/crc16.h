@@ -0,0 +1,62 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\util\crc16.h
+//
+// summary:	Declares the simulated CRC functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * crc16.h
+ *
+ *
+ * |_______Host simulation of util/crc16.h_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 19:04:26
+ *
+ * Filename: crc16.h
+ * Host: Linux g++(the drivers are compiled as C++)
+ * Author: Mohammad Sadr
+ *
+ * Note:
+ *
+ *		The C equivalents given in the avr-libc manual for its assembler versions, same results.
+ *
+ */
+
+#ifndef SIM_UTIL_CRC16_H_
+#define SIM_UTIL_CRC16_H_
+
+#include <stdint.h>
+
+/* CRC-CCITT, reflected polynomial 0x8408 */
+static inline uint16_t _crc_ccitt_update ( uint16_t crc , uint8_t data )
+	{
+		data ^= crc & 0xff ;
+		data ^= data << 4 ;
+		return ( ( ( ( uint16_t ) data << 8 ) | ( crc >> 8 ) ) ^ ( uint8_t ) ( data >> 4 ) ^ ( ( uint16_t ) data << 3 ) ) ;
+	}
+
+/* CRC-XMODEM, polynomial 0x1021 */
+static inline uint16_t _crc_xmodem_update ( uint16_t crc , uint8_t data )
+	{
+		unsigned char i ;
+
+		crc = crc ^ ( ( uint16_t ) data << 8 ) ;
+		for ( i = 0 ; i < 8 ; i++ )
+			{
+				if ( crc & 0x8000 )
+					crc = ( crc << 1 ) ^ 0x1021 ;
+				else
+					crc <<= 1 ;
+			}
+		return crc ;
+	}
+
+#endif /* SIM_UTIL_CRC16_H_ */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\util\crc16.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
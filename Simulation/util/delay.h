@@ -0,0 +1,53 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\util\delay.h
+//
+// summary:	Declares the simulated delay functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * delay.h
+ *
+ *
+ * |_______Host simulation of util/delay.h_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 16:02:18
+ *
+ * Filename: delay.h
+ * Host: Linux g++(the drivers are compiled as C++)
+ * Author: Mohammad Sadr
+ *
+ * Note:
+ *
+ *		The delays let the simulated time run, so the peripheral models progress meanwhile.
+ *		F_CPU is taken from Configuration.h like on the target.
+ *
+ */
+
+#ifndef SIM_UTIL_DELAY_H_
+#define SIM_UTIL_DELAY_H_
+
+#include <avr/io.h>
+
+#ifndef F_CPU
+	#error "F_CPU is not defined, include Configuration.h first"
+#endif
+
+static inline void _delay_us ( double us )
+	{
+		Sim_Advance ( ( unsigned long ) ( us * ( F_CPU / 1000000.0 ) ) ) ;
+	}
+
+static inline void _delay_ms ( double ms )
+	{
+		Sim_Advance ( ( unsigned long ) ( ms * ( F_CPU / 1000.0 ) ) ) ;
+	}
+
+#endif /* SIM_UTIL_DELAY_H_ */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Simulation\util\delay.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
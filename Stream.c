@@ -0,0 +1,202 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Stream.c
+//
+// summary:	Stream class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * Stream.c
+ *
+ *
+ * |_______AVR stdio streams on the UART and the LCD_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 20:31:54
+ *
+ * Filename: Stream.c
+ * Controller: Atmega8/16/32/128
+ * Oscillator: 1 MHz
+ * Author: Mohammad Sadr
+ * Reference:avr-libc stdio.h(FDEV_SETUP_STREAM), HD44780 dataSheet
+ *
+ * Note:
+ *
+ *		Each LCD_DataWrite() waits about 1ms, a printf() into the LCD copy costs none of it:
+ *		only the chars which changed since the last update are written, like LCD_Marquee.c does.
+ *
+ */
+
+#include <avr/io.h>
+#include <stdio.h>
+#include "Configuration.h"
+#include "LCD_4_bit.h"
+#include "UART.h"
+#include "Stream.h"
+
+/* 16x2 LCD Specification */
+#define LCDMaxLines				 2
+#define LCDMaxChars				16
+#define LineOne					0x80
+
+#define BlankSpace				' '
+#define UnknownChar				0x00		// Shown value which never matches a char of the copy
+
+FILE STREAM_Uart = FDEV_SETUP_STREAM ( STREAM_UartPut , STREAM_UartGet , _FDEV_SETUP_RW ) ;
+FILE STREAM_Lcd = FDEV_SETUP_STREAM ( STREAM_LcdPut , NULL , _FDEV_SETUP_WRITE ) ;
+
+static char Frame [ LCDMaxLines ] [ LCDMaxChars ] ;	// Written by printf()
+static char Shown [ LCDMaxLines ] [ LCDMaxChars ] ;	// Chars currently shown on the LCD
+static unsigned char Line , Column ;
+
+/*
+ *
+ * Description  :This function starts the UART rings and clears the LCD copy,
+ *		the next STREAM_LcdUpdate() writes the whole display. The UART and the LCD must be initialized.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void STREAM_Init ( )
+	{
+		UART_TxStart ( ) ;
+		UART_RxStart ( ) ;
+		STREAM_LcdPut ( '\f' , &STREAM_Lcd ) ;
+		STREAM_LcdInvalidate ( ) ;
+	}
+
+/*
+ *
+ * Description  :These functions are the put and get functions of STREAM_Uart, they can be called directly.
+ * I/P Arguments: char-->char to be sent, FILE*-->stream(not used).
+ * Return value : int-->0 for put, the received char for get.
+ *
+ */
+int STREAM_UartPut ( char ch , FILE *stream )
+	{
+		( void ) stream ;
+
+		if ( ch == '\n' )
+			UART_TxChar ( '\r' ) ;
+		UART_TxChar ( ch ) ;
+		return 0 ;
+	}
+
+int STREAM_UartGet ( FILE *stream )
+	{
+		char ch ;
+
+		( void ) stream ;
+
+		ch = UART_RxChar ( ) ;
+		if ( ch == '\r' )
+			ch = '\n' ;
+		return ( unsigned char ) ch ;
+	}
+
+/*
+ *
+ * Description  :This function is the put function of STREAM_Lcd, it stores the char in the LCD copy.
+ * I/P Arguments: char-->char or '\f' '\n' '\r', FILE*-->stream(not used).
+ * Return value : int-->0
+ *
+ */
+int STREAM_LcdPut ( char ch , FILE *stream )
+	{
+		unsigned char line , col ;
+
+		( void ) stream ;
+
+		switch ( ch )
+			{
+				case '\f' :
+					for ( line = 0 ; line < LCDMaxLines ; line++ )
+						for ( col = 0 ; col < LCDMaxChars ; col++ )
+							Frame [ line ] [ col ] = BlankSpace ;
+					Line = 0 ;
+					Column = 0 ;
+					break ;
+
+				case '\n' :
+					for ( ; Column < LCDMaxChars ; Column++ )
+						Frame [ Line ] [ Column ] = BlankSpace ;
+					Line = ( Line + 1 ) % LCDMaxLines ;
+					Column = 0 ;
+					break ;
+
+				case '\r' :
+					Column = 0 ;
+					break ;
+
+				default :
+					if ( Column < LCDMaxChars )
+						Frame [ Line ] [ Column++ ] = ch ;
+					break ;
+			}
+		return 0 ;
+	}
+
+/*
+ *
+ * Description  :This function writes the chars of the LCD copy which differ from the display.
+ *		The cursor is moved only when a char was skipped.
+ * I/P Arguments: none
+ * Return value : unsigned char-->number of chars written.
+ *
+ */
+unsigned char STREAM_LcdUpdate ( )
+	{
+		unsigned char line , col , cursor , written = 0 ;
+
+		for ( line = 0 ; line < LCDMaxLines ; line++ )
+			{
+				cursor = LCDMaxChars ;			// cursor=LCDMaxChars -> position unknown
+				for ( col = 0 ; col < LCDMaxChars ; col++ )
+					if ( Shown [ line ] [ col ] != Frame [ line ] [ col ] )
+						{
+							if ( cursor != col )
+								LCD_CmdWrite ( LineOne + ( line << 6 ) + col ) ;	// Move the Cursor to the changed char
+
+							LCD_DataWrite ( Frame [ line ] [ col ] ) ;
+							Shown [ line ] [ col ] = Frame [ line ] [ col ] ;
+							cursor = col + 1 ;	// LCD increments the address after each data write
+							written++ ;
+						}
+			}
+		return written ;
+	}
+
+/*
+ *
+ * Description  :This function calls STREAM_LcdUpdate(), for SCHED_AddPeriodic().
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void STREAM_LcdTask ( )
+	{
+		STREAM_LcdUpdate ( ) ;
+	}
+
+/*
+ *
+ * Description  :This function marks the display as unknown, call it after the LCD has been written
+ *		by other functions, so the next STREAM_LcdUpdate() writes every char again.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void STREAM_LcdInvalidate ( )
+	{
+		unsigned char line , col ;
+
+		for ( line = 0 ; line < LCDMaxLines ; line++ )
+			for ( col = 0 ; col < LCDMaxChars ; col++ )
+				Shown [ line ] [ col ] = UnknownChar ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Stream.c
+////////////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -0,0 +1,120 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Stream.h
+//
+// summary:	Declares the stream class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * Stream.h
+ *
+ *
+ * |_______AVR stdio streams on the UART and the LCD_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 20:31:54
+ *
+ * Filename: Stream.h
+ * Controller: Atmega8/16/32/128
+ * Oscillator: 1 MHz
+ * Author: Mohammad Sadr
+ * Reference:avr-libc stdio.h(FDEV_SETUP_STREAM), HD44780 dataSheet
+ *
+ * Note:
+ *
+ *		STREAM_Uart reads and writes the UART through its rings(UART_TxStart()/UART_RxStart()), so printf()
+ *		returns as soon as the text is in the transmit ring. '\n' is sent as CR LF, a received CR is read as '\n'.
+ *		STREAM_Lcd writes into a 16x2 copy of the display in SRAM and never waits:
+ *			'\f' clears the display and moves to the first char of line 1
+ *			'\n' blanks the rest of the line and moves to the first char of the other line
+ *			'\r' moves to the first char of the line
+ *			the chars after the 16th of a line are dropped
+ *		STREAM_LcdUpdate() writes the chars which differ from the display, call it from the main loop
+ *		or as a scheduler task. Works with either LCD_4_bit.c or LCD_8_bit.c.
+ *
+ *		The vfprintf() of avr-libc is chosen when linking(see PRINTF in the Makefile): the default one has
+ *		no %f, PRINTF=min also drops the field width and the flags for a smaller image, PRINTF=flt adds %f.
+ *	ex:
+ *		UART_Init ( ) ;
+ *		LCD_Init ( ) ;
+ *		STREAM_Init ( ) ;
+ *		stdout = stdin = stderr = &STREAM_Uart ;
+ *		printf_P ( PSTR ( "adc=%u\n" ) , ADC_GetSample ( 0 ) ) ;
+ *		fprintf_P ( &STREAM_Lcd , PSTR ( "\f%02x:%02x\n" ) , hour , min ) ;
+ *		SCHED_AddPeriodic ( STREAM_LcdTask , 50 , 0 ) ;
+ *
+ */
+
+#ifndef STREAM_H_
+#define STREAM_H_
+
+#include <stdio.h>
+
+extern FILE STREAM_Uart ;
+extern FILE STREAM_Lcd ;
+
+/*
+ *
+ * Description  :This function starts the UART rings and clears the LCD copy,
+ *		the next STREAM_LcdUpdate() writes the whole display. The UART and the LCD must be initialized.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void STREAM_Init ( ) ;
+
+/*
+ *
+ * Description  :These functions are the put and get functions of STREAM_Uart, they can be called directly.
+ * I/P Arguments: char-->char to be sent, FILE*-->stream(not used).
+ * Return value : int-->0 for put, the received char for get.
+ *
+ */
+int STREAM_UartPut ( char ch , FILE *stream ) ;
+int STREAM_UartGet ( FILE *stream ) ;
+
+/*
+ *
+ * Description  :This function is the put function of STREAM_Lcd, it stores the char in the LCD copy.
+ * I/P Arguments: char-->char or '\f' '\n' '\r', FILE*-->stream(not used).
+ * Return value : int-->0
+ *
+ */
+int STREAM_LcdPut ( char ch , FILE *stream ) ;
+
+/*
+ *
+ * Description  :This function writes the chars of the LCD copy which differ from the display.
+ *		The cursor is moved only when a char was skipped.
+ * I/P Arguments: none
+ * Return value : unsigned char-->number of chars written.
+ *
+ */
+unsigned char STREAM_LcdUpdate ( ) ;
+
+/*
+ *
+ * Description  :This function calls STREAM_LcdUpdate(), for SCHED_AddPeriodic().
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void STREAM_LcdTask ( ) ;
+
+/*
+ *
+ * Description  :This function marks the display as unknown, call it after the LCD has been written
+ *		by other functions, so the next STREAM_LcdUpdate() writes every char again.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void STREAM_LcdInvalidate ( ) ;
+
+#endif /* STREAM_H_ */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Stream.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -0,0 +1,163 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Telemetry.c
+//
+// summary:	Telemetry class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * Telemetry.c
+ *
+ *
+ * |_______AVR binary telemetry frames over UART_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 19:04:26
+ *
+ * Filename: Telemetry.c
+ * Controller: Atmega8/16/32/128
+ * Oscillator: 1 MHz
+ * Author: Mohammad Sadr
+ * Reference:Consistent Overhead Byte Stuffing(Cheshire and Baker), avr-libc util/crc16.h
+ *
+ * Note:
+ *
+ *		The frame is COBS encoded while it is sent: each block is found by looking ahead for the next zero
+ *		in the frame buffer, so no second buffer is needed.
+ *
+ */
+
+#include <avr/io.h>
+#include "Configuration.h"
+#include <util/crc16.h>
+#include "UART.h"
+#include "Telemetry.h"
+
+static unsigned char Frame [ 1 + TELEMETRY_MaxFields + 2 ] ;		// Sequence, fields, CRC
+static unsigned char Length ;
+static unsigned char Sequence ;
+
+/*
+ *
+ * Description  :This function starts a new frame with the next sequence number, the fields of the
+ *		previous frame are dropped.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void TELEMETRY_Begin ( )
+	{
+		Frame [ 0 ] = Sequence++ ;
+		Length = 1 ;
+	}
+
+/* Adds the field byte and the lower bytes of value, returns 0 if they do not fit */
+static unsigned char TELEMETRY_Add ( unsigned char type , unsigned char id , unsigned long value , unsigned char bytes )
+	{
+		if ( Length == 0 || Length + 1 + bytes > 1 + TELEMETRY_MaxFields )
+			return 0 ;
+		Frame [ Length++ ] = ( type << 4 ) | ( id & 0x0f ) ;
+		while ( bytes-- )
+			{
+				Frame [ Length++ ] = ( unsigned char ) value ;
+				value >>= 8 ;
+			}
+		return 1 ;
+	}
+
+/*
+ *
+ * Description  :These functions add one field to the frame.
+ * I/P Arguments: unsigned char-->channel or id(0-15), value of the field.
+ * Return value : unsigned char-->1 if added, 0 if the frame is full.
+ *
+ */
+unsigned char TELEMETRY_AddAdc ( unsigned char channel , unsigned int value )
+	{
+		return TELEMETRY_Add ( TELEMETRY_Adc , channel , value , 2 ) ;
+	}
+
+unsigned char TELEMETRY_AddRtc ( unsigned char hh , unsigned char mm , unsigned char ss , unsigned char dd , unsigned char mo , unsigned char yy )
+	{
+		if ( Length == 0 || Length + 7 > 1 + TELEMETRY_MaxFields )
+			return 0 ;
+		Frame [ Length++ ] = TELEMETRY_Rtc << 4 ;
+		Frame [ Length++ ] = hh ;
+		Frame [ Length++ ] = mm ;
+		Frame [ Length++ ] = ss ;
+		Frame [ Length++ ] = dd ;
+		Frame [ Length++ ] = mo ;
+		Frame [ Length++ ] = yy ;
+		return 1 ;
+	}
+
+unsigned char TELEMETRY_AddCounter ( unsigned char id , unsigned long value )
+	{
+		return TELEMETRY_Add ( TELEMETRY_Counter , id , value , 4 ) ;
+	}
+
+unsigned char TELEMETRY_AddValue ( unsigned char id , int value )
+	{
+		return TELEMETRY_Add ( TELEMETRY_Value , id , ( unsigned int ) value , 2 ) ;
+	}
+
+/*
+ *
+ * Description  :This function returns the CRC-16 of the frames over a buffer.
+ * I/P Arguments: const unsigned char*-->data, unsigned char-->number of bytes.
+ * Return value : unsigned int-->CRC.
+ *
+ */
+unsigned int TELEMETRY_Crc16 ( const unsigned char *data , unsigned char length )
+	{
+		unsigned int crc = 0xffff ;
+
+		while ( length-- )
+			crc = _crc_ccitt_update ( crc , *data++ ) ;
+		return crc ;
+	}
+
+/*
+ *
+ * Description  :This function adds the CRC and transmits the frame COBS encoded, followed by the zero byte.
+ *		It waits in UART_TxChar() like the other UART output, the UART must be initialized.
+ * I/P Arguments: none
+ * Return value : unsigned char-->number of bytes sent on the wire.
+ *
+ */
+unsigned char TELEMETRY_Send ( )
+	{
+		unsigned int crc ;
+		unsigned char start = 0 , end , sent = 0 ;
+
+		if ( Length == 0 )
+			TELEMETRY_Begin ( ) ;
+		crc = TELEMETRY_Crc16 ( Frame , Length ) ;
+		Frame [ Length++ ] = crc ;
+		Frame [ Length++ ] = crc >> 8 ;
+
+		/* Each block is a code byte(distance to the next zero) and the bytes before that zero */
+		while ( 1 )
+			{
+				end = start ;
+				while ( end < Length && Frame [ end ] != 0 )
+					end++ ;
+				UART_TxChar ( end - start + 1 ) ;
+				sent += end - start + 1 ;
+				while ( start < end )
+					UART_TxChar ( Frame [ start++ ] ) ;
+				if ( end >= Length )
+					break ;
+				start = end + 1 ;				// The zero itself is not sent
+			}
+		UART_TxChar ( 0 ) ;
+
+		Length = 0 ;							// TELEMETRY_Begin() is needed for the next frame
+		return sent + 1 ;
+	}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Telemetry.c
+////////////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
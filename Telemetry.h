@@ -0,0 +1,104 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Telemetry.h
+//
+// summary:	Declares the telemetry class
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * Telemetry.h
+ *
+ *
+ * |_______AVR binary telemetry frames over UART_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 19:04:26
+ *
+ * Filename: Telemetry.h
+ * Controller: Atmega8/16/32/128
+ * Oscillator: 1 MHz
+ * Author: Mohammad Sadr
+ * Reference:Consistent Overhead Byte Stuffing(Cheshire and Baker), avr-libc util/crc16.h
+ *
+ * Note:
+ *
+ *		A frame is a sequence number, the fields and a CRC-16, COBS encoded and ended by a zero byte,
+ *		so a receiver finds the start of the next frame after noise or a lost byte.
+ *		Before COBS(all values little endian):
+ *			sequence(1 byte) , field , field ... , crc(2 bytes)
+ *		The CRC is _crc_ccitt_update() of avr-libc over the sequence and the fields, start value 0xffff
+ *		(CRC-16/MCRF4XX, "123456789" gives 0x6f91).
+ *		Each field starts with one byte: the type in the high nibble and an id(0-15) in the low nibble.
+ *			TELEMETRY_Adc     -> id = channel , 2 bytes result
+ *			TELEMETRY_Rtc     -> id = 0 , 6 bytes hh mm ss dd mm yy as read from the DS1307(BCD)
+ *			TELEMETRY_Counter -> id = counter , 4 bytes unsigned
+ *			TELEMETRY_Value   -> id = value , 2 bytes signed
+ *		COBS adds one byte, so an ADC sample costs 3 bytes on the wire and a frame 5 bytes more,
+ *		where UART_TxNumber() sends 5 digits and a separator for each one.
+ *		Tools/TelemetryDecode.py decodes the frames on the PC.
+ *	ex:
+ *		TELEMETRY_Begin ( ) ;
+ *		TELEMETRY_AddAdc ( 0 , ADC_GetSample ( 0 ) ) ;
+ *		TELEMETRY_AddCounter ( 0 , SCHED_Counts ( ) ) ;
+ *		TELEMETRY_Send ( ) ;
+ *
+ */
+
+#ifndef TELEMETRY_H_
+#define TELEMETRY_H_
+
+#define TELEMETRY_MaxFields		32			// Bytes of fields in one frame, the COBS blocks stay below 254 bytes
+
+#define TELEMETRY_Adc			1
+#define TELEMETRY_Rtc			2
+#define TELEMETRY_Counter		3
+#define TELEMETRY_Value			4
+
+/*
+ *
+ * Description  :This function starts a new frame with the next sequence number, the fields of the
+ *		previous frame are dropped.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void TELEMETRY_Begin ( ) ;
+
+/*
+ *
+ * Description  :These functions add one field to the frame.
+ * I/P Arguments: unsigned char-->channel or id(0-15), value of the field.
+ * Return value : unsigned char-->1 if added, 0 if the frame is full.
+ *
+ */
+unsigned char TELEMETRY_AddAdc ( unsigned char channel , unsigned int value ) ;
+unsigned char TELEMETRY_AddRtc ( unsigned char hh , unsigned char mm , unsigned char ss , unsigned char dd , unsigned char mo , unsigned char yy ) ;
+unsigned char TELEMETRY_AddCounter ( unsigned char id , unsigned long value ) ;
+unsigned char TELEMETRY_AddValue ( unsigned char id , int value ) ;
+
+/*
+ *
+ * Description  :This function adds the CRC and transmits the frame COBS encoded, followed by the zero byte.
+ *		It waits in UART_TxChar() like the other UART output, the UART must be initialized.
+ * I/P Arguments: none
+ * Return value : unsigned char-->number of bytes sent on the wire.
+ *
+ */
+unsigned char TELEMETRY_Send ( ) ;
+
+/*
+ *
+ * Description  :This function returns the CRC-16 of the frames over a buffer.
+ * I/P Arguments: const unsigned char*-->data, unsigned char-->number of bytes.
+ * Return value : unsigned int-->CRC.
+ *
+ */
+unsigned int TELEMETRY_Crc16 ( const unsigned char *data , unsigned char length ) ;
+
+#endif /* TELEMETRY_H_ */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Telemetry.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -0,0 +1,126 @@
+#!/usr/bin/env python3
+####################################################################################################
+# file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Tools\TelemetryDecode.py
+#
+# summary:	PC decoder of the Telemetry.c frames(see Telemetry.h)
+#
+#	python3 TelemetryDecode.py capture.bin          -> decodes a file saved from the serial port
+#	python3 TelemetryDecode.py -                    -> decodes stdin
+#	python3 TelemetryDecode.py --port /dev/ttyUSB0  -> reads the serial port(pyserial), 9600 baud
+#
+# One JSON object is printed per frame. Frames with a bad CRC or a bad field are counted and skipped,
+# the next zero byte starts the next frame.
+####################################################################################################
+
+import argparse
+import json
+import sys
+
+ADC, RTC, COUNTER, VALUE = 1, 2, 3, 4
+
+
+def crc16(data):
+    """_crc_ccitt_update() of avr-libc from 0xffff(CRC-16/MCRF4XX)"""
+    crc = 0xffff
+    for byte in data:
+        byte ^= crc & 0xff
+        byte = (byte ^ (byte << 4)) & 0xff
+        crc = ((byte << 8) | (crc >> 8)) ^ (byte >> 4) ^ (byte << 3)
+        crc &= 0xffff
+    return crc
+
+
+def cobs_decode(block):
+    out = bytearray()
+    i = 0
+    while i < len(block):
+        code = block[i]
+        if code == 0 or i + code > len(block):
+            raise ValueError("bad COBS code")
+        out += block[i + 1:i + code]
+        i += code
+        if code < 0xff and i < len(block):
+            out.append(0)
+    return bytes(out)
+
+
+def bcd(value):
+    return "%02x" % value
+
+
+def decode_fields(data):
+    fields = []
+    i = 0
+    while i < len(data):
+        kind, ident = data[i] >> 4, data[i] & 0x0f
+        i += 1
+        if kind == ADC:
+            fields.append({"adc": ident, "value": int.from_bytes(data[i:i + 2], "little")})
+            i += 2
+        elif kind == RTC:
+            t = data[i:i + 6]
+            fields.append({"rtc": "20%s-%s-%s %s:%s:%s" % (bcd(t[5]), bcd(t[4]), bcd(t[3]), bcd(t[0]), bcd(t[1]), bcd(t[2]))})
+            i += 6
+        elif kind == COUNTER:
+            fields.append({"counter": ident, "value": int.from_bytes(data[i:i + 4], "little")})
+            i += 4
+        elif kind == VALUE:
+            fields.append({"value_id": ident, "value": int.from_bytes(data[i:i + 2], "little", signed=True)})
+            i += 2
+        else:
+            raise ValueError("unknown field type %d" % kind)
+        if i > len(data):
+            raise ValueError("short field")
+    return fields
+
+
+def decode_frame(block):
+    """COBS block without its zero byte -> dict, ValueError if it is not a good frame"""
+    frame = cobs_decode(block)
+    if len(frame) < 3:
+        raise ValueError("short frame")
+    if crc16(frame[:-2]) != int.from_bytes(frame[-2:], "little"):
+        raise ValueError("bad CRC")
+    return {"seq": frame[0], "fields": decode_fields(frame[1:-2])}
+
+
+def decode_stream(chunks, out=sys.stdout):
+    block = bytearray()
+    errors = 0
+    for chunk in chunks:
+        for byte in chunk:
+            if byte != 0:
+                block.append(byte)
+                continue
+            if block:
+                try:
+                    print(json.dumps(decode_frame(bytes(block))), file=out, flush=True)
+                except ValueError as error:
+                    errors += 1
+                    print(json.dumps({"error": str(error)}), file=sys.stderr)
+            block = bytearray()
+    return errors
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decodes the Telemetry.c frames")
+    parser.add_argument("file", nargs="?", default="-", help="capture file, - for stdin")
+    parser.add_argument("--port", help="serial port")
+    parser.add_argument("--baud", type=int, default=9600)
+    args = parser.parse_args()
+
+    if args.port:
+        import serial
+        port = serial.Serial(args.port, args.baud)
+        chunks = iter(lambda: port.read(port.in_waiting or 1), b"")
+    elif args.file == "-":
+        chunks = iter(lambda: sys.stdin.buffer.read1(256), b"")
+    else:
+        data = open(args.file, "rb").read()
+        chunks = [data]
+    errors = decode_stream(chunks)
+    return 1 if errors else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,94 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// file:	C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Trace.h
+//
+// summary:	Declares the trace pin macros
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *
+ * Trace.h
+ *
+ *
+ * |_______AVR trace pins for a scope or logic analyzer_______|
+ *
+ *
+ *
+ *
+ * Created: 2026-10-19 18:31:47
+ *
+ * Filename: Trace.h
+ * Controller: Atmega8/16/32/128
+ * Oscillator: 1 MHz
+ * Author: Mohammad Sadr
+ * Reference:Atmega32 dataSheet
+ *
+ * Note:
+ *
+ *		When TRACE_ENABLE is defined(Configuration.h or -D) a pin is high while its driver routine runs:
+ *			TRACE_PinI2cWrite -> I2C_Write()
+ *			TRACE_PinLcdWrite -> LCD_DataWrite() of both LCD drivers
+ *			TRACE_PinAdc      -> from the start of a conversion till its result is read,
+ *			                     by ADC_StartConversion() or by the background sampling task
+ *		Without it every TRACE_ macro is empty.
+ *
+ *		The trace port is in the I/O space and the pins are constants, so TRACE_On()/TRACE_Off()
+ *		are compiled to one sbi/cbi instruction(2 cycles), which can not be broken by an interrupt.
+ *		The default pins PD2-PD4 are not used by the drivers on the Atmega8/16/32, except PD2/PD3(INT0/INT1)
+ *		by the key wake-up of Keypad.c(KEYPAD_WAKE_ENABLE). On the Atmega128/1284 they are RXD1, TXD1 and
+ *		the DE of UART port 1(UART_De1Pin). In both cases the build stops till they are moved by defining
+ *		TRACE_PORT and TRACE_DDR, or the pins before this file is included(ex: in Configuration.h).
+ *		On the host, Simulation/SimVcd.cpp records the same pins into a VCD file.
+ *	ex:
+ *		TRACE_Init ( ) ;
+ *		TRACE_On ( TRACE_PinI2cWrite ) ;
+ *		...
+ *		TRACE_Off ( TRACE_PinI2cWrite ) ;
+ *
+ */
+
+#ifndef TRACE_H_
+#define TRACE_H_
+
+#include <avr/io.h>
+#include "Configuration.h"
+
+#ifndef TRACE_PORT
+	#define TRACE_PORT				PORTD
+	#define TRACE_DDR				DDRD
+	#define TRACE_PortD						// The default port, checked against the pins of the drivers below
+#endif
+
+#ifndef TRACE_PinI2cWrite
+	#define TRACE_PinI2cWrite		PD2
+	#define TRACE_PinLcdWrite		PD3
+	#define TRACE_PinAdc			PD4
+	#if defined ( TRACE_ENABLE ) && defined ( TRACE_PortD ) && defined ( KEYPAD_WAKE_ENABLE ) && KEYPAD_WakeInt != 2
+		#error "PD2/PD3 are the INT0/INT1 key wake-up of Keypad.c, define TRACE_PORT, TRACE_DDR and the pins"
+	#endif
+	#if defined ( TRACE_ENABLE ) && defined ( TRACE_PortD ) && defined ( UDR1 )
+		#error "PD2-PD4 are RXD1, TXD1 and the DE of UART port 1, define TRACE_PORT, TRACE_DDR and the pins"
+	#endif
+#endif
+
+#define TRACE_Pins					( ( 1 << TRACE_PinI2cWrite ) | ( 1 << TRACE_PinLcdWrite ) | ( 1 << TRACE_PinAdc ) )
+
+#ifdef TRACE_ENABLE
+
+/* Trace pins as outputs, low */
+#define TRACE_Init( )				do { TRACE_PORT &= ~ TRACE_Pins ; TRACE_DDR |= TRACE_Pins ; } while ( 0 )
+#define TRACE_On( pin )				( TRACE_PORT |= ( 1 << ( pin ) ) )
+#define TRACE_Off( pin )			( TRACE_PORT &= ~ ( 1 << ( pin ) ) )
+
+#else
+
+#define TRACE_Init( )
+#define TRACE_On( pin )
+#define TRACE_Off( pin )
+
+#endif /* TRACE_ENABLE */
+
+#endif /* TRACE_H_ */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\Trace.h
+////////////////////////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -9,7 +9,7 @@
  * UART.c
  *
  *
- * |_______AVR UART library for Serial Communication for 9600 baud rate at 1Mhz_______|
+ * |_______AVR UART library for Serial Communication for 9600 baud rate at 8Mhz_______|
  *
  *
  *
@@ -23,9 +23,324 @@
  * website: www.xplorelabz.com
  * Reference:Atmega32 dataSheet
  *
+ * Note:
+ *
+ *		RS-485(UART_Rs485Start()): 9-bit frames, the ninth bit(TXB8/RXB8) marks an address frame.
+ *		With MPCM set the receiver drops the data frames in hardware, so a node gets one interrupt for each
+ *		address frame on the bus and the data frames only while it is addressed.
+ *		MPCM and TXC share UCSRA and TXC is cleared by writing one, so UCSRA is written without a
+ *		read-modify-write of TXC.
+ *
+ *		Ports: each function is written once as a Port...() body with the port number n, and each register
+ *		of the body is picked by n(Udr(n), Ucsra(n), ...). The bodies are always inlined and called with n as
+ *		a constant: by the ISRs, by the UART_...() functions(port 0) and by PortCall() in the UART_Port...()
+ *		functions, so every register access is a direct one(lds/sts) as with a single USART.
+ *		The state of each port(rings, RS-485 node) is its entry of Ports[].
+ *
  */
 
- #include <avr/io.h>
+#include <avr/io.h>
+#include "Configuration.h"
+#include <avr/interrupt.h>
+#include <avr/pgmspace.h>
+#include <util/atomic.h>
+#include "UART.h"
+#include "Format.h"
+#include "Profile.h"
+
+#define RxMask			( UART_RxBufferSize - 1 )
+#define TxMask			( UART_TxBufferSize - 1 )
+
+/* Register block of port n, n is a constant where they are used */
+#if UART_Ports == 2
+#define Udr( n )		( * ( ( n ) ? &UDR1 : &UDR0 ) )
+#define Ucsra( n )		( * ( ( n ) ? &UCSR1A : &UCSR0A ) )
+#define Ucsrb( n )		( * ( ( n ) ? &UCSR1B : &UCSR0B ) )
+#define Ucsrc( n )		( * ( ( n ) ? &UCSR1C : &UCSR0C ) )
+#define Ubrrh( n )		( * ( ( n ) ? &UBRR1H : &UBRR0H ) )
+#define Ubrrl( n )		( * ( ( n ) ? &UBRR1L : &UBRR0L ) )
+#define DePort( n )		( * ( ( n ) ? &UART_De1Port : &UART_DePort ) )
+#define DeDdr( n )		( * ( ( n ) ? &UART_De1Ddr : &UART_DeDdr ) )
+#define DePin( n )		( ( n ) ? UART_De1Pin : UART_DePin )
+#define PortCall( port , body , ... )		( ( port ) ? body ( 1 , ##__VA_ARGS__ ) : body ( 0 , ##__VA_ARGS__ ) )
+#else
+#define Udr( n )		UDR
+#define Ucsra( n )		UCSRA
+#define Ucsrb( n )		UCSRB
+#define Ucsrc( n )		UCSRC
+#define Ubrrh( n )		UBRRH
+#define Ubrrl( n )		UBRRL
+#define DePort( n )		UART_DePort
+#define DeDdr( n )		UART_DeDdr
+#define DePin( n )		UART_DePin
+#define PortCall( port , body , ... )		body ( 0 , ##__VA_ARGS__ )
+#endif
+
+/* Bit names of the parts with numbered USARTs(ex: Atmega1284), the positions are the same */
+#ifndef RXC
+#define RXC				RXC0
+#define TXC				TXC0
+#define UDRE			UDRE0
+#define DOR				DOR0
+#define U2X				U2X0
+#define MPCM			MPCM0
+#define RXCIE			RXCIE0
+#define TXCIE			TXCIE0
+#define UDRIE			UDRIE0
+#define RXEN			RXEN0
+#define TXEN			TXEN0
+#define UCSZ2			UCSZ02
+#define RXB8			RXB80
+#define TXB8			TXB80
+#define UCSZ1			UCSZ01
+#define UCSZ0			UCSZ00
+#endif
+
+/* UCSRC shares its address with UBRRH on the Atmega8/16/32, URSEL selects it */
+#ifdef URSEL
+#define UcsrcSelect		( 1 << URSEL )
+#else
+#define UcsrcSelect		0
+#endif
+
+#define PortInline		static inline __attribute__ ( ( always_inline ) )
+
+typedef struct
+	{
+		volatile char rx_buffer [ UART_RxBufferSize ] ;
+		volatile unsigned char rx_head ;		// Next free place, written by the interrupt only
+		volatile unsigned char rx_tail ;		// Oldest char, written by the main loop only
+		volatile unsigned int rx_lost ;
+		unsigned char rx_buffered ;				// UART_RxStart() was called
+		volatile char tx_buffer [ UART_TxBufferSize ] ;
+		volatile unsigned char tx_head ;		// Next free place, written by the main loop only
+		volatile unsigned char tx_tail ;		// Oldest char, written by the interrupt only
+		unsigned char tx_buffered ;				// UART_TxStart() was called
+		unsigned char rs485 ;					// UART_Rs485Start() was called
+		unsigned char rs485_node ;
+	} UartPort ;
+
+static UartPort Ports [ UART_Ports ] ;
+
+PortInline void PortInit ( unsigned char n , unsigned int ubrr )
+	{
+		Ucsrb ( n ) = ( 1 << RXEN ) | ( 1 << TXEN ) ;					// Enable Receiver and Transmitter
+		Ucsrc ( n ) = UcsrcSelect | ( 1 << UCSZ1 ) | ( 1 << UCSZ0 ) ;	// Asynchronous mode 8-bit data and 1-stop bit
+		Ucsra ( n ) = ( ubrr & UART_U2x ) ? ( 1 << U2X ) : 0x00 ;	// Double speed with UART_UbrrU2x(), Single processor commn
+		Ubrrh ( n ) = ( ubrr >> 8 ) & 0x0f ;
+		Ubrrl ( n ) = ubrr ;
+		Ports [ n ].rx_buffered = 0 ;	// RXCIE is cleared, UART_RxStart() starts the ring again
+		Ports [ n ].tx_buffered = 0 ;	// UDRIE is cleared, UART_TxStart() starts the ring again
+		Ports [ n ].rs485 = 0 ;			// 8-bit frames, MPCM and TXCIE are cleared
+	}
+
+PortInline unsigned char PortRxGet ( unsigned char n , char *ch )
+	{
+		UartPort *port = &Ports [ n ] ;
+		unsigned char tail = port->rx_tail ;
+
+		if ( tail == port->rx_head )
+			return 0 ;
+		*ch = port->rx_buffer [ tail ] ;
+		port->rx_tail = ( tail + 1 ) & RxMask ;		// One byte store, the interrupt sees the place free after the read
+		return 1 ;
+	}
+
+PortInline char PortRxChar ( unsigned char n )
+	{
+		char ch ;
+		PROFILE_Begin ( ) ;
+
+		if ( Ports [ n ].rx_buffered )
+			while ( ! PortRxGet ( n , &ch ) ) ;		// The interrupt reads UDR
+		else
+			{
+				while ( ( Ucsra ( n ) & ( 1 << RXC ) ) == 0 ) ;   // Wait till the data is received
+				ch = Udr ( n ) ;
+			}
+		PROFILE_End ( PROFILE_UartRx ) ;
+		return ( ch ) ;                    // return the received char
+	}
+
+/* Sends the oldest char of the transmit ring, UDRIE is cleared once the ring is empty */
+PortInline void PortTxNext ( unsigned char n )
+	{
+		UartPort *port = &Ports [ n ] ;
+		unsigned char tail = port->tx_tail ;
+
+		if ( tail == port->tx_head )			// Ring empty, nothing to send(a stale UDRE interrupt)
+			{
+				Ucsrb ( n ) &= ~ ( 1 << UDRIE ) ;
+				return ;
+			}
+		Udr ( n ) = port->tx_buffer [ tail ] ;
+		tail = ( tail + 1 ) & TxMask ;
+		port->tx_tail = tail ;
+		if ( tail == port->tx_head )
+			Ucsrb ( n ) &= ~ ( 1 << UDRIE ) ;
+	}
+
+PortInline void PortTxChar ( unsigned char n , char ch )
+	{
+		UartPort *port = &Ports [ n ] ;
+		unsigned char next ;
+		PROFILE_Begin ( ) ;
+
+		if ( port->tx_buffered )
+			{
+				next = ( port->tx_head + 1 ) & TxMask ;
+				while ( next == port->tx_tail )		// Ring full, wait for the interrupt to send a char
+					if ( ( SREG & ( 1 << SREG_I ) ) == 0 && ( Ucsra ( n ) & ( 1 << UDRE ) ) )
+						PortTxNext ( n ) ;			// Called with the interrupts disabled, send it here
+				port->tx_buffer [ port->tx_head ] = ch ;
+				ATOMIC_BLOCK ( ATOMIC_RESTORESTATE )
+					{
+						port->tx_head = next ;			// With UDRIE, an interrupt between them could empty the ring and clear UDRIE
+						Ucsrb ( n ) |= ( 1 << UDRIE ) ;
+					}
+			}
+		else
+			{
+				while ( ( Ucsra ( n ) & ( 1 << UDRE ) ) == 0 ) ; // Wait till Transmitter(UDR) register becomes Empty
+				Udr ( n ) = ch ;             // Load the data to be transmitted
+			}
+		PROFILE_End ( PROFILE_UartTx ) ;
+	}
+
+/* Stores the received char, UCSRA and RXB8 are read before UDR as the data sheet asks */
+PortInline void PortRxInterrupt ( unsigned char n )
+	{
+		UartPort *port = &Ports [ n ] ;
+		unsigned char status = Ucsra ( n ) ;
+		unsigned char address = Ucsrb ( n ) & ( 1 << RXB8 ) ;
+		char ch = Udr ( n ) ;
+		unsigned char next = ( port->rx_head + 1 ) & RxMask ;
+
+		if ( port->rs485 && address )
+			{
+				if ( ( unsigned char ) ch == port->rs485_node || ( unsigned char ) ch == UART_Rs485Broadcast )
+					Ucsra ( n ) = status & ( 1 << U2X ) ;							// Receive the data frames
+				else
+					Ucsra ( n ) = ( status & ( 1 << U2X ) ) | ( 1 << MPCM ) ;	// Not for this node, drop them
+				return ;
+			}
+		if ( status & ( 1 << DOR ) )
+			port->rx_lost++ ;
+		if ( next == port->rx_tail )
+			{
+				port->rx_lost++ ;					// Ring full, the new char is dropped
+				return ;
+			}
+		port->rx_buffer [ port->rx_head ] = ch ;
+		port->rx_head = next ;
+	}
+
+PortInline void PortRxStart ( unsigned char n )
+	{
+		ATOMIC_BLOCK ( ATOMIC_RESTORESTATE )
+			{
+				Ports [ n ].rx_head = 0 ;
+				Ports [ n ].rx_tail = 0 ;
+				Ports [ n ].rx_lost = 0 ;
+				Ports [ n ].rx_buffered = 1 ;
+				Ucsrb ( n ) |= ( 1 << RXCIE ) ;
+			}
+		sei ( ) ;
+	}
+
+PortInline unsigned char PortRxAvailable ( unsigned char n )
+	{
+		return ( Ports [ n ].rx_head - Ports [ n ].rx_tail ) & RxMask ;
+	}
+
+PortInline unsigned int PortRxLost ( unsigned char n )
+	{
+		unsigned int lost ;
+
+		ATOMIC_BLOCK ( ATOMIC_RESTORESTATE )
+			{
+				lost = Ports [ n ].rx_lost ;
+			}
+		return lost ;
+	}
+
+PortInline void PortTxStart ( unsigned char n )
+	{
+		ATOMIC_BLOCK ( ATOMIC_RESTORESTATE )
+			{
+				Ports [ n ].tx_head = 0 ;
+				Ports [ n ].tx_tail = 0 ;
+				Ports [ n ].tx_buffered = 1 ;
+			}
+		sei ( ) ;
+	}
+
+PortInline unsigned char PortTxPending ( unsigned char n )
+	{
+		return ( Ports [ n ].tx_head - Ports [ n ].tx_tail ) & TxMask ;
+	}
+
+PortInline void PortTxFlush ( unsigned char n )
+	{
+		while ( Ucsrb ( n ) & ( 1 << UDRIE ) )
+			if ( ( SREG & ( 1 << SREG_I ) ) == 0 && ( Ucsra ( n ) & ( 1 << UDRE ) ) )
+				PortTxNext ( n ) ;
+		while ( ( Ucsra ( n ) & ( 1 << UDRE ) ) == 0 ) ;		// The last char has moved to the shift register
+	}
+
+PortInline void PortRs485Start ( unsigned char n , unsigned char node )
+	{
+		DePort ( n ) &= ~ ( 1 << DePin ( n ) ) ;
+		DeDdr ( n ) |= ( 1 << DePin ( n ) ) ;
+		ATOMIC_BLOCK ( ATOMIC_RESTORESTATE )
+			{
+				Ports [ n ].rs485_node = node ;
+				Ports [ n ].rs485 = 1 ;
+				Ucsrb ( n ) |= ( 1 << UCSZ2 ) ;					// UCSZ1:0 are set by UART_Init()
+				Ucsra ( n ) = ( Ucsra ( n ) & ( 1 << U2X ) ) | ( 1 << MPCM ) ;
+			}
+		PortRxStart ( n ) ;
+	}
+
+/* Waits for UDR and writes one 9-bit frame, after the last one TXCIE releases the bus(PortTxDoneInterrupt) */
+PortInline void PortRs485Frame ( unsigned char n , unsigned char data , unsigned char address , unsigned char last )
+	{
+		while ( ( Ucsra ( n ) & ( 1 << UDRE ) ) == 0 ) ;
+		ATOMIC_BLOCK ( ATOMIC_RESTORESTATE )
+			{
+				if ( address )
+					Ucsrb ( n ) |= ( 1 << TXB8 ) ;
+				else
+					Ucsrb ( n ) &= ~ ( 1 << TXB8 ) ;
+				Udr ( n ) = data ;
+				if ( last )					// The frame before may have set TXC, the last one can not be out yet
+					{
+						Ucsra ( n ) = ( Ucsra ( n ) & ( ( 1 << U2X ) | ( 1 << MPCM ) ) ) | ( 1 << TXC ) ;
+						Ucsrb ( n ) |= ( 1 << TXCIE ) ;
+					}
+			}
+	}
+
+PortInline unsigned char PortRs485Busy ( unsigned char n )
+	{
+		return ( Ucsrb ( n ) & ( 1 << TXCIE ) ) != 0 ;
+	}
+
+PortInline void PortRs485Send ( unsigned char n , unsigned char address , const unsigned char *data , unsigned char count )
+	{
+		while ( PortRs485Busy ( n ) ) ;
+		DePort ( n ) |= ( 1 << DePin ( n ) ) ;
+		PortRs485Frame ( n , address , 1 , count == 0 ) ;
+		while ( count-- )
+			PortRs485Frame ( n , *data++ , 0 , count == 0 ) ;
+	}
+
+/* The last stop bit is out: the bus is released for the other nodes */
+PortInline void PortTxDoneInterrupt ( unsigned char n )
+	{
+		DePort ( n ) &= ~ ( 1 << DePin ( n ) ) ;
+		Ucsrb ( n ) &= ~ ( 1 << TXCIE ) ;
+	}
 
 /*
  *
@@ -36,11 +351,7 @@
  */
  void UART_Init ( )
 	 {
-		 UCSRB = 0x18 ;   // Enable Receiver and Transmitter
-		 UCSRC = 0x86 ;   // Asynchronous mode 8-bit data and 1-stop bit
-		 UCSRA = 0x00 ;   // Normal Baud rate(no doubling), Single processor commn
-		 UBRRH = 0 ;
-		 UBRRL = 71 ;     // 9600 Baud rate at 1MHz
+		 PortInit ( 0 , UART_Ubrr ( 9600 ) ) ;	// 9600 Baud rate at F_CPU
 	 }
 
 /*
@@ -55,8 +366,7 @@
  */
 char UART_RxChar ( )
 	{
-		while ( ( UCSRA & ( 1 << RXC ) ) == 0 ) ;   // Wait till the data is received
-		return ( UDR ) ;                    // return the received char
+		return PortRxChar ( 0 ) ;
 	}
 
 /*
@@ -65,14 +375,14 @@ char UART_RxChar ( )
  *		It waits till previous char is transmitted ie.till UDRE is set.
  *		UDRE will be set once a CHAR is transmitted ie UDR becomes empty.
  *		Finally the new Char to be transmitted is loaded into UDR.
+ *		After UART_TxStart() the char is stored in the transmit ring instead, it waits only if the ring is full.
  * I/P Arguments: char--> data to be transmitted
  * Return value: none
  *
  */
  void UART_TxChar ( char ch )
 	 {
-		 while ( ( UCSRA & ( 1 << UDRE ) ) == 0 ) ; // Wait till Transmitter(UDR) register becomes Empty
-		 UDR = ch ;             // Load the data to be transmitted
+		 PortTxChar ( 0 , ch ) ;
 	 }
 
 /*
@@ -91,6 +401,24 @@ void UART_TxString ( char *string_ptr )
 			UART_TxChar ( *string_ptr++ ) ;
 	}
 
+/*
+ *
+ * Description  :This function transmits an ASCII string stored in flash(PROGMEM), byte by byte with pgm_read_byte(),
+ *		so the string is not copied into SRAM at startup.
+ *	ex:
+ *		UART_TxString_P ( PSTR ( "Ready\r\n" ) ) ;
+ * I/P Arguments: const char*-->address of the string in flash.
+ * Return value : none
+ *
+ */
+void UART_TxString_P ( const char *string_ptr )
+	{
+		char ch ;
+
+		while ( ( ch = pgm_read_byte ( string_ptr++ ) ) != 0 )
+			UART_TxChar ( ch ) ;
+	}
+
 /*
  *
  * Description  :This function is used to receive a ASCII string through UART till the carriage_return/New_line.
@@ -102,6 +430,7 @@ void UART_TxString ( char *string_ptr )
  *		NOTE:
  *			* The received char is ECHOED back,if not required then comment UART_TxChar(ch) in the code.
  *			* BackSlash is not taken care.
+ *			* The line has no length limit and the call waits for it, Console.c reads a bounded line from the UART_RxStart() ring without waiting.
  *
  */
 void UART_RxString ( char *string_ptr )
@@ -134,20 +463,358 @@ void UART_RxString ( char *string_ptr )
  */
 void UART_TxNumber ( unsigned int num )
 	{
+		char buffer [ FORMAT_BufferSize ] ;
 
-		UART_TxChar ( ( num / 10000 ) + 0x30 ) ;
-		num = num % 10000 ;
+		FORMAT_Unsigned ( buffer , num , 5 , '0' ) ;	// 5-digit zero padded, no division used
+		UART_TxString ( buffer ) ;
+	}
 
-		UART_TxChar ( ( num / 1000 ) + 0x30 ) ;
-		num = num % 1000 ;
+#if UART_Ports == 2
+ISR ( USART0_RX_vect )
+#else
+ISR ( USART_RXC_vect )
+#endif
+	{
+		PortRxInterrupt ( 0 ) ;
+	}
 
-		UART_TxChar ( ( num / 100 ) + 0x30 ) ;
-		num = num % 100 ;
+/*
+ *
+ * Description  :This function starts the interrupt driven reception: the USART_RXC interrupt stores each
+ *		received char in a ring of UART_RxBufferSize bytes, so no char is lost while the main loop is busy
+ *		for up to UART_RxBufferSize frames. UART_RxChar() then waits on the ring. Global interrupts are enabled.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void UART_RxStart ( )
+	{
+		PortRxStart ( 0 ) ;
+	}
+
+/*
+ *
+ * Description  :This function returns the number of received chars waiting in the ring.
+ * I/P Arguments: none
+ * Return value : unsigned char-->number of chars.
+ *
+ */
+unsigned char UART_RxAvailable ( )
+	{
+		return PortRxAvailable ( 0 ) ;
+	}
+
+/*
+ *
+ * Description  :This function takes the oldest received char from the ring without waiting.
+ * I/P Arguments: char*-->where the char is stored.
+ * Return value : unsigned char-->1 if a char was taken, 0 if the ring is empty.
+ *
+ */
+unsigned char UART_RxGet ( char *ch )
+	{
+		return PortRxGet ( 0 , ch ) ;
+	}
+
+/*
+ *
+ * Description  :This function returns the number of received chars lost since UART_RxStart(),
+ *		because the ring was full or the UART data overrun flag was set.
+ * I/P Arguments: none
+ * Return value : unsigned int-->number of chars.
+ *
+ */
+unsigned int UART_RxLost ( )
+	{
+		return PortRxLost ( 0 ) ;
+	}
+
+#if UART_Ports == 2
+ISR ( USART0_UDRE_vect )
+#else
+ISR ( USART_UDRE_vect )
+#endif
+	{
+		PortTxNext ( 0 ) ;
+	}
 
-		UART_TxChar ( ( num / 10 ) + 0x30 ) ;
+/*
+ *
+ * Description  :This function starts the interrupt driven transmission: UART_TxChar() and the functions
+ *		which use it store the chars in a ring of UART_TxBufferSize bytes and return, the USART_UDRE interrupt
+ *		sends them. UART_TxChar() only waits when the ring is full. Global interrupts are enabled.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void UART_TxStart ( )
+	{
+		PortTxStart ( 0 ) ;
+	}
 
-		UART_TxChar ( ( num % 10 ) + 0x30 ) ;
+/*
+ *
+ * Description  :This function returns the number of chars waiting in the transmit ring.
+ * I/P Arguments: none
+ * Return value : unsigned char-->number of chars.
+ *
+ */
+unsigned char UART_TxPending ( )
+	{
+		return PortTxPending ( 0 ) ;
+	}
+
+/*
+ *
+ * Description  :This function waits till every char of the transmit ring has been written to UDR,
+ *		ex: before UART_Init() or changing the baud rate.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void UART_TxFlush ( )
+	{
+		PortTxFlush ( 0 ) ;
+	}
+
+/*
+ *
+ * Description  :This function starts the RS-485 multi-drop mode: 9-bit frames, MPCM set and the
+ *		receive ring(UART_RxStart()). The data frames after an address frame with this node(or the broadcast
+ *		address) are stored in the ring, the others are dropped by the USART. The DE pin is set as an output
+ *		and low(receive). Global interrupts are enabled.
+ * I/P Arguments: unsigned char-->node address(not UART_Rs485Broadcast).
+ * Return value : none
+ *
+ */
+void UART_Rs485Start ( unsigned char node )
+	{
+		PortRs485Start ( 0 , node ) ;
+	}
+
+/*
+ *
+ * Description  :This function sends a message: DE high, the address frame, the data frames.
+ *		It returns once the last frame is in UDR, the USART_TXC interrupt sets DE low after its stop bit.
+ *		A message still on the bus is waited for first.
+ * I/P Arguments: unsigned char-->address of the node(s), const unsigned char*-->data, unsigned char-->number of bytes.
+ * Return value : none
+ *
+ */
+void UART_Rs485Send ( unsigned char address , const unsigned char *data , unsigned char n )
+	{
+		PortRs485Send ( 0 , address , data , n ) ;
+	}
+
+/*
+ *
+ * Description  :This function tells if a message is still on the bus(DE high).
+ * I/P Arguments: none
+ * Return value : unsigned char-->1 if sending, 0 if not.
+ *
+ */
+unsigned char UART_Rs485Busy ( )
+	{
+		return PortRs485Busy ( 0 ) ;
+	}
+
+#if UART_Ports == 2
+ISR ( USART0_TX_vect )
+#else
+ISR ( USART_TXC_vect )
+#endif
+	{
+		PortTxDoneInterrupt ( 0 ) ;
+	}
+
+/*
+ *
+ * Description  :This function initializes a port like UART_Init() does: 8N1, receiver and transmitter
+ *		enabled, no ring, at the baud rate of ubrr.
+ * I/P Arguments: unsigned char-->port(UART_Port0 or UART_Port1), unsigned int-->UBRR(UART_Ubrr(baud)).
+ * Return value : none
+ *
+ */
+void UART_PortInit ( unsigned char port , unsigned int ubrr )
+	{
+		PortCall ( port , PortInit , ubrr ) ;
+	}
+
+/*
+ *
+ * Description  :This function receives a char from a port like UART_RxChar() does.
+ * I/P Arguments: unsigned char-->port.
+ * Return value : char
+ *
+ */
+char UART_PortRxChar ( unsigned char port )
+	{
+		return PortCall ( port , PortRxChar ) ;
+	}
+
+/*
+ *
+ * Description  :This function transmits a char on a port like UART_TxChar() does.
+ * I/P Arguments: unsigned char-->port, char-->data to be transmitted.
+ * Return value : none
+ *
+ */
+void UART_PortTxChar ( unsigned char port , char ch )
+	{
+		PortCall ( port , PortTxChar , ch ) ;
+	}
+
+/*
+ *
+ * Description  :This function transmits an ASCII string on a port.
+ * I/P Arguments: unsigned char-->port, const char*-->string.
+ * Return value : none
+ *
+ */
+void UART_PortTxString ( unsigned char port , const char *string_ptr )
+	{
+		while ( *string_ptr )
+			UART_PortTxChar ( port , *string_ptr++ ) ;
+	}
+
+/*
+ *
+ * Description  :This function starts the receive ring of a port like UART_RxStart() does.
+ * I/P Arguments: unsigned char-->port.
+ * Return value : none
+ *
+ */
+void UART_PortRxStart ( unsigned char port )
+	{
+		PortCall ( port , PortRxStart ) ;
+	}
+
+/*
+ *
+ * Description  :This function returns the number of received chars waiting in the ring of a port.
+ * I/P Arguments: unsigned char-->port.
+ * Return value : unsigned char-->number of chars.
+ *
+ */
+unsigned char UART_PortRxAvailable ( unsigned char port )
+	{
+		return PortCall ( port , PortRxAvailable ) ;
+	}
+
+/*
+ *
+ * Description  :This function takes the oldest received char from the ring of a port without waiting.
+ * I/P Arguments: unsigned char-->port, char*-->where the char is stored.
+ * Return value : unsigned char-->1 if a char was taken, 0 if the ring is empty.
+ *
+ */
+unsigned char UART_PortRxGet ( unsigned char port , char *ch )
+	{
+		return PortCall ( port , PortRxGet , ch ) ;
+	}
+
+/*
+ *
+ * Description  :This function returns the number of received chars lost on a port since UART_PortRxStart().
+ * I/P Arguments: unsigned char-->port.
+ * Return value : unsigned int-->number of chars.
+ *
+ */
+unsigned int UART_PortRxLost ( unsigned char port )
+	{
+		return PortCall ( port , PortRxLost ) ;
+	}
+
+/*
+ *
+ * Description  :This function starts the transmit ring of a port like UART_TxStart() does.
+ * I/P Arguments: unsigned char-->port.
+ * Return value : none
+ *
+ */
+void UART_PortTxStart ( unsigned char port )
+	{
+		PortCall ( port , PortTxStart ) ;
+	}
+
+/*
+ *
+ * Description  :This function returns the number of chars waiting in the transmit ring of a port.
+ * I/P Arguments: unsigned char-->port.
+ * Return value : unsigned char-->number of chars.
+ *
+ */
+unsigned char UART_PortTxPending ( unsigned char port )
+	{
+		return PortCall ( port , PortTxPending ) ;
+	}
+
+/*
+ *
+ * Description  :This function waits till every char of the transmit ring of a port has been written to UDR.
+ * I/P Arguments: unsigned char-->port.
+ * Return value : none
+ *
+ */
+void UART_PortTxFlush ( unsigned char port )
+	{
+		PortCall ( port , PortTxFlush ) ;
+	}
+
+/*
+ *
+ * Description  :This function starts the RS-485 multi-drop mode on a port like UART_Rs485Start() does,
+ *		with the DE pin of the port.
+ * I/P Arguments: unsigned char-->port, unsigned char-->node address.
+ * Return value : none
+ *
+ */
+void UART_PortRs485Start ( unsigned char port , unsigned char node )
+	{
+		PortCall ( port , PortRs485Start , node ) ;
+	}
+
+/*
+ *
+ * Description  :This function sends an RS-485 message on a port like UART_Rs485Send() does.
+ * I/P Arguments: unsigned char-->port, unsigned char-->address of the node(s), const unsigned char*-->data,
+ *		unsigned char-->number of bytes.
+ * Return value : none
+ *
+ */
+void UART_PortRs485Send ( unsigned char port , unsigned char address , const unsigned char *data , unsigned char n )
+	{
+		PortCall ( port , PortRs485Send , address , data , n ) ;
+	}
+
+/*
+ *
+ * Description  :This function tells if an RS-485 message is still on the bus of a port.
+ * I/P Arguments: unsigned char-->port.
+ * Return value : unsigned char-->1 if sending, 0 if not.
+ *
+ */
+unsigned char UART_PortRs485Busy ( unsigned char port )
+	{
+		return PortCall ( port , PortRs485Busy ) ;
+	}
+
+#if UART_Ports == 2
+ISR ( USART1_RX_vect )
+	{
+		PortRxInterrupt ( 1 ) ;
+	}
+
+ISR ( USART1_UDRE_vect )
+	{
+		PortTxNext ( 1 ) ;
+	}
+
+ISR ( USART1_TX_vect )
+	{
+		PortTxDoneInterrupt ( 1 ) ;
 	}
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // End of C:\Users\Mohammad\Desktop\AVRCLibrary\AVRCLibrary\UART.c
@@ -9,7 +9,7 @@
  * UART.h
  *
  *
- * |_______AVR UART library for Serial Communication for 9600 baud rate at 1Mhz_______|
+ * |_______AVR UART library for Serial Communication for 9600 baud rate at 8Mhz_______|
  *
  *
  *
@@ -23,11 +23,43 @@
  * website: www.xplorelabz.com
  * Reference:Atmega32 dataSheet
  *
+ * Note:
+ *
+ *		The Atmega128/1284 have a second USART. The UART_...() functions work on port 0, the UART_Port...()
+ *		functions on the port given(UART_Port0 or UART_Port1), each port with its own baud rate, rings and
+ *		interrupts, so a host link and a field bus(RS-485) run at the same time. The registers of a port
+ *		are resolved at compile time, see UART.c. On the Atmega8/16/32 UART_Ports is 1 and only UART_Port0 exists.
+ *	ex:
+ *		UART_PortInit ( UART_Port0 , UART_Ubrr ( 4800 ) ) ;		// Host link
+ *		UART_PortInit ( UART_Port1 , UART_Ubrr ( 2400 ) ) ;		// Field bus
+ *		UART_PortRxStart ( UART_Port0 ) ;
+ *		UART_PortTxStart ( UART_Port0 ) ;
+ *		UART_PortRs485Start ( UART_Port1 , 0x12 ) ;
+ *
  */
 
 #ifndef UART_H_
 #define UART_H_
 
+#include <avr/io.h>
+#include "Configuration.h"
+
+#if defined ( UDR1 )
+#define UART_Ports				2			// Atmega128/1284: USART0 and USART1
+#else
+#define UART_Ports				1
+#endif
+
+#define UART_Port0				0
+#define UART_Port1				1
+
+/* UBRR of a baud rate(U2X cleared), rounded to the nearest, F_CPU must be defined where it is used */
+#define UART_Ubrr( baud )		( ( F_CPU + 8UL * ( baud ) ) / ( 16UL * ( baud ) ) - 1 )
+
+/* UBRR with U2X set(UART_U2x flag for UART_PortInit()), for the high baud rates: 38400 is 0.2% off at 8 MHz */
+#define UART_U2x				0x8000
+#define UART_UbrrU2x( baud )	( UART_U2x | ( ( F_CPU + 4UL * ( baud ) ) / ( 8UL * ( baud ) ) - 1 ) )
+
 /*
  *
  * Description  :This function is used to initialize the UART at 9600 baud rate by below configuration.
@@ -55,6 +87,7 @@ char UART_RxChar ( ) ;
  *		It waits till previous char is transmitted ie.till UDRE is set.
  *		UDRE will be set once a CHAR is transmitted ie UDR becomes empty.
  *		Finally the new Char to be transmitted is loaded into UDR.
+ *		After UART_TxStart() the char is stored in the transmit ring instead, it waits only if the ring is full.
  * I/P Arguments: char--> data to be transmitted
  * Return value: none
  *
@@ -73,6 +106,18 @@ char UART_RxChar ( ) ;
  */
 void UART_TxString ( char *string_ptr ) ;
 
+/*
+ *
+ * Description  :This function transmits an ASCII string stored in flash(PROGMEM), byte by byte with pgm_read_byte(),
+ *		so the string is not copied into SRAM at startup.
+ *	ex:
+ *		UART_TxString_P ( PSTR ( "Ready\r\n" ) ) ;
+ * I/P Arguments: const char*-->address of the string in flash.
+ * Return value : none
+ *
+ */
+void UART_TxString_P ( const char *string_ptr ) ;
+
 /*
  *
  * Description  :This function is used to receive a ASCII string through UART till the carriage_return/New_line.
@@ -84,6 +129,7 @@ void UART_TxString ( char *string_ptr ) ;
  *		NOTE:
  *			* The received char is ECHOED back,if not required then comment UART_TxChar(ch) in the code.
  *			* BackSlash is not taken care.
+ *			* The line has no length limit and the call waits for it, Console.c reads a bounded line from the UART_RxStart() ring without waiting.
  *
  */
 void UART_RxString ( char *string_ptr ) ;
@@ -100,6 +146,258 @@ void UART_RxString ( char *string_ptr ) ;
  */
 void UART_TxNumber ( unsigned int num ) ;
 
+#define UART_RxBufferSize		32			// Bytes of the receive ring, a power of 2 up to 128
+
+/*
+ *
+ * Description  :This function starts the interrupt driven reception: the USART_RXC interrupt stores each
+ *		received char in a ring of UART_RxBufferSize bytes, so no char is lost while the main loop is busy
+ *		for up to UART_RxBufferSize frames. UART_RxChar() then waits on the ring. Global interrupts are enabled.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void UART_RxStart ( ) ;
+
+/*
+ *
+ * Description  :This function returns the number of received chars waiting in the ring.
+ * I/P Arguments: none
+ * Return value : unsigned char-->number of chars.
+ *
+ */
+unsigned char UART_RxAvailable ( ) ;
+
+/*
+ *
+ * Description  :This function takes the oldest received char from the ring without waiting.
+ * I/P Arguments: char*-->where the char is stored.
+ * Return value : unsigned char-->1 if a char was taken, 0 if the ring is empty.
+ *
+ */
+unsigned char UART_RxGet ( char *ch ) ;
+
+/*
+ *
+ * Description  :This function returns the number of received chars lost since UART_RxStart(),
+ *		because the ring was full or the UART data overrun flag was set.
+ * I/P Arguments: none
+ * Return value : unsigned int-->number of chars.
+ *
+ */
+unsigned int UART_RxLost ( ) ;
+
+#define UART_TxBufferSize		32			// Bytes of the transmit ring, a power of 2 up to 128
+
+/*
+ *
+ * Description  :This function starts the interrupt driven transmission: UART_TxChar() and the functions
+ *		which use it store the chars in a ring of UART_TxBufferSize bytes and return, the USART_UDRE interrupt
+ *		sends them. UART_TxChar() only waits when the ring is full. Global interrupts are enabled.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void UART_TxStart ( ) ;
+
+/*
+ *
+ * Description  :This function returns the number of chars waiting in the transmit ring.
+ * I/P Arguments: none
+ * Return value : unsigned char-->number of chars.
+ *
+ */
+unsigned char UART_TxPending ( ) ;
+
+/*
+ *
+ * Description  :This function waits till every char of the transmit ring has been written to UDR,
+ *		ex: before UART_Init() or changing the baud rate.
+ * I/P Arguments: none
+ * Return value : none
+ *
+ */
+void UART_TxFlush ( ) ;
+
+#ifndef UART_DePort
+#define UART_DePort				PORTB		// RS-485 driver enable(DE and /RE tied), LCD_4_bit.c leaves PB3 alone
+#define UART_DeDdr				DDRB
+#define UART_DePin				PB3
+#endif
+
+#ifndef UART_De1Port
+#define UART_De1Port			PORTD		// DE of port 1, next to TXD1(PD3)
+#define UART_De1Ddr				DDRD
+#define UART_De1Pin				PD4
+#endif
+
+#define UART_Rs485Broadcast		0x00		// Address frame received by every node
+
+/*
+ *
+ * Description  :This function starts the RS-485 multi-drop mode: 9-bit frames, MPCM set and the
+ *		receive ring(UART_RxStart()). The data frames after an address frame with this node(or the broadcast
+ *		address) are stored in the ring, the others are dropped by the USART. The DE pin is set as an output
+ *		and low(receive). Global interrupts are enabled.
+ *	ex:
+ *		UART_Init ( ) ;
+ *		UART_Rs485Start ( 0x12 ) ;
+ *		UART_Rs485Send ( 0x01 , reply , 4 ) ;		// To the master node
+ * I/P Arguments: unsigned char-->node address(not UART_Rs485Broadcast).
+ * Return value : none
+ *
+ */
+void UART_Rs485Start ( unsigned char node ) ;
+
+/*
+ *
+ * Description  :This function sends a message: DE high, the address frame, the data frames.
+ *		It returns once the last frame is in UDR, the USART_TXC interrupt sets DE low after its stop bit.
+ *		A message still on the bus is waited for first.
+ * I/P Arguments: unsigned char-->address of the node(s), const unsigned char*-->data, unsigned char-->number of bytes.
+ * Return value : none
+ *
+ */
+void UART_Rs485Send ( unsigned char address , const unsigned char *data , unsigned char n ) ;
+
+/*
+ *
+ * Description  :This function tells if a message is still on the bus(DE high).
+ * I/P Arguments: none
+ * Return value : unsigned char-->1 if sending, 0 if not.
+ *
+ */
+unsigned char UART_Rs485Busy ( ) ;
+
+/*
+ *
+ * Description  :This function initializes a port like UART_Init() does: 8N1, receiver and transmitter
+ *		enabled, no ring, at the baud rate of ubrr.
+ * I/P Arguments: unsigned char-->port(UART_Port0 or UART_Port1), unsigned int-->UBRR(UART_Ubrr(baud) or UART_UbrrU2x(baud)).
+ * Return value : none
+ *
+ */
+void UART_PortInit ( unsigned char port , unsigned int ubrr ) ;
+
+/*
+ *
+ * Description  :This function receives a char from a port like UART_RxChar() does.
+ * I/P Arguments: unsigned char-->port.
+ * Return value : char
+ *
+ */
+char UART_PortRxChar ( unsigned char port ) ;
+
+/*
+ *
+ * Description  :This function transmits a char on a port like UART_TxChar() does.
+ * I/P Arguments: unsigned char-->port, char-->data to be transmitted.
+ * Return value : none
+ *
+ */
+void UART_PortTxChar ( unsigned char port , char ch ) ;
+
+/*
+ *
+ * Description  :This function transmits an ASCII string on a port.
+ * I/P Arguments: unsigned char-->port, const char*-->string.
+ * Return value : none
+ *
+ */
+void UART_PortTxString ( unsigned char port , const char *string_ptr ) ;
+
+/*
+ *
+ * Description  :This function starts the receive ring of a port like UART_RxStart() does.
+ * I/P Arguments: unsigned char-->port.
+ * Return value : none
+ *
+ */
+void UART_PortRxStart ( unsigned char port ) ;
+
+/*
+ *
+ * Description  :This function returns the number of received chars waiting in the ring of a port.
+ * I/P Arguments: unsigned char-->port.
+ * Return value : unsigned char-->number of chars.
+ *
+ */
+unsigned char UART_PortRxAvailable ( unsigned char port ) ;
+
+/*
+ *
+ * Description  :This function takes the oldest received char from the ring of a port without waiting.
+ * I/P Arguments: unsigned char-->port, char*-->where the char is stored.
+ * Return value : unsigned char-->1 if a char was taken, 0 if the ring is empty.
+ *
+ */
+unsigned char UART_PortRxGet ( unsigned char port , char *ch ) ;
+
+/*
+ *
+ * Description  :This function returns the number of received chars lost on a port since UART_PortRxStart().
+ * I/P Arguments: unsigned char-->port.
+ * Return value : unsigned int-->number of chars.
+ *
+ */
+unsigned int UART_PortRxLost ( unsigned char port ) ;
+
+/*
+ *
+ * Description  :This function starts the transmit ring of a port like UART_TxStart() does.
+ * I/P Arguments: unsigned char-->port.
+ * Return value : none
+ *
+ */
+void UART_PortTxStart ( unsigned char port ) ;
+
+/*
+ *
+ * Description  :This function returns the number of chars waiting in the transmit ring of a port.
+ * I/P Arguments: unsigned char-->port.
+ * Return value : unsigned char-->number of chars.
+ *
+ */
+unsigned char UART_PortTxPending ( unsigned char port ) ;
+
+/*
+ *
+ * Description  :This function waits till every char of the transmit ring of a port has been written to UDR.
+ * I/P Arguments: unsigned char-->port.
+ * Return value : none
+ *
+ */
+void UART_PortTxFlush ( unsigned char port ) ;
+
+/*
+ *
+ * Description  :This function starts the RS-485 multi-drop mode on a port like UART_Rs485Start() does,
+ *		with the DE pin of the port.
+ * I/P Arguments: unsigned char-->port, unsigned char-->node address.
+ * Return value : none
+ *
+ */
+void UART_PortRs485Start ( unsigned char port , unsigned char node ) ;
+
+/*
+ *
+ * Description  :This function sends an RS-485 message on a port like UART_Rs485Send() does.
+ * I/P Arguments: unsigned char-->port, unsigned char-->address of the node(s), const unsigned char*-->data,
+ *		unsigned char-->number of bytes.
+ * Return value : none
+ *
+ */
+void UART_PortRs485Send ( unsigned char port , unsigned char address , const unsigned char *data , unsigned char n ) ;
+
+/*
+ *
+ * Description  :This function tells if an RS-485 message is still on the bus of a port.
+ * I/P Arguments: unsigned char-->port.
+ * Return value : unsigned char-->1 if sending, 0 if not.
+ *
+ */
+unsigned char UART_PortRs485Busy ( unsigned char port ) ;
+
 #endif /* UART_H_ */
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -15,7 +15,7 @@
 *
 *
 *	Chip:			ATmega32A
-*	Clock:			1MHz
+*	Clock:			8MHz internal RC(Clock.h)
 *
 *
 *	Compiler:		AVR/GNU C Compiler